@@ -10,6 +10,10 @@
 using namespace std;
 using namespace PoDoFo;
 
+// Chunk size of positional reads used to fill
+// the buffer of InputStreamDeviceView
+constexpr size_t VIEW_BUFFER_SIZE = 4096;
+
 InputStreamDevice::InputStreamDevice()
     : InputStreamDevice(true) { }
 
@@ -25,7 +29,190 @@ bool InputStreamDevice::Peek(char& ch) const
     return peek(ch);
 }
 
+size_t InputStreamDevice::ReadAt(size_t offset, char* buffer, size_t size)
+{
+    EnsureAccess(DeviceAccess::Read);
+    if (size == 0)
+        return 0;
+
+    return readAt(offset, buffer, size);
+}
+
+size_t InputStreamDevice::readAt(size_t offset, char* buffer, size_t size)
+{
+    if (!CanSeek())
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidDeviceOperation, "Positional read requires a seekable device");
+
+    size_t prevpos = GetPosition();
+    size_t length = GetLength();
+    if (offset >= length)
+        return 0;
+
+    Seek(offset);
+    size_t readCount = 0;
+    bool eof = false;
+    while (readCount < size && !eof)
+        readCount += readBuffer(buffer + readCount, size - readCount, eof);
+
+    Seek(prevpos);
+    return readCount;
+}
+
 void InputStreamDevice::checkRead() const
 {
     EnsureAccess(DeviceAccess::Read);
 }
+
+InputStreamDeviceView::InputStreamDeviceView(InputStreamDevice& source, size_t offset) :
+    m_source(&source),
+    m_Position(offset),
+    m_bufferOffset(0),
+    m_bufferLength(0),
+    m_eof(false)
+{
+}
+
+size_t InputStreamDeviceView::GetLength() const
+{
+    return m_source->GetLength();
+}
+
+size_t InputStreamDeviceView::GetPosition() const
+{
+    return m_Position;
+}
+
+bool InputStreamDeviceView::CanSeek() const
+{
+    return true;
+}
+
+bool InputStreamDeviceView::Eof() const
+{
+    return !fetch();
+}
+
+size_t InputStreamDeviceView::readBuffer(char* buffer, size_t size, bool& eof)
+{
+    size_t readCount = 0;
+    while (readCount < size)
+    {
+        if (m_Position >= m_bufferOffset && m_Position < m_bufferOffset + m_bufferLength)
+        {
+            // Drain the buffered data first
+            size_t bufferPos = m_Position - m_bufferOffset;
+            size_t count = std::min(size - readCount, m_bufferLength - bufferPos);
+            std::memcpy(buffer + readCount, m_buffer.data() + bufferPos, count);
+            readCount += count;
+            m_Position += count;
+        }
+        else if (size - readCount >= VIEW_BUFFER_SIZE)
+        {
+            // Large reads bypass the buffer
+            size_t count = m_source->ReadAt(m_Position, buffer + readCount, size - readCount);
+            readCount += count;
+            m_Position += count;
+            if (readCount < size)
+            {
+                m_eof = true;
+                break;
+            }
+        }
+        else if (!fetch())
+        {
+            break;
+        }
+    }
+
+    eof = !fetch();
+    return readCount;
+}
+
+bool InputStreamDeviceView::readChar(char& ch)
+{
+    if (!peek(ch))
+        return false;
+
+    m_Position++;
+    return true;
+}
+
+bool InputStreamDeviceView::peek(char& ch) const
+{
+    if (!fetch())
+    {
+        ch = '\0';
+        return false;
+    }
+
+    ch = m_buffer[m_Position - m_bufferOffset];
+    return true;
+}
+
+void InputStreamDeviceView::seek(ssize_t offset, SeekDirection direction)
+{
+    switch (direction)
+    {
+        case SeekDirection::Begin:
+        {
+            if (offset < 0)
+                PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidDeviceOperation, "Invalid negative seek");
+
+            m_Position = (size_t)offset;
+            break;
+        }
+        case SeekDirection::Current:
+        {
+            if (offset < 0 && (size_t)-offset > m_Position)
+                PODOFO_RAISE_ERROR_INFO(PdfErrorCode::ValueOutOfRange, "Invalid seek out of bounds");
+
+            m_Position = (size_t)((ssize_t)m_Position + offset);
+            break;
+        }
+        case SeekDirection::End:
+        {
+            size_t length = GetLength();
+            if (offset > 0)
+                PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidDeviceOperation, "Invalid positive seek");
+            else if ((size_t)-offset > length)
+                PODOFO_RAISE_ERROR_INFO(PdfErrorCode::ValueOutOfRange, "Invalid seek out of bounds");
+
+            m_Position = (size_t)(length + offset);
+            break;
+        }
+        default:
+            PODOFO_RAISE_ERROR(PdfErrorCode::InvalidEnumValue);
+    }
+
+    // The end of the source is not known anymore
+    m_eof = false;
+}
+
+size_t InputStreamDeviceView::readAt(size_t offset, char* buffer, size_t size)
+{
+    return m_source->ReadAt(offset, buffer, size);
+}
+
+// Ensure the buffer contains the character at the current position
+// Returns false if the end of the source device has been reached
+bool InputStreamDeviceView::fetch() const
+{
+    if (m_Position >= m_bufferOffset && m_Position < m_bufferOffset + m_bufferLength)
+        return true;
+
+    if (m_eof)
+        return false;
+
+    if (m_buffer.size() == 0)
+        m_buffer.resize(VIEW_BUFFER_SIZE);
+
+    m_bufferOffset = m_Position;
+    m_bufferLength = m_source->ReadAt(m_Position, m_buffer.data(), VIEW_BUFFER_SIZE);
+    if (m_bufferLength == 0)
+    {
+        m_eof = true;
+        return false;
+    }
+
+    return true;
+}
@@ -10,6 +10,7 @@
 #include <istream>
 #include <fstream>
 
+#include "basetypes.h"
 #include "StreamDeviceBase.h"
 #include "InputStream.h"
 
@@ -31,15 +32,83 @@ public:
      */
     bool Peek(char& ch) const;
 
+    /** Read data at the given absolute offset without
+     * moving the current position of the device
+     * \param offset absolute offset from the beginning of the device
+     * \param buffer a pointer to the data buffer
+     * \param size length of the output buffer
+     * \returns number of read bytes. It's less than size only if
+     * the end of the device has been reached
+     */
+    size_t ReadAt(size_t offset, char* buffer, size_t size);
+
 protected:
     /** Peek at next char in stream.
      *  /returns true if success, false if EOF
      */
     virtual bool peek(char& ch) const = 0;
 
+    /** Read data at the given absolute offset.
+     * The default implementation saves the current position, seeks,
+     * reads and finally restores the position: devices with native
+     * positional read capabilities should override it
+     */
+    virtual size_t readAt(size_t offset, char* buffer, size_t size);
+
     void checkRead() const override;
 };
 
+/** An input device that reads from a source device only
+ * by means of positional reads (see InputStreamDevice::ReadAt),
+ * keeping its own position. The position of the source device
+ * is never modified, so more views can share the same source
+ * \remarks Data is fetched in chunks and buffered. The source
+ * device must outlive the view
+ */
+class PODOFO_API InputStreamDeviceView final : public InputStreamDevice
+{
+public:
+    /**
+     * \param source the device to read from
+     * \param offset the initial absolute position of the view
+     */
+    InputStreamDeviceView(InputStreamDevice& source, size_t offset = 0);
+
+public:
+    /** Get the length of the source device
+     * \remarks This may alter the position of
+     * the source device if it lacks a native length query
+     */
+    size_t GetLength() const override;
+
+    /** Get the absolute position of the view in the source device
+     */
+    size_t GetPosition() const override;
+
+    bool CanSeek() const override;
+
+    bool Eof() const override;
+
+protected:
+    size_t readBuffer(char* buffer, size_t size, bool& eof) override;
+    bool readChar(char& ch) override;
+    bool peek(char& ch) const override;
+    void seek(ssize_t offset, SeekDirection direction) override;
+    size_t readAt(size_t offset, char* buffer, size_t size) override;
+
+private:
+    bool fetch() const;
+
+private:
+    InputStreamDevice* m_source;
+    size_t m_Position;
+    // Buffered chunk, starting at absolute offset m_bufferOffset
+    mutable charbuff m_buffer;
+    mutable size_t m_bufferOffset;
+    mutable size_t m_bufferLength;
+    mutable bool m_eof;
+};
+
 };
 
 #endif // AUX_INPUT_DEVICE_H
@@ -11,6 +11,14 @@
 
 #include <podofo/private/FileSystem.h>
 
+#ifdef _WIN32
+#include <podofo/private/WindowsLeanMean.h>
+#include <podofo/private/utfcpp_extensions.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 using namespace std;
 using namespace PoDoFo;
 
@@ -388,15 +396,102 @@ FileStreamDevice::FileStreamDevice(const string_view& filepath, FileMode mode)
 }
 
 FileStreamDevice::FileStreamDevice(const string_view& filepath, FileMode mode, DeviceAccess access)
-    : StandardStreamDevice(access, *getFileStream(filepath, mode, access), true), m_Filepath(filepath)
+    : StandardStreamDevice(access, *getFileStream(filepath, mode, access), true), m_Filepath(filepath), m_nativeHandle(-1)
 {
+    // NOTE: Positional reads on a writable stream may miss
+    // data still buffered in the std::fstream, so use the
+    // native handle only for read-only devices
+    if (access == DeviceAccess::Read)
+        openNativeHandle();
+}
+
+FileStreamDevice::~FileStreamDevice()
+{
+    closeNativeHandle();
 }
 
 void FileStreamDevice::close()
 {
+    closeNativeHandle();
     dynamic_cast<fstream&>(GetStream()).close();
 }
 
+size_t FileStreamDevice::readAt(size_t offset, char* buffer, size_t size)
+{
+    if (m_nativeHandle == -1)
+        return StandardStreamDevice::readAt(offset, buffer, size);
+
+    size_t readCount = 0;
+    while (readCount < size)
+    {
+#ifdef _WIN32
+        // NOTE: ReadFile can read at most 4GB at once
+        DWORD toRead = (DWORD)std::min(size - readCount, (size_t)numeric_limits<DWORD>::max());
+        OVERLAPPED overlapped{ };
+        uint64_t currOffset = (uint64_t)(offset + readCount);
+        overlapped.Offset = (DWORD)currOffset;
+        overlapped.OffsetHigh = (DWORD)(currOffset >> 32);
+        DWORD read;
+        if (!ReadFile((HANDLE)m_nativeHandle, buffer + readCount, toRead, &read, &overlapped))
+        {
+            DWORD rc = GetLastError();
+            if (rc == ERROR_HANDLE_EOF)
+                break;
+
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidDeviceOperation,
+                "Failed to read at offset {}: {}", currOffset, utls::GetWin32ErrorMessage(rc));
+        }
+#else
+        ssize_t read = ::pread((int)m_nativeHandle, buffer + readCount, size - readCount, (off_t)(offset + readCount));
+        if (read < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidDeviceOperation,
+                "Failed to read at offset {}: {}", offset + readCount, std::strerror(errno));
+        }
+#endif
+        if (read == 0)
+            break;
+
+        readCount += (size_t)read;
+    }
+
+    return readCount;
+}
+
+void FileStreamDevice::openNativeHandle()
+{
+#ifdef _WIN32
+    auto filepath16 = utf8::utf8to16(m_Filepath);
+    HANDLE handle = CreateFileW((wchar_t*)filepath16.c_str(), GENERIC_READ,
+        FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (handle != INVALID_HANDLE_VALUE)
+        m_nativeHandle = (intptr_t)handle;
+#else
+    int fd = ::open(m_Filepath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd != -1)
+        m_nativeHandle = fd;
+#endif
+    // NOTE: If the native handle can't be opened
+    // we will fallback to the std::fstream
+}
+
+void FileStreamDevice::closeNativeHandle()
+{
+    if (m_nativeHandle == -1)
+        return;
+
+#ifdef _WIN32
+    CloseHandle((HANDLE)m_nativeHandle);
+#else
+    ::close((int)m_nativeHandle);
+#endif
+    m_nativeHandle = -1;
+}
+
 fstream* FileStreamDevice::getFileStream(const string_view& filename, FileMode mode, DeviceAccess access)
 {
     switch (mode)
@@ -657,3 +752,13 @@ void SpanStreamDevice::seek(ssize_t offset, SeekDirection direction)
 {
     m_Position = SeekPosition(m_Position, m_Length, offset, direction);
 }
+
+size_t SpanStreamDevice::readAt(size_t offset, char* buffer, size_t size)
+{
+    if (offset >= m_Length)
+        return 0;
+
+    size_t readCount = std::min(size, m_Length - offset);
+    std::memcpy(buffer, m_buffer + offset, readCount);
+    return readCount;
+}
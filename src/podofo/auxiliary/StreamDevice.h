@@ -112,17 +112,29 @@ public:
     FileStreamDevice(const std::string_view& filepath, FileMode mode,
         DeviceAccess access);
 
+    ~FileStreamDevice();
+
 public:
     const std::string& GetFilepath() const { return m_Filepath; }
 
 protected:
     void close() override;
+    /** Read-only devices read using a separate native file handle
+     * (pread() on POSIX, ReadFile() with an explicit offset on Windows),
+     * so the position of the underlying std::fstream is never touched
+     */
+    size_t readAt(size_t offset, char* buffer, size_t size) override;
 
 private:
     std::fstream* getFileStream(const std::string_view& filename, FileMode mode, DeviceAccess access);
+    void openNativeHandle();
+    void closeNativeHandle();
 
 private:
     std::string m_Filepath;
+    // Native file handle used for positional reads: it's
+    // a file descriptor on POSIX and a HANDLE on Windows
+    intptr_t m_nativeHandle;
 };
 
 template <typename TContainer>
@@ -205,6 +217,16 @@ protected:
         m_Position = SeekPosition(m_Position, m_container->size(), offset, direction);
     }
 
+    size_t readAt(size_t offset, char* buffer, size_t size) override
+    {
+        if (offset >= m_container->size())
+            return 0;
+
+        size_t readCount = std::min(size, m_container->size() - offset);
+        std::memcpy(buffer, m_container->data() + offset, readCount);
+        return readCount;
+    }
+
 private:
     TContainer* m_container;
     size_t m_Position;
@@ -243,6 +265,7 @@ protected:
     bool readChar(char& ch) override;
     bool peek(char& ch) const override;
     void seek(ssize_t offset, SeekDirection direction) override;
+    size_t readAt(size_t offset, char* buffer, size_t size) override;
 
 private:
     SpanStreamDevice(std::nullptr_t) = delete;
@@ -381,14 +381,13 @@ void PdfArray::insert(const PdfArray::iterator& pos,
     const InputIterator& last)
 {
     AssertMutable();
-    auto document = GetObjectDocument();
-    InputIterator it1 = first;
-    iterator it2 = pos;
-    for (; it1 != last; it1++, it2++)
-    {
-        it2 = m_Objects.insert(it2, *it1);
-        it2->SetDocument(document);
-    }
+    // Insert the range at once, then fix the parent of the inserted objects
+    size_t index = (size_t)(pos - m_Objects.begin());
+    size_t prevSize = m_Objects.size();
+    m_Objects.insert(pos, first, last);
+    size_t end = index + (m_Objects.size() - prevSize);
+    for (size_t i = index; i < end; i++)
+        m_Objects[i].SetParent(*this);
 
     SetDirty();
 }
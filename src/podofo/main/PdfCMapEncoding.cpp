@@ -7,6 +7,9 @@
 #include <podofo/private/PdfDeclarationsPrivate.h>
 #include "PdfCMapEncoding.h"
 
+#include <list>
+#include <mutex>
+
 #include <utf8cpp/utf8.h>
 
 #include "PdfDictionary.h"
@@ -16,6 +19,7 @@
 #include "PdfIdentityEncoding.h"
 #include "PdfEncodingMapFactory.h"
 #include <podofo/auxiliary/StreamDevice.h>
+#include <podofo/private/OpenSSLInternal.h>
 
 using namespace std;
 using namespace PoDoFo;
@@ -32,12 +36,47 @@ static uint32_t getCodeFromVariant(const PdfVariant& var, CodeLimits& limits);
 static uint32_t getCodeFromVariant(const PdfVariant& var, CodeLimits& limits, unsigned char& codeSize);
 static vector<char32_t> handleNameMapping(const PdfName& name);
 static vector<char32_t> handleStringMapping(const PdfString& str);
-static void handleRangeMapping(PdfCharCodeMap& map,
-    uint32_t srcCodeLo, const vector<char32_t>& dstCodeLo,
-    unsigned char codeSize, unsigned rangeSize);
 static vector<char32_t> handleUtf8String(const string& str);
 static void pushMapping(PdfCharCodeMap& map, const PdfCharCode& codeUnit, const std::vector<char32_t>& codePoints);
-static PdfCharCodeMap parseCMapObject(const PdfObjectStream& stream, CodeLimits& limits);
+static PdfCharCodeMap parseCMapObject(const bufferview& data, CodeLimits& limits);
+
+namespace
+{
+    // A parsed CMap, identified by the SHA-256 digest and the size of its content
+    struct CMapCacheEntry
+    {
+        charbuff DataDigest;
+        size_t DataSize = 0;
+        CodeLimits CodeSpaceLimits;
+        shared_ptr<PdfCharCodeMap> Map;
+        PdfEncodingLimits Limits;
+        bool IsIdentity = false;
+    };
+
+    using CMapCacheEntryPtr = shared_ptr<const CMapCacheEntry>;
+
+    // Process wide cache of the parsed CMaps, most recently used first
+    struct CMapCache
+    {
+        mutex Mutex;
+        unsigned MaxCount = 256;
+        list<CMapCacheEntryPtr> Entries;
+        // Entries indexed by the leading bytes of the digest
+        unordered_multimap<uint64_t, list<CMapCacheEntryPtr>::iterator> Index;
+    };
+}
+
+static constexpr string_view CMapCacheMagic = "PDFCMAPS";
+static constexpr uint32_t CMapCacheVersion = 2;
+static constexpr unsigned CMapDigestSize = 32;
+
+static CMapCache& getCMapCache();
+static CMapCacheEntryPtr findCachedCMap(const charbuff& dataDigest, size_t dataSize);
+static bool tryAddCachedCMap(const CMapCacheEntryPtr& entry);
+static void trimCMapCache(CMapCache& cache);
+static void initCMapCacheEntry(CMapCacheEntry& entry);
+static charbuff computeDataDigest(const bufferview& data);
+static uint64_t getDigestKey(const charbuff& digest);
 
 PdfCMapEncoding::PdfCMapEncoding(PdfCharCodeMap&& map)
     : PdfCMapEncoding(std::move(map), map.GetLimits()) { }
@@ -45,6 +84,9 @@ PdfCMapEncoding::PdfCMapEncoding(PdfCharCodeMap&& map)
 PdfCMapEncoding::PdfCMapEncoding(PdfCharCodeMap&& map, const PdfEncodingLimits& limits)
     : PdfEncodingMapBase(std::move(map), PdfEncodingMapType::CMap), m_Limits(limits) { }
 
+PdfCMapEncoding::PdfCMapEncoding(const shared_ptr<PdfCharCodeMap>& map, const PdfEncodingLimits& limits)
+    : PdfEncodingMapBase(map, PdfEncodingMapType::CMap), m_Limits(limits) { }
+
 unique_ptr<PdfEncodingMap> PdfEncodingMapFactory::ParseCMapEncoding(const PdfObject& cmapObj)
 {
     unique_ptr<PdfEncodingMap> ret;
@@ -63,50 +105,153 @@ bool PdfEncodingMapFactory::TryParseCMapEncoding(const PdfObject& cmapObj, uniqu
         return false;
     }
 
-    CodeLimits codeLimits;
-    auto map = parseCMapObject(*stream, codeLimits);
-    auto mapLimits = map.GetLimits();
-    // NOTE: In some cases the encoding is degenerate and has no code
-    // entries at all, but the CMap may still encode the code size
-    // in "begincodespacerange"
-    if (codeLimits.MinCodeSize < mapLimits.MinCodeSize)
-        mapLimits.MinCodeSize = codeLimits.MinCodeSize;
-    if (codeLimits.MaxCodeSize > mapLimits.MaxCodeSize)
-        mapLimits.MaxCodeSize = codeLimits.MaxCodeSize;
+    charbuff streamBuffer;
+    stream->CopyTo(streamBuffer);
 
-    if (map.GetSize() != 0
-        && mapLimits.MinCodeSize == mapLimits.MaxCodeSize)
+    // Identical CMaps, like the /ToUnicode maps of fonts from
+    // the same producer, are parsed only once process wide
+    auto dataDigest = computeDataDigest(streamBuffer);
+    auto entry = findCachedCMap(dataDigest, streamBuffer.size());
+    if (entry == nullptr)
     {
-        // Try to determine if the encoding is actually
-        // an identity encoding
-        auto it = map.begin();
-        auto end = map.end();
-        unsigned prev = it->first.Code - 1;
-        bool identity = true;
-        do
+        auto newEntry = std::make_shared<CMapCacheEntry>();
+        newEntry->DataDigest = std::move(dataDigest);
+        newEntry->DataSize = streamBuffer.size();
+        newEntry->Map = std::make_shared<PdfCharCodeMap>(
+            parseCMapObject(streamBuffer, newEntry->CodeSpaceLimits));
+        initCMapCacheEntry(*newEntry);
+        if (tryAddCachedCMap(newEntry))
         {
-            if (it->second.size() > 1
-                || it->first.Code != it->second[0]
-                || it->first.Code > (prev + 1))
-            {
-                identity = false;
-                break;
-            }
+            // The map is going to be shared: build the lookup
+            // tables now, so readers don't have to wait for it
+            newEntry->Map->revise();
+        }
+
+        entry = std::move(newEntry);
+    }
+
+    if (entry->IsIdentity)
+    {
+        encoding.reset(new PdfIdentityEncoding(
+            PdfEncodingMapType::CMap, entry->Limits, PdfIdentityOrientation::Unkwnown));
+    }
+    else
+    {
+        encoding.reset(new PdfCMapEncoding(entry->Map, entry->Limits));
+    }
+
+    return true;
+}
+
+void PdfEncodingMapFactory::SetCMapCacheSize(unsigned maxCount)
+{
+    auto& cache = getCMapCache();
+    unique_lock<mutex> lock(cache.Mutex);
+    cache.MaxCount = maxCount;
+    trimCMapCache(cache);
+}
 
-            prev = it->first.Code;
-            it++;
-        } while (it != end);
+unsigned PdfEncodingMapFactory::GetCMapCacheSize()
+{
+    auto& cache = getCMapCache();
+    unique_lock<mutex> lock(cache.Mutex);
+    return cache.MaxCount;
+}
+
+void PdfEncodingMapFactory::ClearCMapCache()
+{
+    auto& cache = getCMapCache();
+    unique_lock<mutex> lock(cache.Mutex);
+    cache.Entries.clear();
+    cache.Index.clear();
+}
 
-        if (identity)
+// The binary format is a header followed by the entries, with
+// the mappings of each CMap as they are found in the map.
+// All the integers are big endian
+void PdfEncodingMapFactory::SaveCMapCache(OutputStream& stream)
+{
+    vector<CMapCacheEntryPtr> entries;
+    {
+        auto& cache = getCMapCache();
+        unique_lock<mutex> lock(cache.Mutex);
+        entries.assign(cache.Entries.begin(), cache.Entries.end());
+    }
+
+    stream.Write(CMapCacheMagic);
+    utls::WriteUInt32BE(stream, CMapCacheVersion);
+    utls::WriteUInt32BE(stream, (uint32_t)entries.size());
+    // Write the least recently used entries first, so
+    // loading them will preserve the order
+    for (auto it = entries.rbegin(); it != entries.rend(); it++)
+    {
+        auto& entry = **it;
+        stream.Write(entry.DataDigest.data(), entry.DataDigest.size());
+        utls::WriteUInt32BE(stream, (uint32_t)entry.DataSize);
+        stream.Write((char)entry.CodeSpaceLimits.MinCodeSize);
+        stream.Write((char)entry.CodeSpaceLimits.MaxCodeSize);
+        utls::WriteUInt32BE(stream, entry.Map->GetSize());
+        for (auto& pair : *entry.Map)
         {
-            encoding.reset(new PdfIdentityEncoding(
-                PdfEncodingMapType::CMap, mapLimits, PdfIdentityOrientation::Unkwnown));
-            return true;
+            utls::WriteUInt32BE(stream, pair.first.Code);
+            stream.Write((char)pair.first.CodeSpaceSize);
+            utls::WriteUInt16BE(stream, (uint16_t)pair.second.size());
+            for (codepoint codePoint : pair.second)
+                utls::WriteUInt32BE(stream, (uint32_t)codePoint);
         }
     }
+}
 
-    encoding.reset(new PdfCMapEncoding(std::move(map), mapLimits));
-    return true;
+void PdfEncodingMapFactory::LoadCMapCache(InputStream& stream)
+{
+    char magic[CMapCacheMagic.size()];
+    stream.Read(magic, CMapCacheMagic.size());
+    if (string_view(magic, CMapCacheMagic.size()) != CMapCacheMagic)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidDataType, "Invalid CMap cache data");
+
+    uint32_t version;
+    utls::ReadUInt32BE(stream, version);
+    if (version != CMapCacheVersion)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnsupportedFilter, "Unsupported CMap cache version {}", version);
+
+    uint32_t entryCount;
+    uint32_t dataSize;
+    uint32_t mappingCount;
+    uint32_t code;
+    uint16_t codePointCount;
+    uint32_t codePoint;
+    vector<codepoint> codePoints;
+    utls::ReadUInt32BE(stream, entryCount);
+    for (unsigned i = 0; i < entryCount; i++)
+    {
+        auto entry = std::make_shared<CMapCacheEntry>();
+        entry->DataDigest.resize(CMapDigestSize);
+        stream.Read(entry->DataDigest.data(), CMapDigestSize);
+        utls::ReadUInt32BE(stream, dataSize);
+        entry->DataSize = dataSize;
+        entry->CodeSpaceLimits.MinCodeSize = (unsigned char)stream.ReadChar();
+        entry->CodeSpaceLimits.MaxCodeSize = (unsigned char)stream.ReadChar();
+        entry->Map = std::make_shared<PdfCharCodeMap>();
+        utls::ReadUInt32BE(stream, mappingCount);
+        for (unsigned j = 0; j < mappingCount; j++)
+        {
+            utls::ReadUInt32BE(stream, code);
+            unsigned char codeSpaceSize = (unsigned char)stream.ReadChar();
+            utls::ReadUInt16BE(stream, codePointCount);
+            codePoints.clear();
+            for (unsigned k = 0; k < codePointCount; k++)
+            {
+                utls::ReadUInt32BE(stream, codePoint);
+                codePoints.push_back((codepoint)codePoint);
+            }
+
+            entry->Map->PushMapping({ code, codeSpaceSize }, codePoints);
+        }
+
+        initCMapCacheEntry(*entry);
+        if (tryAddCachedCMap(entry))
+            entry->Map->revise();
+    }
 }
 
 const PdfEncodingLimits& PdfCMapEncoding::GetLimits() const
@@ -120,13 +265,10 @@ bool PdfCMapEncoding::HasLigaturesSupport() const
     return true;
 }
 
-PdfCharCodeMap parseCMapObject(const PdfObjectStream& stream, CodeLimits& limits)
+PdfCharCodeMap parseCMapObject(const bufferview& data, CodeLimits& limits)
 {
     PdfCharCodeMap ret;
-    charbuff streamBuffer;
-    stream.CopyTo(streamBuffer);
-
-    SpanStreamDevice device(streamBuffer);
+    SpanStreamDevice device(data);
     // NOTE: Found a CMap like this
     // /CIDSystemInfo
     // <<
@@ -181,12 +323,15 @@ PdfCharCodeMap parseCMapObject(const PdfObjectStream& stream, CodeLimits& limits
                         uint32_t srcCodeLo = getCodeFromVariant(*var, limits, codeSize);
                         tokenizer.ReadNextVariant(device, *var);
                         uint32_t srcCodeHi = getCodeFromVariant(*var, limits);
-                        unsigned rangeSize = srcCodeHi - srcCodeLo + 1;
+                        // NOTE: Ranges with the high code lower than the
+                        // low code are invalid and are ignored
+                        unsigned rangeSize = srcCodeHi < srcCodeLo ? 0 : srcCodeHi - srcCodeLo + 1;
                         tokenizer.ReadNextVariant(device, *var);
                         if (var->IsArray())
                         {
                             PdfArray& arr = var->GetArray();
-                            for (unsigned i = 0; i < rangeSize; i++)
+                            unsigned arrSize = std::min(rangeSize, (unsigned)arr.size());
+                            for (unsigned i = 0; i < arrSize; i++)
                             {
                                 auto& dst = arr[i];
                                 if (dst.TryGetString(str) && str.IsHex()) // pp. 475 PdfReference 1.7
@@ -202,12 +347,14 @@ PdfCharCodeMap parseCMapObject(const PdfObjectStream& stream, CodeLimits& limits
                             // pp. 474 PdfReference 1.7
                             auto dstCodeLo = handleStringMapping(var->GetString());
                             if (dstCodeLo.size() != 0)
-                                handleRangeMapping(ret, srcCodeLo, dstCodeLo, codeSize, rangeSize);
+                                ret.PushRangeMapping({ srcCodeLo, codeSize }, rangeSize, dstCodeLo);
                         }
                         else if (var->IsName())
                         {
                             // As found in tecnincal document #5014
-                            handleRangeMapping(ret, srcCodeLo, handleNameMapping(var->GetName()), codeSize, rangeSize);
+                            auto dstCodeLo = handleNameMapping(var->GetName());
+                            if (dstCodeLo.size() != 0)
+                                ret.PushRangeMapping({ srcCodeLo, codeSize }, rangeSize, dstCodeLo);
                         }
                         else
                             PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidDataType, "beginbfrange: expected array, string or array");
@@ -262,15 +409,8 @@ PdfCharCodeMap parseCMapObject(const PdfObjectStream& stream, CodeLimits& limits
                         uint32_t srcCodeHi = getCodeFromVariant(*var, limits);
                         tokenizer.ReadNextVariant(device, *var);
                         char32_t dstCIDLo = (char32_t)getCodeFromVariant(*var, limits);
-
-                        unsigned rangeSize = srcCodeHi - srcCodeLo + 1;
-                        for (unsigned i = 0; i < rangeSize; i++)
-                        {
-                            char32_t newbackchar = dstCIDLo + i;
-                            mappedCodes.clear();
-                            mappedCodes.push_back(newbackchar);
-                            pushMapping(ret, { srcCodeLo + i, codeSize }, mappedCodes);
-                        }
+                        if (srcCodeHi >= srcCodeLo)
+                            ret.PushRangeMapping({ srcCodeLo, codeSize }, srcCodeHi - srcCodeLo + 1, codepointview(&dstCIDLo, 1));
                     }
                 }
                 else if (token == "begincidchar")
@@ -310,49 +450,142 @@ PdfCharCodeMap parseCMapObject(const PdfObjectStream& stream, CodeLimits& limits
     return ret;
 }
 
-// Base Font 3 type CMap interprets strings as found in
-// beginbfchar and beginbfrange as UTF-16BE, see PdfReference 1.7
-// page 472. NOTE: Before UTF-16BE there was UCS-2 but UTF-16
-// is backward compatible with UCS-2
-vector<char32_t> handleStringMapping(const PdfString& str)
+CMapCache& getCMapCache()
 {
-    auto& rawdata = str.GetRawData();
-    string utf8;
-    utls::ReadUtf16BEString(rawdata, utf8);
-    return handleUtf8String(utf8);
+    static CMapCache s_cache;
+    return s_cache;
 }
 
-// Handle a range in begingbfrage "srcCodeLo srcCodeHi dstCodeLo" clause
-void handleRangeMapping(PdfCharCodeMap& map,
-    uint32_t srcCodeLo, const vector<char32_t>& dstCodeLo,
-    unsigned char codeSize, unsigned rangeSize)
+CMapCacheEntryPtr findCachedCMap(const charbuff& dataDigest, size_t dataSize)
 {
-    auto it = dstCodeLo.begin();
-    auto end = dstCodeLo.end();
-    PODOFO_INVARIANT(it != end);
-    char32_t back = dstCodeLo.back();
-    vector<char32_t> newdstbase;
-    // Compute a destination string that has all code points except the last one
-    if (dstCodeLo.size() != 1)
+    auto& cache = getCMapCache();
+    unique_lock<mutex> lock(cache.Mutex);
+    auto range = cache.Index.equal_range(getDigestKey(dataDigest));
+    for (auto it = range.first; it != range.second; it++)
+    {
+        auto entryIt = it->second;
+        if ((*entryIt)->DataSize != dataSize || (*entryIt)->DataDigest != dataDigest)
+            continue;
+
+        // Move the entry to the front, as the most recently used
+        cache.Entries.splice(cache.Entries.begin(), cache.Entries, entryIt);
+        return *entryIt;
+    }
+
+    return nullptr;
+}
+
+bool tryAddCachedCMap(const CMapCacheEntryPtr& entry)
+{
+    auto& cache = getCMapCache();
+    unique_lock<mutex> lock(cache.Mutex);
+    if (cache.MaxCount == 0)
+        return false;
+
+    uint64_t key = getDigestKey(entry->DataDigest);
+    auto range = cache.Index.equal_range(key);
+    for (auto it = range.first; it != range.second; it++)
     {
-        do
+        // Another thread may have added the same CMap in the meantime
+        if ((*it->second)->DataSize == entry->DataSize
+            && (*it->second)->DataDigest == entry->DataDigest)
         {
-            newdstbase.push_back(*it);
-            it++;
-        } while (it != end);
+            return false;
+        }
     }
 
-    // Compute new destination string with last character/code point incremented by one
-    vector<char32_t> newdst;
-    for (unsigned i = 0; i < rangeSize; i++)
+    cache.Entries.push_front(entry);
+    cache.Index.insert({ key, cache.Entries.begin() });
+    trimCMapCache(cache);
+    return true;
+}
+
+void trimCMapCache(CMapCache& cache)
+{
+    while (cache.Entries.size() > cache.MaxCount)
     {
-        newdst = newdstbase;
-        char32_t newbackchar = back + i;
-        newdst.push_back(newbackchar);
-        pushMapping(map, { srcCodeLo + i, codeSize }, newdst);
+        auto last = std::prev(cache.Entries.end());
+        auto range = cache.Index.equal_range(getDigestKey((*last)->DataDigest));
+        for (auto it = range.first; it != range.second; it++)
+        {
+            if (it->second == last)
+            {
+                cache.Index.erase(it);
+                break;
+            }
+        }
+
+        cache.Entries.erase(last);
     }
 }
 
+void initCMapCacheEntry(CMapCacheEntry& entry)
+{
+    auto& map = *entry.Map;
+    auto& limits = entry.Limits;
+    limits = map.GetLimits();
+    // NOTE: In some cases the encoding is degenerate and has no code
+    // entries at all, but the CMap may still encode the code size
+    // in "begincodespacerange"
+    if (entry.CodeSpaceLimits.MinCodeSize < limits.MinCodeSize)
+        limits.MinCodeSize = entry.CodeSpaceLimits.MinCodeSize;
+    if (entry.CodeSpaceLimits.MaxCodeSize > limits.MaxCodeSize)
+        limits.MaxCodeSize = entry.CodeSpaceLimits.MaxCodeSize;
+
+    entry.IsIdentity = false;
+    if (map.GetSize() == 0 || limits.MinCodeSize != limits.MaxCodeSize)
+        return;
+
+    // Try to determine if the encoding is actually
+    // an identity encoding
+    auto it = map.begin();
+    auto end = map.end();
+    unsigned prev = it->first.Code - 1;
+    do
+    {
+        if (it->second.size() > 1
+            || it->first.Code != it->second[0]
+            || it->first.Code > (prev + 1))
+        {
+            return;
+        }
+
+        prev = it->first.Code;
+        it++;
+    } while (it != end);
+
+    entry.IsIdentity = true;
+}
+
+charbuff computeDataDigest(const bufferview& data)
+{
+    // A cryptographic digest, so a cache hit can be trusted
+    // to be the same CMap without retaining its content. It's
+    // also stable across platforms and builds, so it can be
+    // used to identify the CMaps of a serialized cache
+    return ssl::ComputeHash(data, PdfHashingAlgorithm::SHA256);
+}
+
+uint64_t getDigestKey(const charbuff& digest)
+{
+    uint64_t key;
+    PODOFO_ASSERT(digest.size() >= sizeof(key));
+    std::memcpy(&key, digest.data(), sizeof(key));
+    return key;
+}
+
+// Base Font 3 type CMap interprets strings as found in
+// beginbfchar and beginbfrange as UTF-16BE, see PdfReference 1.7
+// page 472. NOTE: Before UTF-16BE there was UCS-2 but UTF-16
+// is backward compatible with UCS-2
+vector<char32_t> handleStringMapping(const PdfString& str)
+{
+    auto& rawdata = str.GetRawData();
+    string utf8;
+    utls::ReadUtf16BEString(rawdata, utf8);
+    return handleUtf8String(utf8);
+}
+
 // codeSize is the number of the octets in the string or the minimum number
 // of bytes to represent the number, example <cd> -> 1, <00cd> -> 2
 static uint32_t getCodeFromVariant(const PdfVariant& var, unsigned char& codeSize)
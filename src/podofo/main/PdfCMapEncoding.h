@@ -22,6 +22,7 @@ namespace PoDoFo
 
     private:
         PdfCMapEncoding(PdfCharCodeMap&& map, const PdfEncodingLimits& limits);
+        PdfCMapEncoding(const std::shared_ptr<PdfCharCodeMap>& map, const PdfEncodingLimits& limits);
 
     public:
         bool HasLigaturesSupport() const override;
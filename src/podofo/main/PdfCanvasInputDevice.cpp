@@ -9,11 +9,37 @@
 #include "PdfCanvas.h"
 #include <podofo/auxiliary/StreamDevice.h>
 
+#include <thread>
+#include <future>
+
 using namespace std;
 using namespace PoDoFo;
 
 PdfCanvasInputDevice::PdfCanvasInputDevice(const PdfCanvas& canvas)
     : m_eof(false), m_deviceSwitchOccurred(false)
+{
+    collectContents(canvas);
+    if (!tryPopNextDevice())
+        m_eof = true;
+}
+
+PdfCanvasInputDevice::PdfCanvasInputDevice(const PdfCanvas& canvas, charbuff& buffer, bool parallel)
+    : m_eof(false), m_deviceSwitchOccurred(false)
+{
+    collectContents(canvas);
+    decodeContents(buffer, parallel);
+    if (buffer.size() == 0)
+    {
+        m_eof = true;
+        return;
+    }
+
+    // NOTE: All the contents are now in the buffer, there
+    // won't be any device switch
+    m_currDevice = std::make_unique<SpanStreamDevice>(buffer);
+}
+
+void PdfCanvasInputDevice::collectContents(const PdfCanvas& canvas)
 {
     auto contents = canvas.GetContentsObject();
     if (contents != nullptr)
@@ -42,8 +68,70 @@ PdfCanvasInputDevice::PdfCanvasInputDevice(const PdfCanvas& canvas)
         }
     }
 
-    if (!tryPopNextDevice())
-        m_eof = true;
+}
+
+void PdfCanvasInputDevice::decodeContents(charbuff& buffer, bool parallel)
+{
+    buffer.clear();
+
+    // Load the streams first, since it may trigger
+    // reading from the document device
+    vector<const PdfObjectStream*> streams;
+    streams.reserve(m_contents.size());
+    for (auto obj : m_contents)
+    {
+        auto stream = obj->GetStream();
+        if (stream != nullptr)
+            streams.push_back(stream);
+    }
+    m_contents.clear();
+
+    // ISO 32000-1:2008: Table 30 – Entries in a page object,
+    // /Contents: "The division between streams may occur
+    // only at the boundaries between lexical tokens".
+    // Separate the streams with a newline
+    unsigned threadCount = parallel ? std::min((unsigned)streams.size(), std::thread::hardware_concurrency()) : 1;
+    if (threadCount <= 1)
+    {
+        BufferStreamDevice device(buffer);
+        for (unsigned i = 0; i < streams.size(); i++)
+        {
+            if (i != 0)
+                device.Write('\n');
+
+            streams[i]->CopyTo(device);
+        }
+        return;
+    }
+
+    // Decode the streams interleaved on the worker threads,
+    // then concatenate them. Exceptions are rethrown by get()
+    vector<charbuff> decoded(streams.size());
+    vector<future<void>> workers;
+    workers.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; i++)
+    {
+        workers.push_back(std::async(std::launch::async, [&streams, &decoded, threadCount, i]() {
+            for (unsigned j = i; j < streams.size(); j += threadCount)
+                streams[j]->CopyTo(decoded[j]);
+        }));
+    }
+
+    for (auto& worker : workers)
+        worker.get();
+
+    size_t size = 0;
+    for (auto& part : decoded)
+        size += part.size() + 1;
+
+    buffer.reserve(size);
+    for (unsigned i = 0; i < decoded.size(); i++)
+    {
+        if (i != 0)
+            buffer.push_back('\n');
+
+        buffer.append(decoded[i]);
+    }
 }
 
 bool PdfCanvasInputDevice::peek(char& ch) const
@@ -25,11 +25,22 @@ class PODOFO_API PdfCanvasInputDevice final : public InputStreamDevice
 {
 public:
     PdfCanvasInputDevice(const PdfCanvas& canvas);
+
+    /** Decode all the content streams of the canvas at once into
+     * the given buffer, separated by newlines, and read from it
+     * \param buffer the buffer that will hold the decoded contents.
+     *        It's cleared but its capacity is kept, so it can be
+     *        reused across canvases. It must outlive the device
+     * \param parallel decode the content streams in parallel
+     */
+    PdfCanvasInputDevice(const PdfCanvas& canvas, charbuff& buffer, bool parallel = false);
 public:
     size_t GetLength() const override;
     size_t GetPosition() const override;
     bool Eof() const override { return m_eof; }
 private:
+    void collectContents(const PdfCanvas& canvas);
+    void decodeContents(charbuff& buffer, bool parallel);
     bool tryGetNextDevice(InputStreamDevice*& device);
     bool tryPopNextDevice();
     void setEOF();
@@ -6,25 +6,36 @@
 
 #include <podofo/private/PdfDeclarationsPrivate.h>
 #include "PdfCharCodeMap.h"
-#include <random>
 #include <algorithm>
+#include <mutex>
 #include <utf8cpp/utf8.h>
 
 using namespace std;
 using namespace PoDoFo;
 
+// Code units up to this value are looked up in a dense table
+static constexpr unsigned MaxDenseCodeUnit = 0xFFFF;
+// Code points up to this value are looked up in the page table
+static constexpr codepoint MaxPagedCodePoint = 0x10FFFF;
+static constexpr unsigned CodePointPageSize = 256;
+static constexpr unsigned NoPage = numeric_limits<unsigned>::max();
+
+struct PdfCharCodeMap::LigatureSequence
+{
+    const vector<codepoint>* CodePoints;
+    PdfCharCode CodeUnit;
+};
+
 PdfCharCodeMap::PdfCharCodeMap()
-    : m_MapDirty(false), m_codePointMapHead(nullptr), m_depth(0) { }
+    : m_MapDirty(false), m_codeUnitTableFirstCode(0) { }
 
 PdfCharCodeMap::PdfCharCodeMap(PdfCharCodeMap&& map) noexcept
+    : m_MapDirty(false), m_codeUnitTableFirstCode(0)
 {
     move(map);
 }
 
-PdfCharCodeMap::~PdfCharCodeMap()
-{
-    deleteNode(m_codePointMapHead);
-}
+PdfCharCodeMap::~PdfCharCodeMap() { }
 
 PdfCharCodeMap& PdfCharCodeMap::operator=(PdfCharCodeMap&& map) noexcept
 {
@@ -46,9 +57,14 @@ void PdfCharCodeMap::move(PdfCharCodeMap& map) noexcept
 {
     m_CodeUnitMap = std::move(map.m_CodeUnitMap);
     utls::move(map.m_Limits, m_Limits);
-    utls::move(map.m_MapDirty, m_MapDirty);
-    utls::move(map.m_codePointMapHead, m_codePointMapHead);
-    utls::move(map.m_depth, m_depth);
+    m_MapDirty = map.m_MapDirty.exchange(false);
+    m_codeUnitTable = std::move(map.m_codeUnitTable);
+    utls::move(map.m_codeUnitTableFirstCode, m_codeUnitTableFirstCode);
+    m_codeUnitCodePoints = std::move(map.m_codeUnitCodePoints);
+    m_codePointPageIndices = std::move(map.m_codePointPageIndices);
+    m_codePointPages = std::move(map.m_codePointPages);
+    m_codePointOverflow = std::move(map.m_codePointOverflow);
+    m_ligatureNodes = std::move(map.m_ligatureNodes);
 }
 
 void PdfCharCodeMap::PushMapping(const PdfCharCode& codeUnit, const codepointview& codePoints)
@@ -66,8 +82,66 @@ void PdfCharCodeMap::PushMapping(const PdfCharCode& codeUnit, codepoint codePoin
     pushMapping(codeUnit, std::move(codePoints));
 }
 
+void PdfCharCodeMap::PushRangeMapping(const PdfCharCode& codeUnitLo, unsigned rangeSize, const codepointview& codePointsLo)
+{
+    if (codeUnitLo.CodeSpaceSize == 0)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidHandle, "Code unit must be valid");
+
+    if (codePointsLo.size() == 0)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidHandle, "CodePoints must not be empty");
+
+    if (rangeSize == 0)
+        return;
+
+    if (rangeSize - 1 > numeric_limits<uint32_t>::max() - codeUnitLo.Code)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::ValueOutOfRange, "The range exceeds the code space");
+
+    // The code units in the range are consecutive, so the position of
+    // the next insertion is known and each insertion is constant time
+    auto hint = m_CodeUnitMap.lower_bound(codeUnitLo);
+    PdfCharCode codeUnit = codeUnitLo;
+    for (unsigned i = 0; i < rangeSize; i++)
+    {
+        vector<codepoint> codePoints(codePointsLo.begin(), codePointsLo.end());
+        codePoints.back() += i;
+        codeUnit.Code = codeUnitLo.Code + i;
+        hint = m_CodeUnitMap.insert_or_assign(hint, codeUnit, std::move(codePoints));
+        hint++;
+    }
+
+    updateLimits(codeUnitLo);
+    updateLimits(codeUnit);
+    m_MapDirty = true;
+}
+
 bool PdfCharCodeMap::TryGetCodePoints(const PdfCharCode& codeUnit, vector<codepoint>& codePoints) const
 {
+    revise();
+    if (m_codeUnitTable.size() != 0)
+    {
+        unsigned index = codeUnit.Code - m_codeUnitTableFirstCode;
+        if (codeUnit.Code < m_codeUnitTableFirstCode || index >= m_codeUnitTable.size()
+            || m_codeUnitTable[index].Length == 0)
+        {
+            codePoints.clear();
+            return false;
+        }
+
+        auto& entry = m_codeUnitTable[index];
+        if (entry.Length == 1)
+        {
+            codePoints.resize(1);
+            codePoints[0] = (codepoint)entry.Value;
+        }
+        else
+        {
+            auto begin = m_codeUnitCodePoints.begin() + entry.Value;
+            codePoints.assign(begin, begin + entry.Length);
+        }
+
+        return true;
+    }
+
     auto found = m_CodeUnitMap.find(codeUnit);
     if (found == m_CodeUnitMap.end())
     {
@@ -81,40 +155,76 @@ bool PdfCharCodeMap::TryGetCodePoints(const PdfCharCode& codeUnit, vector<codepo
 
 bool PdfCharCodeMap::TryGetNextCharCode(string_view::iterator& it, const string_view::iterator& end, PdfCharCode& code) const
 {
-    const_cast<PdfCharCodeMap&>(*this).reviseCPMap();
-    return tryFindNextCharacterId(m_codePointMapHead, it, end, code);
+    revise();
+    PODOFO_INVARIANT(it != end);
+    codepoint codePoint = (codepoint)utf8::next(it, end);
+    if (it != end && m_ligatureNodes.size() != 0)
+    {
+        // Try to find the longest ligature starting with the code point
+        auto node = findLigatureNode(m_ligatureNodes[0], codePoint);
+        if (node != nullptr)
+        {
+            const PdfCharCode* found = nullptr;
+            auto curr = it;
+            auto foundIt = it;
+            while (curr != end)
+            {
+                node = findLigatureNode(*node, (codepoint)utf8::next(curr, end));
+                if (node == nullptr)
+                    break;
+
+                if (node->CodeUnit.CodeSpaceSize != 0)
+                {
+                    found = &node->CodeUnit;
+                    foundIt = curr;
+                }
+            }
+
+            if (found != nullptr)
+            {
+                code = *found;
+                it = foundIt;
+                return true;
+            }
+        }
+    }
+
+    auto found = findCodeUnit(codePoint);
+    if (found == nullptr)
+    {
+        code = { };
+        return false;
+    }
+
+    code = *found;
+    return true;
 }
 
 bool PdfCharCodeMap::TryGetCharCode(const codepointview& codePoints, PdfCharCode& codeUnit) const
 {
-    const_cast<PdfCharCodeMap&>(*this).reviseCPMap();
-    auto it = codePoints.begin();
-    auto end = codePoints.end();
-    const CPMapNode* node = m_codePointMapHead;
-    if (it == end)
+    revise();
+    if (codePoints.size() == 1)
+        return TryGetCharCode(codePoints[0], codeUnit);
+
+    if (codePoints.size() == 0 || m_ligatureNodes.size() == 0)
         goto NotFound;
 
-    while (true)
     {
         // All the sequence must match
-        node = findNode(node, *it);
-        if (node == nullptr)
-            goto NotFound;
-
-        it++;
-        if (it == end)
-            break;
+        const LigatureNode* node = &m_ligatureNodes[0];
+        for (codepoint codePoint : codePoints)
+        {
+            node = findLigatureNode(*node, codePoint);
+            if (node == nullptr)
+                goto NotFound;
+        }
 
-        node = node->Ligatures;
-    }
+        if (node->CodeUnit.CodeSpaceSize == 0)
+        {
+            // Undefined char code
+            goto NotFound;
+        }
 
-    if (node->CodeUnit.CodeSpaceSize == 0)
-    {
-        // Undefined char code
-        goto NotFound;
-    }
-    else
-    {
         codeUnit = node->CodeUnit;
         return true;
     }
@@ -126,15 +236,15 @@ NotFound:
 
 bool PdfCharCodeMap::TryGetCharCode(codepoint codePoint, PdfCharCode& code) const
 {
-    const_cast<PdfCharCodeMap&>(*this).reviseCPMap();
-    auto node = findNode(m_codePointMapHead, codePoint);
-    if (node == nullptr)
+    revise();
+    auto found = findCodeUnit(codePoint);
+    if (found == nullptr)
     {
         code = { };
         return false;
     }
 
-    code = node->CodeUnit;
+    code = *found;
     return true;
 }
 
@@ -144,8 +254,12 @@ void PdfCharCodeMap::pushMapping(const PdfCharCode& codeUnit, vector<codepoint>&
         PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidHandle, "Code unit must be valid");
 
     m_CodeUnitMap[codeUnit] = std::move(codePoints);
+    updateLimits(codeUnit);
+    m_MapDirty = true;
+}
 
-    // Update limits
+void PdfCharCodeMap::updateLimits(const PdfCharCode& codeUnit)
+{
     if (codeUnit.CodeSpaceSize < m_Limits.MinCodeSize)
         m_Limits.MinCodeSize = codeUnit.CodeSpaceSize;
     if (codeUnit.CodeSpaceSize > m_Limits.MaxCodeSize)
@@ -154,122 +268,199 @@ void PdfCharCodeMap::pushMapping(const PdfCharCode& codeUnit, vector<codepoint>&
         m_Limits.FirstChar = codeUnit;
     if (codeUnit.Code > m_Limits.LastChar.Code)
         m_Limits.LastChar = codeUnit;
+}
 
-    m_MapDirty = true;
+void PdfCharCodeMap::revise() const
+{
+    if (!m_MapDirty.load(memory_order_acquire))
+        return;
+
+    // The tables are built once after the map is modified: lock
+    // so concurrent readers of a shared map don't race to build them
+    static mutex s_mutex;
+    unique_lock<mutex> lock(s_mutex);
+    if (!m_MapDirty.load(memory_order_relaxed))
+        return;
+
+    const_cast<PdfCharCodeMap&>(*this).buildLookupTables();
+    m_MapDirty.store(false, memory_order_release);
 }
 
-bool PdfCharCodeMap::tryFindNextCharacterId(const CPMapNode* node, string_view::iterator& it,
-    const string_view::iterator& end, PdfCharCode& codeUnit)
+void PdfCharCodeMap::buildLookupTables()
 {
-    PODOFO_INVARIANT(it != end);
-    string_view::iterator curr;
-    codepoint codePoint = (codepoint)utf8::next(it, end);
-    node = findNode(node, codePoint);
-    if (node == nullptr)
-        goto NotFound;
+    buildCodeUnitTable();
+    buildCodePointTable();
+}
 
-    if (it != end)
+void PdfCharCodeMap::buildCodeUnitTable()
+{
+    m_codeUnitTable.clear();
+    m_codeUnitCodePoints.clear();
+    m_codeUnitTableFirstCode = 0;
+    if (m_CodeUnitMap.size() == 0)
+        return;
+
+    unsigned firstCode = m_CodeUnitMap.begin()->first.Code;
+    unsigned lastCode = m_CodeUnitMap.rbegin()->first.Code;
+    if (lastCode > MaxDenseCodeUnit)
     {
-        // Try to find ligatures, save a temporary iterator
-        // in case the search in unsuccessful
-        curr = it;
-        if (tryFindNextCharacterId(node->Ligatures, curr, end, codeUnit))
-        {
-            it = curr;
-            return true;
-        }
+        // Wider code units are looked up in the map
+        return;
     }
 
-    if (node->CodeUnit.CodeSpaceSize == 0)
+    m_codeUnitTableFirstCode = firstCode;
+    m_codeUnitTable.assign(lastCode - firstCode + 1, { 0, 0 });
+    for (auto& pair : m_CodeUnitMap)
     {
-        // Undefined char code
-        goto NotFound;
+        auto& entry = m_codeUnitTable[pair.first.Code - firstCode];
+        entry.Length = (uint32_t)pair.second.size();
+        if (entry.Length == 1)
+        {
+            entry.Value = (uint32_t)pair.second[0];
+        }
+        else
+        {
+            entry.Value = (uint32_t)m_codeUnitCodePoints.size();
+            m_codeUnitCodePoints.insert(m_codeUnitCodePoints.end(), pair.second.begin(), pair.second.end());
+        }
     }
-    else
+}
+
+void PdfCharCodeMap::buildCodePointTable()
+{
+    m_codePointPageIndices.clear();
+    m_codePointPages.clear();
+    m_codePointOverflow.clear();
+    m_ligatureNodes.clear();
+
+    // NOTE: When more code units map the same code points, the
+    // lowest code unit is used, as the map is iterated in order
+    vector<LigatureSequence> ligatures;
+    for (auto& pair : m_CodeUnitMap)
     {
-        codeUnit = node->CodeUnit;
-        return true;
+        auto& codePoints = pair.second;
+        if (codePoints.size() != 1)
+        {
+            ligatures.push_back({ &codePoints, pair.first });
+            continue;
+        }
+
+        codepoint codePoint = codePoints[0];
+        if (codePoint > MaxPagedCodePoint)
+        {
+            (void)m_codePointOverflow.insert({ codePoint, pair.first });
+            continue;
+        }
+
+        unsigned pageIndex = codePoint / CodePointPageSize;
+        if (pageIndex >= m_codePointPageIndices.size())
+            m_codePointPageIndices.resize(pageIndex + 1, NoPage);
+
+        unsigned& page = m_codePointPageIndices[pageIndex];
+        if (page == NoPage)
+        {
+            page = (unsigned)(m_codePointPages.size() / CodePointPageSize);
+            m_codePointPages.resize(m_codePointPages.size() + CodePointPageSize);
+        }
+
+        auto& codeUnit = m_codePointPages[page * CodePointPageSize + codePoint % CodePointPageSize];
+        if (codeUnit.CodeSpaceSize == 0)
+            codeUnit = pair.first;
     }
 
-NotFound:
-    codeUnit = { };
-    return false;
-}
+    if (ligatures.size() == 0)
+        return;
 
-const PdfCharCodeMap::CPMapNode* PdfCharCodeMap::findNode(const CPMapNode* node, codepoint codePoint)
-{
-    if (node == nullptr)
-        return nullptr;
+    // Sort the sequences so they can be grouped by common prefixes.
+    // The sort is stable to preserve the code units order
+    std::stable_sort(ligatures.begin(), ligatures.end(),
+        [](const LigatureSequence& lhs, const LigatureSequence& rhs) {
+            return std::lexicographical_compare(lhs.CodePoints->begin(), lhs.CodePoints->end(),
+                rhs.CodePoints->begin(), rhs.CodePoints->end());
+        });
 
-    if (node->CodePoint == codePoint)
-        return node;
-    else if (node->CodePoint > codePoint)
-        return findNode(node->Left, codePoint);
-    else
-        return findNode(node->Right, codePoint);
+    m_ligatureNodes.push_back({ });
+    buildLigatureNodes(ligatures, 0, ligatures.size(), 0, 0);
 }
 
-void PdfCharCodeMap::reviseCPMap()
+// Build the children of the trie node from the sequences in the
+// [begin, end) range, that share the first "depth" code points
+void PdfCharCodeMap::buildLigatureNodes(const vector<LigatureSequence>& sequences,
+    size_t begin, size_t end, unsigned depth, unsigned nodeIndex)
 {
-    if (!m_MapDirty)
-        return;
-
-    if (m_codePointMapHead != nullptr)
+    // The sequences ending at this depth define the code unit of the node
+    size_t i = begin;
+    for (; i < end && sequences[i].CodePoints->size() == depth; i++)
     {
-        deleteNode(m_codePointMapHead);
-        m_codePointMapHead = nullptr;
+        auto& codeUnit = m_ligatureNodes[nodeIndex].CodeUnit;
+        if (codeUnit.CodeSpaceSize == 0)
+            codeUnit = sequences[i].CodeUnit;
     }
 
-    // Randomize items in the map in a separate list
-    // so BST creation will be more balanced
-    // https://en.wikipedia.org/wiki/Random_binary_tree
-    // TODO: Create a perfectly balanced BST
-    vector<pair<PdfCharCode, vector<codepoint>>> pairs;
-    pairs.reserve(m_CodeUnitMap.size());
-    std::copy(m_CodeUnitMap.begin(), m_CodeUnitMap.end(), std::back_inserter(pairs));
-    std::mt19937 e(random_device{}());
-    std::shuffle(pairs.begin(), pairs.end(), e);
-
-    for (auto& pair : pairs)
+    unsigned childCount = 0;
+    for (size_t j = i; j < end; childCount++)
     {
-        CPMapNode** curr = &m_codePointMapHead;      // Node root being searched
-        CPMapNode* found;                     // Last found node
-        auto it = pair.second.begin();
-        auto end = pair.second.end();
-        PODOFO_INVARIANT(it != end);
-        while (true)
+        codepoint codePoint = (*sequences[j].CodePoints)[depth];
+        do
         {
-            found = findOrAddNode(*curr, *it);
-            it++;
-            if (it == end)
-                break;
+            j++;
+        } while (j < end && (*sequences[j].CodePoints)[depth] == codePoint);
+    }
 
-            // We add subsequent codepoints to ligatures
-            curr = &found->Ligatures;
-        }
+    if (childCount == 0)
+        return;
 
-        // Finally set the char code on the last found/added node
-        found->CodeUnit = pair.first;
-    }
+    unsigned firstChild = (unsigned)m_ligatureNodes.size();
+    m_ligatureNodes.resize(m_ligatureNodes.size() + childCount);
+    m_ligatureNodes[nodeIndex].FirstChild = firstChild;
+    m_ligatureNodes[nodeIndex].ChildCount = childCount;
+    unsigned child = firstChild;
+    for (size_t j = i; j < end; child++)
+    {
+        size_t groupBegin = j;
+        codepoint codePoint = (*sequences[j].CodePoints)[depth];
+        do
+        {
+            j++;
+        } while (j < end && (*sequences[j].CodePoints)[depth] == codePoint);
 
-    m_MapDirty = false;
+        m_ligatureNodes[child].CodePoint = codePoint;
+        buildLigatureNodes(sequences, groupBegin, j, depth + 1, child);
+    }
 }
 
-PdfCharCodeMap::CPMapNode* PdfCharCodeMap::findOrAddNode(CPMapNode*& node, codepoint codePoint)
+const PdfCharCode* PdfCharCodeMap::findCodeUnit(codepoint codePoint) const
 {
-    if (node == nullptr)
+    unsigned pageIndex = codePoint / CodePointPageSize;
+    if (pageIndex < m_codePointPageIndices.size())
     {
-        node = new CPMapNode{ };
-        node->CodePoint = codePoint;
-        return node;
+        unsigned page = m_codePointPageIndices[pageIndex];
+        if (page == NoPage)
+            return nullptr;
+
+        auto& codeUnit = m_codePointPages[page * CodePointPageSize + codePoint % CodePointPageSize];
+        return codeUnit.CodeSpaceSize == 0 ? nullptr : &codeUnit;
     }
 
-    if (node->CodePoint == codePoint)
-        return node;
-    else if (node->CodePoint > codePoint)
-        return findOrAddNode(node->Left, codePoint);
-    else
-        return findOrAddNode(node->Right, codePoint);
+    if (m_codePointOverflow.size() == 0)
+        return nullptr;
+
+    auto found = m_codePointOverflow.find(codePoint);
+    return found == m_codePointOverflow.end() ? nullptr : &found->second;
+}
+
+const PdfCharCodeMap::LigatureNode* PdfCharCodeMap::findLigatureNode(const LigatureNode& node, codepoint codePoint) const
+{
+    auto begin = m_ligatureNodes.begin() + node.FirstChild;
+    auto end = begin + node.ChildCount;
+    auto found = std::lower_bound(begin, end, codePoint,
+        [](const LigatureNode& child, codepoint codePoint) {
+            return child.CodePoint < codePoint;
+        });
+    if (found == end || found->CodePoint != codePoint)
+        return nullptr;
+
+    return &*found;
 }
 
 PdfCharCodeMap::iterator PdfCharCodeMap::begin() const
@@ -281,14 +472,3 @@ PdfCharCodeMap::iterator PdfCharCodeMap::end() const
 {
     return m_CodeUnitMap.end();
 }
-
-void PdfCharCodeMap::deleteNode(CPMapNode* node)
-{
-    if (node == nullptr)
-        return;
-
-    deleteNode(node->Ligatures);
-    deleteNode(node->Left);
-    deleteNode(node->Right);
-    delete node;
-}
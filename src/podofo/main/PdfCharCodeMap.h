@@ -10,6 +10,8 @@
 #include "PdfDeclarations.h"
 #include "PdfEncodingCommon.h"
 
+#include <atomic>
+
 namespace PoDoFo
 {
     /** A convenient typedef for an unspecified codepoint
@@ -31,6 +33,8 @@ namespace PoDoFo
      */
     class PODOFO_API PdfCharCodeMap final
     {
+        friend class PdfEncodingMapFactory;
+
     public:
         PdfCharCodeMap();
 
@@ -47,6 +51,16 @@ namespace PoDoFo
          */
         void PushMapping(const PdfCharCode& codeUnit, codepoint codePoint);
 
+        /** Push a range of mappings, as found in CMap "bfrange" and "cidrange"
+         * sections. The code units in the range are mapped to the given
+         * code points with the last code point incremented by the offset
+         * of the code unit in the range
+         * \param codeUnitLo the first code unit of the range
+         * \param rangeSize the number of code units in the range
+         * \param codePointsLo the code points mapped by the first code unit
+         */
+        void PushRangeMapping(const PdfCharCode& codeUnitLo, unsigned rangeSize, const codepointview& codePointsLo);
+
         /** Returns false when no mapped identifiers are not found in the map
          */
         bool TryGetCodePoints(const PdfCharCode& codeUnit, std::vector<codepoint>& codePoints) const;
@@ -76,28 +90,42 @@ namespace PoDoFo
     private:
         void move(PdfCharCodeMap& map) noexcept;
         void pushMapping(const PdfCharCode& codeUnit, std::vector<codepoint>&& codePoints);
+        void updateLimits(const PdfCharCode& codeUnit);
 
-        // Map code point(s) -> code units
-        struct CPMapNode
+        // Dense code unit -> code point(s) entry. A single code point
+        // is stored inline, otherwise Value is the offset of the
+        // code points in m_codeUnitCodePoints
+        struct CodeUnitEntry
+        {
+            uint32_t Value;
+            uint32_t Length;        // 0 when the code unit is not mapped
+        };
+
+        // Node of a trie of code point sequences, used for ligatures.
+        // The children of a node are contiguous and sorted
+        struct LigatureNode
         {
             codepoint CodePoint;
             PdfCharCode CodeUnit;
-            CPMapNode* Ligatures;
-            CPMapNode* Left;
-            CPMapNode* Right;
+            unsigned FirstChild;
+            unsigned ChildCount;
         };
 
+        struct LigatureSequence;
+
     private:
         PdfCharCodeMap(const PdfCharCodeMap&) = delete;
         PdfCharCodeMap& operator=(const PdfCharCodeMap&) = delete;
 
     private:
-        void reviseCPMap();
-        static bool tryFindNextCharacterId(const CPMapNode* node, std::string_view::iterator &it,
-            const std::string_view::iterator& end, PdfCharCode& cid);
-        static const CPMapNode* findNode(const CPMapNode* node, codepoint codePoint);
-        static void deleteNode(CPMapNode* node);
-        static CPMapNode* findOrAddNode(CPMapNode*& node, codepoint codePoint);
+        void revise() const;
+        void buildLookupTables();
+        void buildCodeUnitTable();
+        void buildCodePointTable();
+        void buildLigatureNodes(const std::vector<LigatureSequence>& sequences,
+            size_t begin, size_t end, unsigned depth, unsigned nodeIndex);
+        const PdfCharCode* findCodeUnit(codepoint codePoint) const;
+        const LigatureNode* findLigatureNode(const LigatureNode& node, codepoint codePoint) const;
 
     public:
         // Map code units -> code point(s)
@@ -112,9 +140,22 @@ namespace PoDoFo
     private:
         PdfEncodingLimits m_Limits;
         CodeUnitMap m_CodeUnitMap;
-        bool m_MapDirty;
-        CPMapNode* m_codePointMapHead;           // Head of a BST to lookup code points
-        int m_depth;
+        // The lookup tables are built lazily, once
+        // the map is not modified anymore
+        mutable std::atomic<bool> m_MapDirty;
+
+        // Dense table of the code units, when they fit 2 bytes
+        std::vector<CodeUnitEntry> m_codeUnitTable;
+        unsigned m_codeUnitTableFirstCode;
+        std::vector<codepoint> m_codeUnitCodePoints;
+
+        // Two level page table to lookup single code points
+        std::vector<unsigned> m_codePointPageIndices;
+        std::vector<PdfCharCode> m_codePointPages;
+        std::unordered_map<codepoint, PdfCharCode> m_codePointOverflow;
+
+        // Trie of the code point sequences of the ligatures
+        std::vector<LigatureNode> m_ligatureNodes;
     };
 }
 
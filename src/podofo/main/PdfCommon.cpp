@@ -23,6 +23,7 @@ PODOFO_EXPORT LogMessageCallback s_LogMessageCallback;
 PODOFO_EXPORT ssl::OpenSSLMain s_SSL;
 
 static unsigned s_MaxObjectCount = (1U << 23) - 1;
+static atomic<bool> s_SimdEnabled(true);
 
 void ssl::Init()
 {
@@ -70,3 +71,13 @@ void PdfCommon::SetMaxObjectCount(unsigned maxObjectCount)
 {
     s_MaxObjectCount = maxObjectCount;
 }
+
+void PdfCommon::SetSimdEnabled(bool enabled)
+{
+    s_SimdEnabled.store(enabled, memory_order_relaxed);
+}
+
+bool PdfCommon::IsSimdEnabled()
+{
+    return s_SimdEnabled.load(memory_order_relaxed);
+}
@@ -39,6 +39,13 @@ public:
 
     static unsigned GetMaxObjectCount();
     static void SetMaxObjectCount(unsigned maxObjectCount);
+
+    /** Enable or disable the vectorized (SIMD) code paths, such as
+     * the image pixel format conversions. They are enabled by default
+     * and used only when supported by the CPU
+     */
+    static void SetSimdEnabled(bool enabled);
+    static bool IsSimdEnabled();
 };
 
 }
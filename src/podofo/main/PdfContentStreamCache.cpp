@@ -0,0 +1,75 @@
+/**
+ * SPDX-FileCopyrightText: (C) 2022 Francesco Pretto <ceztko@gmail.com>
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ * SPDX-License-Identifier: MPL-2.0
+ */
+
+#include <podofo/private/PdfDeclarationsPrivate.h>
+#include "PdfContentStreamCache.h"
+
+#include "PdfObject.h"
+
+using namespace std;
+using namespace PoDoFo;
+
+PdfContentStreamCache::PdfContentStreamCache(size_t maxSize) :
+    m_maxSize(maxSize),
+    m_size(0)
+{
+}
+
+void PdfContentStreamCache::Clear()
+{
+    m_map.clear();
+    m_contents.clear();
+    m_size = 0;
+}
+
+unsigned PdfContentStreamCache::GetCount() const
+{
+    return (unsigned)m_contents.size();
+}
+
+PdfContentStreamCache::ContentsPtr PdfContentStreamCache::find(const PdfObject& form)
+{
+    auto found = m_map.find(&form);
+    if (found == m_map.end())
+        return nullptr;
+
+    auto entry = found->second;
+    if (entry->Reference != form.GetIndirectReference())
+    {
+        // The memory of a removed form was reused by another object
+        m_size -= entry->Contents->Size;
+        m_contents.erase(entry);
+        m_map.erase(found);
+        return nullptr;
+    }
+
+    // Move the contents to the front of the list, as the most recently used
+    m_contents.splice(m_contents.begin(), m_contents, entry);
+    return entry->Contents;
+}
+
+void PdfContentStreamCache::add(const PdfObject& form, const ContentsPtr& contents)
+{
+    if (contents->Size > m_maxSize)
+    {
+        // The contents can't fit in the cache
+        return;
+    }
+
+    PODOFO_ASSERT(m_map.find(&form) == m_map.end());
+    m_contents.push_front({ &form, form.GetIndirectReference(), contents });
+    m_map[&form] = m_contents.begin();
+    m_size += contents->Size;
+
+    // Evict least recently used contents
+    while (m_size > m_maxSize)
+    {
+        auto& last = m_contents.back();
+        m_size -= last.Contents->Size;
+        m_map.erase(last.Form);
+        m_contents.pop_back();
+    }
+}
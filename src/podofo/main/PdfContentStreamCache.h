@@ -0,0 +1,118 @@
+/**
+ * SPDX-FileCopyrightText: (C) 2022 Francesco Pretto <ceztko@gmail.com>
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ * SPDX-License-Identifier: MPL-2.0
+ */
+
+#ifndef PDF_CONTENT_STREAM_CACHE_H
+#define PDF_CONTENT_STREAM_CACHE_H
+
+#include "PdfDeclarations.h"
+
+#include <list>
+#include <unordered_map>
+
+#include "PdfReference.h"
+#include "PdfVariant.h"
+#include "PdfDictionary.h"
+#include "PdfContentStreamOperators.h"
+
+namespace PoDoFo {
+
+class PdfObject;
+enum class PdfContentType;
+enum class PdfContentWarnings;
+
+/** A cache of pre-tokenized XObject form contents, to be shared
+ * by content stream readers of the same document. Forms that are
+ * placed on many pages are then decoded and tokenized only once
+ * \remarks Forms are identified by their object and indirect reference,
+ * and the cached entries are never invalidated: the cache must be cleared
+ * with Clear() after any modification of the document, such as a form
+ * stream changed with SetData() or removed objects, whose memory may be
+ * reused by new ones. The cache is not thread safe
+ * \see PdfContentReaderArgs
+ */
+class PODOFO_API PdfContentStreamCache final
+{
+    friend class PdfContentStreamReader;
+
+public:
+    static constexpr size_t DefaultMaxSize = 64 * 1024 * 1024;
+
+public:
+    /**
+     * \param maxSize approximate maximum memory size of the
+     *        cached contents. Least recently used forms are evicted
+     *        when it's exceeded
+     */
+    PdfContentStreamCache(size_t maxSize = DefaultMaxSize);
+
+public:
+    void Clear();
+
+    /** Get the number of cached forms
+     */
+    unsigned GetCount() const;
+
+    /** Get the approximate memory size of the cached contents
+     */
+    size_t GetSize() const { return m_size; }
+
+    size_t GetMaxSize() const { return m_maxSize; }
+
+private:
+    struct Item
+    {
+        PdfContentType Type;
+        PdfContentWarnings Warnings;
+        PdfOperator Operator;
+        unsigned OperandIndex;
+        unsigned OperandCount;
+        // Index of the keyword for unexpected keywords, of
+        // the dictionary or data for inline images
+        unsigned DataIndex;
+    };
+
+    struct Contents
+    {
+        std::vector<Item> Items;
+        std::vector<PdfVariant> Operands;
+        std::vector<std::string> Keywords;
+        std::vector<PdfDictionary> ImageDictionaries;
+        std::vector<charbuff> ImageData;
+        // Operands left on the stack at the end of the form
+        std::vector<PdfVariant> TrailingOperands;
+        size_t Size = 0;
+    };
+
+    using ContentsPtr = std::shared_ptr<const Contents>;
+
+    struct Entry
+    {
+        const PdfObject* Form;
+        PdfReference Reference;
+        ContentsPtr Contents;
+    };
+
+    using ContentsList = std::list<Entry>;
+
+private:
+    ContentsPtr find(const PdfObject& form);
+    void add(const PdfObject& form, const ContentsPtr& contents);
+
+private:
+    PdfContentStreamCache(const PdfContentStreamCache&) = delete;
+    PdfContentStreamCache& operator=(const PdfContentStreamCache&) = delete;
+
+private:
+    size_t m_maxSize;
+    size_t m_size;
+    // Most recently used contents are in the front
+    ContentsList m_contents;
+    std::unordered_map<const PdfObject*, ContentsList::iterator> m_map;
+};
+
+}
+
+#endif // PDF_CONTENT_STREAM_CACHE_H
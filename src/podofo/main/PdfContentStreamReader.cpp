@@ -16,10 +16,12 @@
 using namespace std;
 using namespace PoDoFo;
 
+static size_t estimateSize(const PdfVariant& variant);
+static size_t estimateSize(const PdfDictionary& dict);
+
 PdfContentStreamReader::PdfContentStreamReader(const PdfCanvas& canvas,
         nullable<const PdfContentReaderArgs&> args) :
-    PdfContentStreamReader(std::make_shared<PdfCanvasInputDevice>(canvas),
-        &canvas, args) { }
+    PdfContentStreamReader(nullptr, &canvas, args) { }
 
 PdfContentStreamReader::PdfContentStreamReader(const shared_ptr<InputStreamDevice>& device,
         nullable<const PdfContentReaderArgs&> args) :
@@ -33,13 +35,31 @@ PdfContentStreamReader::PdfContentStreamReader(const shared_ptr<InputStreamDevic
     m_readingInlineImgData(false),
     m_temp{ }
 {
-    if (device == nullptr)
-        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidHandle, "Device must be non null");
+    if (canvas == nullptr)
+    {
+        if (device == nullptr)
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidHandle, "Device must be non null");
 
-    m_inputs.push_back({ nullptr, device, canvas });
+        m_inputs.push_back({ nullptr, device, nullptr, nullptr, 0 });
+    }
+    else
+    {
+        m_inputs.push_back({ nullptr, createCanvasDevice(*canvas), canvas, nullptr, 0 });
+    }
 }
 
 bool PdfContentStreamReader::TryReadNext(PdfContent& content)
+{
+    return tryReadNext(content);
+}
+
+bool PdfContentStreamReader::TryReadNext(PdfContentView& content)
+{
+    return tryReadNext(content);
+}
+
+template <typename TContent>
+bool PdfContentStreamReader::tryReadNext(TContent& content)
 {
     beforeReadReset(content);
 
@@ -48,13 +68,23 @@ bool PdfContentStreamReader::TryReadNext(PdfContent& content)
         if (m_inputs.size() == 0)
             goto Eof;
 
+        if (m_inputs.back().Contents != nullptr)
+        {
+            if (!tryReplayContent(content))
+                goto PopDevice;
+
+            goto HandleContent;
+        }
+
         if (m_readingInlineImgData)
         {
             if (m_args.InlineImageHandler == nullptr)
             {
-                if (!tryReadInlineImgData(content.InlineImageData))
+                bufferview data;
+                if (!tryReadInlineImgData(data))
                     goto PopDevice;
 
+                content.InlineImageData = data;
                 content.Type = PdfContentType::ImageData;
                 m_readingInlineImgData = false;
                 afterReadClear(content);
@@ -99,7 +129,7 @@ bool PdfContentStreamReader::TryReadNext(PdfContent& content)
         // Unless the device stack is empty, popping a devices
         // means that we finished processing an XObject form
         content.Type = PdfContentType::EndXObjectForm;
-        if (content.Stack.GetSize() != 0)
+        if (getOperandCount(content) != 0)
             content.Warnings |= PdfContentWarnings::SpuriousStackContent;
 
         goto HandleContent;
@@ -127,35 +157,76 @@ bool PdfContentStreamReader::tryReadNextContent(PdfContent& content)
         {
             case PdfPostScriptTokenType::Keyword:
             {
-                if (!TryGetPdfOperator(content.Keyword, content.Operator))
-                {
-                    content.Type = PdfContentType::UnexpectedKeyword;
-                    return true;
-                }
+                return tryHandleKeyword(content);
+            }
+            case PdfPostScriptTokenType::Variant:
+            {
+                content.Stack.Push(std::move(m_temp.Variant));
+                continue;
+            }
+            case PdfPostScriptTokenType::ProcedureEnter:
+            case PdfPostScriptTokenType::ProcedureExit:
+            {
+                content.Type = PdfContentType::UnexpectedKeyword;
+                return true;
+            }
+            default:
+            {
+                PODOFO_RAISE_ERROR(PdfErrorCode::InvalidEnumValue);
+            }
+        }
+    }
+}
 
-                content.Type = PdfContentType::Operator;
-                int operandCount = PoDoFo::GetOperandCount(content.Operator);
-                if (operandCount != -1 && content.Stack.GetSize() != (unsigned)operandCount)
-                {
-                    if (content.Stack.GetSize() < (unsigned)operandCount)
-                        content.Warnings |= PdfContentWarnings::InvalidOperator;
-                    else // Stack.GetSize() > operandCount
-                        content.Warnings |= PdfContentWarnings::SpuriousStackContent;
-                }
+// Returns false in case of EOF
+bool PdfContentStreamReader::tryReadNextContent(PdfContentView& content)
+{
+    while (true)
+    {
+        bool gotToken = m_tokenizer.TryReadNextOperand(*m_inputs.back().Device, m_temp.PsType,
+            content.Keyword, m_temp.Operand, m_views.Buffer, m_temp.Variant);
+        if (!gotToken)
+        {
+            if (m_views.ArrayStarts.size() != 0)
+                PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnexpectedEOF, "Expected array item or ] delim");
 
-                if (!tryHandleOperator(content))
-                    return false;
+            content.Type = PdfContentType::Unknown;
+            return false;
+        }
 
-                return true;
+        switch (m_temp.PsType)
+        {
+            case PdfPostScriptTokenType::Keyword:
+            {
+                if (m_views.ArrayStarts.size() != 0)
+                    PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidDataType, "Could not read a variant");
+
+                return tryHandleKeyword(content);
             }
             case PdfPostScriptTokenType::Variant:
             {
-                content.Stack.Push(std::move(m_temp.Variant));
+                pushOperand(m_temp.Operand);
+                continue;
+            }
+            case PdfPostScriptTokenType::ArrayEnter:
+            {
+                m_views.ArrayStarts.push_back(m_views.Stack.size());
+                continue;
+            }
+            case PdfPostScriptTokenType::ArrayExit:
+            {
+                if (m_views.ArrayStarts.size() == 0)
+                    PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidEnumValue, "Unsupported token at this context");
+
+                popArray();
                 continue;
             }
             case PdfPostScriptTokenType::ProcedureEnter:
             case PdfPostScriptTokenType::ProcedureExit:
             {
+                if (m_views.ArrayStarts.size() != 0)
+                    PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidEnumValue, "Unsupported token at this context");
+
                 content.Type = PdfContentType::UnexpectedKeyword;
                 return true;
             }
@@ -167,12 +238,49 @@ bool PdfContentStreamReader::tryReadNextContent(PdfContent& content)
     }
 }
 
+// Returns false in case of EOF
+template <typename TContent>
+bool PdfContentStreamReader::tryHandleKeyword(TContent& content)
+{
+    int operandCount;
+    if (!TryGetPdfOperator(content.Keyword, content.Operator, operandCount))
+    {
+        content.Type = PdfContentType::UnexpectedKeyword;
+        return true;
+    }
+
+    content.Type = PdfContentType::Operator;
+    unsigned stackSize = getOperandCount(content);
+    if (operandCount != -1 && stackSize != (unsigned)operandCount)
+    {
+        if (stackSize < (unsigned)operandCount)
+            content.Warnings |= PdfContentWarnings::InvalidOperator;
+        else // stackSize > operandCount
+            content.Warnings |= PdfContentWarnings::SpuriousStackContent;
+    }
+
+    if (!tryHandleOperator(content))
+        return false;
+
+    return true;
+}
+
 void PdfContentStreamReader::beforeReadReset(PdfContent& content)
 {
     content.Stack.Clear();
     content.Warnings = PdfContentWarnings::None;
 }
 
+void PdfContentStreamReader::beforeReadReset(PdfContentView& content)
+{
+    m_views.Stack.clear();
+    m_views.Items.clear();
+    m_views.ArrayStarts.clear();
+    m_views.Variants.clear();
+    m_views.Buffer.clear();
+    content.Warnings = PdfContentWarnings::None;
+}
+
 void PdfContentStreamReader::afterReadClear(PdfContent& content)
 {
     // Do some cleaning
@@ -240,8 +348,73 @@ void PdfContentStreamReader::afterReadClear(PdfContent& content)
     }
 }
 
+void PdfContentStreamReader::afterReadClear(PdfContentView& content)
+{
+    updateOperandViews(content);
+
+    // Do some cleaning
+    switch (content.Type)
+    {
+        case PdfContentType::Operator:
+        {
+            content.InlineImageDictionary.Clear();
+            content.InlineImageData = { };
+            content.XObject = nullptr;
+            break;
+        }
+        case PdfContentType::ImageDictionary:
+        {
+            content.Operator = PdfOperator::Unknown;
+            content.Keyword = string_view();
+            content.InlineImageData = { };
+            content.XObject = nullptr;
+            break;
+        }
+        case PdfContentType::ImageData:
+        {
+            content.Operator = PdfOperator::Unknown;
+            content.Keyword = string_view();
+            content.InlineImageDictionary.Clear();
+            content.XObject = nullptr;
+            break;
+        }
+        case PdfContentType::DoXObject:
+        {
+            content.Operator = PdfOperator::Unknown;
+            content.Keyword = string_view();
+            content.InlineImageDictionary.Clear();
+            content.InlineImageData = { };
+            break;
+        }
+        case PdfContentType::UnexpectedKeyword:
+        {
+            content.Operator = PdfOperator::Unknown;
+            content.InlineImageDictionary.Clear();
+            content.InlineImageData = { };
+            content.XObject = nullptr;
+            break;
+        }
+        case PdfContentType::Unknown:
+        case PdfContentType::EndXObjectForm:
+        {
+            // Used when it is reached the EOF
+            content.Operator = PdfOperator::Unknown;
+            content.Keyword = string_view();
+            content.InlineImageDictionary.Clear();
+            content.InlineImageData = { };
+            content.XObject = nullptr;
+            break;
+        }
+        default:
+        {
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InternalLogic, "Unsupported flow");
+        }
+    }
+}
+
 // Returns false in case of EOF
-bool PdfContentStreamReader::tryHandleOperator(PdfContent& content)
+template <typename TContent>
+bool PdfContentStreamReader::tryHandleOperator(TContent& content)
 {
     // By default it's not handled
     switch (content.Operator)
@@ -259,7 +432,7 @@ bool PdfContentStreamReader::tryHandleOperator(PdfContent& content)
         }
         case PdfOperator::BI:
         {
-            if (!tryReadInlineImgDict(content))
+            if (!tryReadInlineImgDict(content.InlineImageDictionary, content.Warnings))
                 return false;
 
             content.Type = PdfContentType::ImageDictionary;
@@ -275,7 +448,7 @@ bool PdfContentStreamReader::tryHandleOperator(PdfContent& content)
 }
 
 // Returns false in case of EOF
-bool PdfContentStreamReader::tryReadInlineImgDict(PdfContent& content)
+bool PdfContentStreamReader::tryReadInlineImgDict(PdfDictionary& dict, PdfContentWarnings& warnings)
 {
     while (true)
     {
@@ -290,7 +463,7 @@ bool PdfContentStreamReader::tryReadInlineImgDict(PdfContent& content)
                 if (m_temp.Keyword == "ID")
                     return true;
 
-                content.Warnings |= PdfContentWarnings::InvalidImageDictionaryContent;
+                warnings |= PdfContentWarnings::InvalidImageDictionaryContent;
                 continue;
             }
             case PdfPostScriptTokenType::Variant:
@@ -298,34 +471,35 @@ bool PdfContentStreamReader::tryReadInlineImgDict(PdfContent& content)
                 if (m_temp.Variant.TryGetName(m_temp.Name))
                     break;
 
-                content.Warnings |= PdfContentWarnings::InvalidImageDictionaryContent;
+                warnings |= PdfContentWarnings::InvalidImageDictionaryContent;
                 continue;
             }
             default:
             {
-                content.Warnings |= PdfContentWarnings::InvalidImageDictionaryContent;
+                warnings |= PdfContentWarnings::InvalidImageDictionaryContent;
                 continue;
             }
         }
 
         if (m_tokenizer.TryReadNextVariant(*m_inputs.back().Device, m_temp.Variant))
-            content.InlineImageDictionary.AddKey(m_temp.Name, std::move(m_temp.Variant));
+            dict.AddKey(m_temp.Name, std::move(m_temp.Variant));
         else
             return false;
     }
 }
 
 // Returns false in case of errors
-void PdfContentStreamReader::tryFollowXObject(PdfContent& content)
+template <typename TContent>
+void PdfContentStreamReader::tryFollowXObject(TContent& content)
 {
     PODOFO_ASSERT(m_inputs.back().Canvas != nullptr);
     const PdfResources* resources;
     const PdfObject* xobjraw = nullptr;
     unique_ptr<PdfXObject> xobj;
-    if (content.Stack.GetSize() != 1
-        || !content.Stack[0].TryGetName(content.Name)
+    string_view name;
+    if (!tryGetXObjectName(content, name)
         || (resources = m_inputs.back().Canvas->GetResources()) == nullptr
-        || (xobjraw = resources->GetResource(PdfResourceType::XObject, *content.Name)) == nullptr
+        || (xobjraw = resources->GetResource(PdfResourceType::XObject, name)) == nullptr
         || !PdfXObject::TryCreateFromObject(const_cast<PdfObject&>(*xobjraw), xobj))
     {
         content.Warnings |= PdfContentWarnings::InvalidXObject;
@@ -344,15 +518,275 @@ void PdfContentStreamReader::tryFollowXObject(PdfContent& content)
     if (content.XObject->GetType() == PdfXObjectType::Form
         && (m_args.Flags & PdfContentReaderFlags::DontFollowXObjectForms) == PdfContentReaderFlags::None)
     {
-        m_inputs.push_back({
-            content.XObject,
-            std::make_shared<PdfCanvasInputDevice>(static_cast<const PdfXObjectForm&>(*content.XObject)),
-            dynamic_cast<const PdfCanvas*>(content.XObject.get()) });
+        auto& form = static_cast<const PdfXObjectForm&>(*content.XObject);
+        auto contents = getCachedContents(content, form);
+        if (contents == nullptr)
+            m_inputs.push_back({ content.XObject, createCanvasDevice(form), &form, nullptr, 0 });
+        else
+            m_inputs.push_back({ content.XObject, nullptr, &form, contents, 0 });
+    }
+}
+
+// Returns false when the cached contents are finished
+bool PdfContentStreamReader::tryReplayContent(PdfContent& content)
+{
+    auto& input = m_inputs.back();
+    auto& contents = *input.Contents;
+    if (input.ContentIndex == contents.Items.size())
+    {
+        content.Stack.m_variants = contents.TrailingOperands;
+        return false;
+    }
+
+    auto& item = contents.Items[input.ContentIndex];
+    input.ContentIndex++;
+    content.Type = item.Type;
+    content.Warnings = item.Warnings;
+    content.Operator = item.Operator;
+    content.Stack.m_variants.assign(contents.Operands.begin() + item.OperandIndex,
+        contents.Operands.begin() + item.OperandIndex + item.OperandCount);
+    switch (item.Type)
+    {
+        case PdfContentType::Operator:
+        {
+            (void)TryGetPdfOperatorName(item.Operator, content.Keyword);
+
+            // Follow XObjects, that may be cached as well
+            if (item.Operator == PdfOperator::Do)
+                (void)tryHandleOperator(content);
+
+            break;
+        }
+        case PdfContentType::UnexpectedKeyword:
+        {
+            content.Keyword = contents.Keywords[item.DataIndex];
+            break;
+        }
+        case PdfContentType::ImageDictionary:
+        {
+            content.Keyword = { };
+            content.InlineImageDictionary = contents.ImageDictionaries[item.DataIndex];
+            break;
+        }
+        case PdfContentType::ImageData:
+        {
+            content.Keyword = { };
+            content.InlineImageData = contents.ImageData[item.DataIndex];
+            break;
+        }
+        default:
+        {
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InternalLogic, "Unsupported flow");
+        }
+    }
+
+    return true;
+}
+
+bool PdfContentStreamReader::tryReplayContent(PdfContentView& content)
+{
+    (void)content;
+    // Cached contents are never used when reading views
+    PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InternalLogic, "Can't read views while replaying cached contents");
+}
+
+PdfContentStreamCache::ContentsPtr PdfContentStreamReader::getCachedContents(const PdfContent& content, const PdfXObjectForm& form)
+{
+    (void)content;
+    if (m_args.Cache == nullptr || m_args.InlineImageHandler != nullptr)
+        return nullptr;
+
+    auto ret = m_args.Cache->find(form.GetObject());
+    if (ret == nullptr)
+    {
+        ret = createCachedContents(form);
+        m_args.Cache->add(form.GetObject(), ret);
+    }
+
+    return ret;
+}
+
+PdfContentStreamCache::ContentsPtr PdfContentStreamReader::getCachedContents(const PdfContentView& content, const PdfXObjectForm& form)
+{
+    (void)content;
+    (void)form;
+    return nullptr;
+}
+
+PdfContentStreamCache::ContentsPtr PdfContentStreamReader::createCachedContents(const PdfXObjectForm& form)
+{
+    auto ret = std::make_shared<PdfContentStreamCache::Contents>();
+
+    // Tokenize the form with a reader with no canvas, so
+    // Do operators will be returned raw and followed on replay
+    charbuff buffer;
+    PdfContentStreamReader reader(std::make_shared<PdfCanvasInputDevice>(form, buffer));
+    PdfContent content;
+    while (reader.TryReadNext(content))
+    {
+        PdfContentStreamCache::Item item{ content.Type, content.Warnings, content.Operator,
+            (unsigned)ret->Operands.size(), content.Stack.GetSize(), 0 };
+        ret->Size += sizeof(PdfContentStreamCache::Item);
+        for (auto& operand : content.Stack.m_variants)
+        {
+            ret->Size += estimateSize(operand);
+            ret->Operands.push_back(std::move(operand));
+        }
+
+        switch (content.Type)
+        {
+            case PdfContentType::UnexpectedKeyword:
+            {
+                item.DataIndex = (unsigned)ret->Keywords.size();
+                ret->Keywords.push_back((string)content.Keyword);
+                ret->Size += sizeof(string) + content.Keyword.size();
+                break;
+            }
+            case PdfContentType::ImageDictionary:
+            {
+                item.DataIndex = (unsigned)ret->ImageDictionaries.size();
+                ret->ImageDictionaries.push_back(content.InlineImageDictionary);
+                ret->Size += estimateSize(content.InlineImageDictionary);
+                break;
+            }
+            case PdfContentType::ImageData:
+            {
+                item.DataIndex = (unsigned)ret->ImageData.size();
+                ret->ImageData.push_back(std::move(content.InlineImageData));
+                ret->Size += sizeof(charbuff) + ret->ImageData.back().size();
+                break;
+            }
+            default:
+            {
+                break;
+            }
+        }
+
+        ret->Items.push_back(item);
+    }
+
+    ret->TrailingOperands = std::move(content.Stack.m_variants);
+    for (auto& operand : ret->TrailingOperands)
+        ret->Size += estimateSize(operand);
+
+    return ret;
+}
+
+bool PdfContentStreamReader::tryGetXObjectName(PdfContent& content, string_view& name)
+{
+    if (content.Stack.GetSize() != 1 || !content.Stack[0].TryGetName(content.Name))
+        return false;
+
+    name = *content.Name;
+    return true;
+}
+
+bool PdfContentStreamReader::tryGetXObjectName(PdfContentView& content, string_view& name)
+{
+    (void)content;
+    if (m_views.Stack.size() != 1 || m_views.Stack[0].Operand.Type != PdfOperandType::Name)
+        return false;
+
+    auto& entry = m_views.Stack[0];
+    name = string_view(m_views.Buffer.data() + entry.Offset, entry.Operand.Data.size());
+    return true;
+}
+
+unsigned PdfContentStreamReader::getOperandCount(const PdfContent& content) const
+{
+    return content.Stack.GetSize();
+}
+
+unsigned PdfContentStreamReader::getOperandCount(const PdfContentView& content) const
+{
+    (void)content;
+    return (unsigned)m_views.Stack.size();
+}
+
+void PdfContentStreamReader::pushOperand(const PdfOperandView& operand)
+{
+    size_t offset = 0;
+    switch (operand.Type)
+    {
+        case PdfOperandType::String:
+        case PdfOperandType::HexString:
+        case PdfOperandType::Name:
+        {
+            // NOTE: The buffer may be reallocated by further reads,
+            // so store just the offset of the data
+            offset = (size_t)(operand.Data.data() - m_views.Buffer.data());
+            break;
+        }
+        case PdfOperandType::Dictionary:
+        {
+            offset = m_views.Variants.size();
+            m_views.Variants.push_back(std::move(m_temp.Variant));
+            break;
+        }
+        default:
+        {
+            // Numbers are decoded in place
+            break;
+        }
     }
+
+    m_views.Stack.push_back({ operand, offset });
+}
+
+void PdfContentStreamReader::popArray()
+{
+    size_t start = m_views.ArrayStarts.back();
+    m_views.ArrayStarts.pop_back();
+
+    // Move the array items to the items storage and
+    // replace them with the array operand
+    size_t offset = m_views.Items.size();
+    m_views.Items.insert(m_views.Items.end(), m_views.Stack.begin() + start, m_views.Stack.end());
+    PdfOperandView array;
+    array.Type = PdfOperandType::Array;
+    array.ItemCount = (unsigned)(m_views.Stack.size() - start);
+    m_views.Stack.resize(start);
+    m_views.Stack.push_back({ array, offset });
+}
+
+void PdfContentStreamReader::updateOperandViews(PdfContentView& content)
+{
+    m_views.ItemOperands.resize(m_views.Items.size());
+    for (size_t i = 0; i < m_views.Items.size(); i++)
+        m_views.ItemOperands[i] = getOperandView(m_views.Items[i].Operand, m_views.Items[i].Offset);
+
+    m_views.Operands.resize(m_views.Stack.size());
+    for (size_t i = 0; i < m_views.Stack.size(); i++)
+        m_views.Operands[i] = getOperandView(m_views.Stack[i].Operand, m_views.Stack[i].Offset);
+
+    content.Operands = m_views.Operands;
+}
+
+PdfOperandView PdfContentStreamReader::getOperandView(const PdfOperandView& operand, size_t offset) const
+{
+    PdfOperandView ret = operand;
+    switch (operand.Type)
+    {
+        case PdfOperandType::String:
+        case PdfOperandType::HexString:
+        case PdfOperandType::Name:
+            ret.Data = string_view(m_views.Buffer.data() + offset, operand.Data.size());
+            break;
+        case PdfOperandType::Array:
+            ret.Items = m_views.ItemOperands.data() + offset;
+            break;
+        case PdfOperandType::Dictionary:
+            ret.Variant = &m_views.Variants[offset];
+            break;
+        default:
+            break;
+    }
+
+    return ret;
 }
 
 // Returns false in case of EOF
-bool PdfContentStreamReader::tryReadInlineImgData(charbuff& data)
+bool PdfContentStreamReader::tryReadInlineImgData(bufferview& data)
 {
     // Consume one whitespace between ID and data
     char ch;
@@ -423,6 +857,24 @@ bool PdfContentStreamReader::tryReadInlineImgData(charbuff& data)
     return false;
 }
 
+shared_ptr<InputStreamDevice> PdfContentStreamReader::createCanvasDevice(const PdfCanvas& canvas)
+{
+    if ((m_args.Flags & (PdfContentReaderFlags::ConcatenateContents | PdfContentReaderFlags::ParallelDecodeContents))
+        == PdfContentReaderFlags::None)
+    {
+        return std::make_shared<PdfCanvasInputDevice>(canvas);
+    }
+
+    // Reuse the buffer of the current input depth,
+    // which is free since the previous input was popped
+    size_t depth = m_inputs.size();
+    if (m_contentsBuffers.size() == depth)
+        m_contentsBuffers.emplace_back();
+
+    bool parallel = (m_args.Flags & PdfContentReaderFlags::ParallelDecodeContents) != PdfContentReaderFlags::None;
+    return std::make_shared<PdfCanvasInputDevice>(canvas, m_contentsBuffers[depth], parallel);
+}
+
 void PdfContentStreamReader::handleWarnings()
 {
     if ((m_args.Flags & PdfContentReaderFlags::ThrowOnWarnings) != PdfContentReaderFlags::None)
@@ -440,3 +892,37 @@ bool PdfContentStreamReader::isCalledRecursively(const PdfObject* xobj)
 
     return false;
 }
+
+size_t estimateSize(const PdfVariant& variant)
+{
+    size_t ret = sizeof(PdfVariant);
+    switch (variant.GetDataType())
+    {
+        case PdfDataType::String:
+            ret += variant.GetString().GetRawData().size();
+            break;
+        case PdfDataType::Name:
+            ret += variant.GetName().GetRawData().size();
+            break;
+        case PdfDataType::Array:
+        case PdfDataType::Dictionary:
+        {
+            // Just use the serialized size as an estimate
+            string str;
+            variant.ToString(str);
+            ret += str.size() * 4;
+            break;
+        }
+        default:
+            break;
+    }
+
+    return ret;
+}
+
+size_t estimateSize(const PdfDictionary& dict)
+{
+    string str;
+    dict.ToString(str, false);
+    return sizeof(PdfDictionary) + str.size() * 4;
+}
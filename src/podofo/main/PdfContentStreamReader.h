@@ -13,9 +13,12 @@
 #include "PdfDictionary.h"
 #include "PdfVariantStack.h"
 #include "PdfPostScriptTokenizer.h"
+#include "PdfContentStreamCache.h"
 
 namespace PoDoFo {
 
+class PdfXObjectForm;
+
 /** Type of the content read from a content stream
  */
 enum class PdfContentType
@@ -55,11 +58,30 @@ struct PODOFO_API PdfContent final
     std::shared_ptr<const PdfXObject> XObject;
 };
 
+/** Content as read from content streams, with operands
+ * available as lightweight views in the order they appear
+ * in the content stream
+ * \remarks All the views are valid until the next read
+ */
+struct PODOFO_API PdfContentView final
+{
+    PdfContentType Type = PdfContentType::Unknown;
+    PdfContentWarnings Warnings = PdfContentWarnings::None;
+    cspan<PdfOperandView> Operands;
+    PdfOperator Operator = PdfOperator::Unknown;
+    std::string_view Keyword;
+    PdfDictionary InlineImageDictionary;
+    bufferview InlineImageData;
+    std::shared_ptr<const PdfXObject> XObject;
+};
+
 enum class PdfContentReaderFlags
 {
     None = 0,
     ThrowOnWarnings = 1,
     DontFollowXObjectForms = 2, ///< Don't follow XObject Forms. Valid XObects are still reported as such
+    ConcatenateContents = 4,    ///< Decode all content streams of a canvas or a followed XObject form in a single reusable buffer before reading
+    ParallelDecodeContents = 8, ///< Decode content streams in parallel. It implies ConcatenateContents
 };
 
 /** Custom handler for inline images
@@ -72,6 +94,9 @@ struct PODOFO_API PdfContentReaderArgs final
 {
     PdfContentReaderFlags Flags = PdfContentReaderFlags::None;
     PdfInlineImageHandler InlineImageHandler;
+    ///< Cache of pre-tokenized XObject forms. It's not used when reading
+    ///< PdfContentView or when a custom InlineImageHandler is set
+    PdfContentStreamCache* Cache = nullptr;
 };
 
 /** Reader class to read content streams
@@ -90,20 +115,70 @@ private:
 public:
     bool TryReadNext(PdfContent& data);
 
+    /** Read the next content without creating PdfVariant operands,
+     * that are instead returned as lightweight views. Reading path
+     * and text operators doesn't cause heap allocations
+     * \remarks Operands, keyword and inline image data are valid
+     * until the next read
+     */
+    bool TryReadNext(PdfContentView& content);
+
 private:
+    template <typename TContent>
+    bool tryReadNext(TContent& content);
+
     void beforeReadReset(PdfContent& content);
 
+    void beforeReadReset(PdfContentView& content);
+
     void afterReadClear(PdfContent& content);
 
+    void afterReadClear(PdfContentView& content);
+
     bool tryReadNextContent(PdfContent& content);
 
-    bool tryHandleOperator(PdfContent& content);
+    bool tryReadNextContent(PdfContentView& content);
+
+    template <typename TContent>
+    bool tryHandleKeyword(TContent& content);
+
+    template <typename TContent>
+    bool tryHandleOperator(TContent& content);
+
+    bool tryReadInlineImgDict(PdfDictionary& dict, PdfContentWarnings& warnings);
+
+    bool tryReadInlineImgData(bufferview& data);
 
-    bool tryReadInlineImgDict(PdfContent& content);
+    template <typename TContent>
+    void tryFollowXObject(TContent& content);
 
-    bool tryReadInlineImgData(charbuff& data);
+    bool tryReplayContent(PdfContent& content);
 
-    void tryFollowXObject(PdfContent& content);
+    bool tryReplayContent(PdfContentView& content);
+
+    PdfContentStreamCache::ContentsPtr getCachedContents(const PdfContent& content, const PdfXObjectForm& form);
+
+    PdfContentStreamCache::ContentsPtr getCachedContents(const PdfContentView& content, const PdfXObjectForm& form);
+
+    static PdfContentStreamCache::ContentsPtr createCachedContents(const PdfXObjectForm& form);
+
+    bool tryGetXObjectName(PdfContent& content, std::string_view& name);
+
+    bool tryGetXObjectName(PdfContentView& content, std::string_view& name);
+
+    unsigned getOperandCount(const PdfContent& content) const;
+
+    unsigned getOperandCount(const PdfContentView& content) const;
+
+    void pushOperand(const PdfOperandView& operand);
+
+    void popArray();
+
+    void updateOperandViews(PdfContentView& content);
+
+    PdfOperandView getOperandView(const PdfOperandView& operand, size_t offset) const;
+
+    std::shared_ptr<InputStreamDevice> createCanvasDevice(const PdfCanvas& canvas);
 
     void handleWarnings();
 
@@ -116,6 +191,28 @@ private:
         std::string_view Keyword;
         PdfVariant Variant;
         PdfName Name;
+        PdfOperandView Operand;
+    };
+
+    struct OperandEntry
+    {
+        PdfOperandView Operand;
+        // Offset of the data in the buffer for strings and names, of
+        // the first item for arrays, of the variant for dictionaries
+        size_t Offset;
+    };
+
+    // Reusable storage for lightweight operands. It's cleared
+    // before every read, but it retains its capacity
+    struct ViewStorage
+    {
+        std::vector<OperandEntry> Stack;
+        std::vector<OperandEntry> Items;
+        std::vector<size_t> ArrayStarts;
+        std::vector<PdfVariant> Variants;
+        std::vector<PdfOperandView> Operands;
+        std::vector<PdfOperandView> ItemOperands;
+        charbuff Buffer;
     };
 
     struct Input
@@ -123,10 +220,16 @@ private:
         std::shared_ptr<const PdfXObject> Form;
         std::shared_ptr<InputStreamDevice> Device;
         const PdfCanvas* Canvas;
+        // Cached contents that are replayed instead of reading the device
+        PdfContentStreamCache::ContentsPtr Contents;
+        unsigned ContentIndex;
     };
 
 private:
     std::vector<Input> m_inputs;
+    // Buffers for concatenated contents, indexed by input depth.
+    // NOTE: Use a deque so buffers references are stable
+    std::deque<charbuff> m_contentsBuffers;
     PdfContentReaderArgs m_args;
     std::shared_ptr<charbuff> m_buffer;
     PdfPostScriptTokenizer m_tokenizer;
@@ -134,6 +237,7 @@ private:
 
     // Temp storage
     Storage m_temp;
+    ViewStorage m_views;
 };
 
 };
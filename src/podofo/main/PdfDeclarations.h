@@ -161,6 +161,13 @@ enum class PdfTextExtractFlags
     ExtractSubstring = 128,     ///< NOTE: Extract the matched substring
 };
 
+enum class PdfImageOptimizeFlags
+{
+    None = 0,
+    PreferJpeg = 1,         ///< Encode as JPEG also the images not originally JPEG encoded
+    RecompressAll = 2,      ///< Re-encode also the images that don't need downsampling
+};
+
 enum class PdfXObjectType : uint8_t
 {
     Unknown = 0,
@@ -293,6 +300,8 @@ enum class PdfFontCreateFlags
     DontEmbed = 1,            ///< Do not embed font data. Not embedding Standard14 fonts implies non CID
     DontSubset = 2,           ///< Don't subset font data (includes all the font glyphs)
     PreferNonCID = 4,         ///< Prefer non CID, simple fonts (/Type1, /TrueType)
+    SubsetMinimalTables = 8,  ///< When subsetting TrueType fonts, write only the tables needed to render the glyphs, omitting hinting programs and glyph names.
+                              ///< NOTE: This violates ISO 32000-1:2008 9.9, which requires the 'cvt ', 'fpgm' and 'prep' tables to "always be present" if present in the original font program
 };
 
 enum class PdfFontMatchBehaviorFlags
@@ -441,6 +450,17 @@ enum class PdfSaveOptions
      * a regular save operation
      */
     SaveOnSigning = 64,
+    /** Merge streams with identical data and dictionary before
+     * writing, see PdfDocument::DeduplicateStreams(). The merged
+     * duplicates are removed unless NoCollectGarbage is specified
+     */
+    DeduplicateStreams = 128,
+    /** Balance the page tree before writing, if the document
+     * pages have been modified with a flat structure. A loaded
+     * page tree not modified is written as is.
+     * See PdfPageCollection::BalanceStructure()
+     */
+    BalancePageTree = 256,
 
     /**
       * \deprecated Use NoMetadataUpdate instead
@@ -813,6 +833,7 @@ ENABLE_BITMASK_OPERATORS(PoDoFo::PdfFontMatchBehaviorFlags);
 ENABLE_BITMASK_OPERATORS(PoDoFo::PdfFontDescriptorFlags);
 ENABLE_BITMASK_OPERATORS(PoDoFo::PdfGlyphAccess);
 ENABLE_BITMASK_OPERATORS(PoDoFo::PdfTextExtractFlags);
+ENABLE_BITMASK_OPERATORS(PoDoFo::PdfImageOptimizeFlags);
 ENABLE_BITMASK_OPERATORS(PoDoFo::PdfAnnotationFlags);
 
 /**
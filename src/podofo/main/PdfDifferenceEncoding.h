@@ -7,6 +7,8 @@
 #ifndef PDF_DIFFERENCE_ENCODING_H
 #define PDF_DIFFERENCE_ENCODING_H
 
+#include <atomic>
+
 #include "PdfEncodingMap.h"
 #include "PdfArray.h"
 
@@ -162,13 +164,27 @@ protected:
     bool tryGetCodePoints(const PdfCharCode& codeUnit, std::vector<char32_t>& codePoints) const override;
 
 private:
-    void buildReverseMap();
+    struct ReverseMapEntry
+    {
+        char32_t CodePoint;
+        unsigned char Code;
+    };
+
+    // Code points to codes, sorted by code point
+    using ReverseMap = std::vector<ReverseMapEntry>;
+
+private:
+    void buildReverseMap() const;
+    static std::shared_ptr<const ReverseMap> getReverseMap(const PdfEncodingMapConstPtr& baseEncoding,
+        const PdfDifferenceList& differences);
+    static std::shared_ptr<const ReverseMap> createReverseMap(const PdfEncodingMap& baseEncoding,
+        const PdfDifferenceList& differences);
 
 private:
     PdfEncodingMapConstPtr m_baseEncoding;
     PdfDifferenceList m_differences;
-    bool m_reverseMapBuilt;
-    std::unordered_map<char32_t, unsigned char> m_reverseMap;
+    mutable std::atomic<bool> m_reverseMapBuilt;
+    mutable std::shared_ptr<const ReverseMap> m_reverseMap;
 };
 
 };
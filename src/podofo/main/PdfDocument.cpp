@@ -8,6 +8,8 @@
 #include <podofo/private/XMPUtils.h>
 #include "PdfDocument.h"
 
+#include <podofo/private/PdfParserObject.h>
+
 #include "PdfExtGState.h"
 #include "PdfDestination.h"
 #include "PdfFileSpec.h"
@@ -15,10 +17,14 @@
 using namespace std;
 using namespace PoDoFo;
 
+static uint64_t getNextInstanceId();
+
 PdfDocument::PdfDocument(bool empty) :
     m_Objects(*this),
     m_Metadata(*this),
-    m_FontManager(*this)
+    m_FontManager(*this),
+    m_InstanceId(getNextInstanceId()),
+    m_ImportSourceId(0)
 {
     if (!empty)
         resetPrivate();
@@ -27,7 +33,9 @@ PdfDocument::PdfDocument(bool empty) :
 PdfDocument::PdfDocument(const PdfDocument& doc) :
     m_Objects(*this, doc.m_Objects),
     m_Metadata(*this),
-    m_FontManager(*this)
+    m_FontManager(*this),
+    m_InstanceId(getNextInstanceId()),
+    m_ImportSourceId(0)
 {
     SetTrailer(std::make_unique<PdfObject>(doc.GetTrailer().GetObject()));
     Init();
@@ -63,6 +71,11 @@ void PdfDocument::Clear()
     m_Outlines = nullptr;
     m_NameTrees = nullptr;
     m_Objects.Clear();
+    // The document is now a different import source, and
+    // imported objects must not be reused anymore
+    m_InstanceId = getNextInstanceId();
+    m_ImportSourceId = 0;
+    m_ImportedObjects.clear();
     clear();
 }
 
@@ -100,89 +113,29 @@ void PdfDocument::Init()
 
 void PdfDocument::AppendDocumentPages(const PdfDocument& doc)
 {
-    append(doc, true);
-}
-
-void PdfDocument::append(const PdfDocument& doc, bool appendAll)
-{
-    unsigned difference = static_cast<unsigned>(m_Objects.GetSize() + m_Objects.GetFreeObjects().size());
+    importPages(doc, m_Pages->GetCount(), 0, doc.GetPages().GetCount());
+    if (&doc == this)
+        return;
 
-    // Because GetNextObject uses m_ObjectCount instead 
-    // of m_Objects.GetSize() + m_Objects.GetFreeObjects().size() + 1
-    // make sure the free objects are already present before appending to
-    // prevent overlapping obj-numbers
-
-    // create all free objects again, to have a clean free object list
-    for (auto& ref : doc.GetObjects().GetFreeObjects())
-        m_Objects.AddFreeObject(PdfReference(ref.ObjectNumber() + difference, ref.GenerationNumber()));
-
-    // append all objects first and fix their references
-    for (auto& obj : doc.GetObjects())
+    // Append all outlines
+    const PdfOutlineItem* appendRoot = doc.GetOutlines();
+    if (appendRoot != nullptr && (appendRoot = appendRoot->First()) != nullptr)
     {
-        PdfReference ref(static_cast<uint32_t>(obj->GetIndirectReference().ObjectNumber() + difference), obj->GetIndirectReference().GenerationNumber());
-        auto newObj = new PdfObject(PdfDictionary());
-        newObj->setDirty();
-        newObj->SetIndirectReference(ref);
-        m_Objects.PushObject(newObj);
-        *newObj = *obj;
-
-        PoDoFo::LogMessage(PdfLogSeverity::Information, "Fixing references in {} {} R by {}",
-            newObj->GetIndirectReference().ObjectNumber(), newObj->GetIndirectReference().GenerationNumber(), difference);
-        fixObjectReferences(*newObj, difference);
-    }
+        ImportedObjectList imported;
+        PdfReference ref;
+        if (!tryImportObject(doc.GetObjects(), appendRoot->GetObject().GetIndirectReference(), imported, ref))
+            return;
 
-    if (appendAll)
-    {
-        const PdfName inheritableAttributes[] = {
-            PdfName("Resources"),
-            PdfName("MediaBox"),
-            PdfName("CropBox"),
-            PdfName("Rotate"),
-            PdfName::Null
-        };
-
-        // append all pages now to our page tree
-        for (unsigned i = 0; i < doc.GetPages().GetCount(); i++)
-        {
-            auto& page = doc.GetPages().GetPageAt(i);
-            auto& obj = m_Objects.MustGetObject(PdfReference(page.GetObject().GetIndirectReference().ObjectNumber()
-                + difference, page.GetObject().GetIndirectReference().GenerationNumber()));
-            if (obj.IsDictionary() && obj.GetDictionary().HasKey("Parent"))
-                obj.GetDictionary().RemoveKey("Parent");
-
-            // Deal with inherited attributes
-            auto inherited = inheritableAttributes;
-            while (!inherited->IsNull())
-            {
-                auto attribute = page.GetDictionary().FindKeyParent(*inherited);
-                if (attribute != nullptr)
-                {
-                    PdfObject attributeCopy(*attribute);
-                    fixObjectReferences(attributeCopy, difference);
-                    obj.GetDictionary().AddKey(*inherited, attributeCopy);
-                }
-
-                inherited++;
-            }
-
-            m_Pages->InsertPageAt(m_Pages->GetCount(), *new PdfPage(obj));
-        }
+        importObjects(doc.GetObjects(), imported);
 
-        // Append all outlines
-        const PdfOutlineItem* appendRoot = doc.GetOutlines();
-        if (appendRoot != nullptr && (appendRoot = appendRoot->First()) != nullptr)
-        {
-            // Get or create outlines
-            PdfOutlineItem* root = &this->GetOrCreateOutlines();
+        // Get or create outlines
+        PdfOutlineItem* root = &this->GetOrCreateOutlines();
 
-            // Find actual item where to append
-            while (root->Next() != nullptr)
-                root = root->Next();
+        // Find actual item where to append
+        while (root->Next() != nullptr)
+            root = root->Next();
 
-            PdfReference ref(appendRoot->GetObject().GetIndirectReference().ObjectNumber()
-                + difference, appendRoot->GetObject().GetIndirectReference().GenerationNumber());
-            root->InsertChild(unique_ptr<PdfOutlineItem>(new PdfOutlines(m_Objects.MustGetObject(ref))));
-        }
+        root->InsertChild(unique_ptr<PdfOutlineItem>(new PdfOutlines(m_Objects.MustGetObject(ref))));
     }
 
     // TODO: merge name trees
@@ -191,116 +144,273 @@ void PdfDocument::append(const PdfDocument& doc, bool appendAll)
 
 void PdfDocument::InsertDocumentPageAt(unsigned atIndex, const PdfDocument& doc, unsigned pageIndex)
 {
-    // copy of PdfDocument::Append, only restricts which page to add
-    unsigned difference = static_cast<unsigned>(m_Objects.GetSize() + m_Objects.GetFreeObjects().size());
-
-
-    // Because GetNextObject uses m_ObjectCount instead 
-    // of m_Objects.GetSize() + m_Objects.GetFreeObjects().size() + 1
-    // make sure the free objects are already present before appending to
-    // prevent overlapping obj-numbers
+    importPages(doc, atIndex, pageIndex, 1);
+}
 
-    // create all free objects again, to have a clean free object list
-    for (auto& freeObj : doc.GetObjects().GetFreeObjects())
-    {
-        m_Objects.AddFreeObject(PdfReference(freeObj.ObjectNumber() + difference, freeObj.GenerationNumber()));
-    }
+void PdfDocument::AppendDocumentPages(const PdfDocument& doc, unsigned pageIndex, unsigned pageCount)
+{
+    if (pageIndex + pageCount > doc.GetPages().GetCount())
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::ValueOutOfRange, "The page range is out of the source document");
 
-    // append all objects first and fix their references
-    for (auto& obj : doc.GetObjects())
-    {
-        PdfReference ref(static_cast<uint32_t>(obj->GetIndirectReference().ObjectNumber() + difference), obj->GetIndirectReference().GenerationNumber());
-        auto newObj = new PdfObject(PdfDictionary());
-        newObj->setDirty();
-        newObj->SetIndirectReference(ref);
-        m_Objects.PushObject(newObj);
-        *newObj = *obj;
-
-        PoDoFo::LogMessage(PdfLogSeverity::Information, "Fixing references in {} {} R by {}",
-            newObj->GetIndirectReference().ObjectNumber(), newObj->GetIndirectReference().GenerationNumber(), difference);
-        fixObjectReferences(*newObj, difference);
-    }
+    importPages(doc, m_Pages->GetCount(), pageIndex, pageCount);
+}
 
+void PdfDocument::importPages(const PdfDocument& doc, unsigned atIndex, unsigned pageIndex, unsigned pageCount)
+{
     const PdfName inheritableAttributes[] = {
         PdfName("Resources"),
         PdfName("MediaBox"),
         PdfName("CropBox"),
         PdfName("Rotate"),
-        PdfName::Null
     };
 
-    // append all page to our page tree
-    auto& page = doc.GetPages().GetPageAt(pageIndex);
-    auto& obj = m_Objects.MustGetObject(PdfReference(page.GetObject().GetIndirectReference().ObjectNumber()
-                                                     + difference, page.GetObject().GetIndirectReference().GenerationNumber()));
-    if (obj.IsDictionary() && obj.GetDictionary().HasKey("Parent"))
-        obj.GetDictionary().RemoveKey("Parent");
+    // Copy the pages first, so links between them are kept
+    bool sameDocument = &doc == this;
+    if (!sameDocument)
+        beginImport(doc);
 
-    // Deal with inherited attributes
-    const PdfName* inherited = inheritableAttributes;
-    while (!inherited->IsNull())
+    ImportedObjectList imported;
+    vector<PdfObject*> pageObjs;
+    pageObjs.reserve(pageCount);
+    for (unsigned i = 0; i < pageCount; i++)
     {
-        auto attribute = page.GetDictionary().FindKeyParent(*inherited);
-        if (attribute != nullptr)
+        auto& page = doc.GetPages().GetPageAt(pageIndex + i);
+        auto& obj = m_Objects.CreateObject(page.GetObject());
+        auto& dict = obj.GetDictionary();
+        dict.RemoveKey("Parent");
+
+        // Deal with inherited attributes
+        for (auto& inherited : inheritableAttributes)
         {
-            PdfObject attributeCopy(*attribute);
-            fixObjectReferences(attributeCopy, difference);
-            obj.GetDictionary().AddKey(*inherited, attributeCopy);
+            if (dict.HasKey(inherited))
+                continue;
+
+            auto attribute = page.GetDictionary().FindKeyParent(inherited);
+            if (attribute != nullptr)
+                dict.AddKey(inherited, *attribute);
         }
 
-        inherited++;
+        if (sameDocument)
+        {
+            copyPageAnnotations(obj);
+        }
+        else
+        {
+            // NOTE: Pages are always copied, but the latest copy
+            // is the target of links from subsequently imported objects
+            m_ImportedObjects[page.GetObject().GetIndirectReference()] = obj.GetIndirectReference();
+            imported.push_back({ &page.GetObject(), &obj });
+        }
+
+        pageObjs.push_back(&obj);
     }
 
-    m_Pages->InsertPageAt(atIndex, *new PdfPage(obj));
+    // Copy the objects reachable from the pages, sharing
+    // the ones already imported from the same document
+    if (!sameDocument)
+        importObjects(doc.GetObjects(), imported);
 
-    // TODO: merge name trees
-    // ToDictionary -> then iteratate over all keys and add them to the new one
+    vector<PdfPage*> pages;
+    pages.reserve(pageCount);
+    for (auto obj : pageObjs)
+        pages.push_back(new PdfPage(*obj));
+
+    m_Pages->InsertPagesAt(atIndex, pages);
 }
 
-void PdfDocument::AppendDocumentPages(const PdfDocument& doc, unsigned pageIndex, unsigned pageCount)
+void PdfDocument::copyPageAnnotations(PdfObject& pageObj)
 {
-    /*
-      This function works a bit different than one might expect.
-      Rather than copying one page at a time - we copy the ENTIRE document
-      and then delete the pages we aren't interested in.
+    auto& dict = pageObj.GetDictionary();
+    auto annotsObj = dict.FindKey("Annots");
+    const PdfArray* annots;
+    if (annotsObj == nullptr || !annotsObj->TryGetArray(annots))
+        return;
 
-      We do this because
-      1) SIGNIFICANTLY simplifies the process
-      2) Guarantees that shared objects aren't copied multiple times
-      3) offers MUCH faster performance for the common cases
+    PdfArray newAnnots;
+    unordered_map<PdfReference, PdfObject*> copies;
+    for (auto& annot : *annots)
+    {
+        PdfObject* annotObj;
+        if (!annot.IsReference()
+            || (annotObj = m_Objects.GetObject(annot.GetReference())) == nullptr
+            || !annotObj->IsDictionary())
+        {
+            newAnnots.Add(annot);
+            continue;
+        }
 
-      HOWEVER: because PoDoFo doesn't currently do any sort of "object garbage collection" during
-      a Write() - we will end up with larger documents, since the data from unused pages
-      will also be in there.
-    */
+        auto& copy = m_Objects.CreateObject(*annotObj);
+        copy.GetDictionary().AddKey("P", pageObj.GetIndirectReference());
+        copies[annot.GetReference()] = &copy;
+        newAnnots.Add(copy.GetIndirectReference());
+    }
 
-    // calculate preliminary "left" and "right" page ranges to delete
-    // then offset them based on where the pages were inserted
-    // NOTE: some of this will change if/when we support insertion at locations
-    //       OTHER than the end of the document!
-    unsigned leftStartPage = 0;
-    unsigned leftCount = pageIndex;
-    unsigned rightStartPage = pageIndex + pageCount;
-    unsigned rightCount = doc.GetPages().GetCount() - rightStartPage;
-    unsigned pageOffset = this->GetPages().GetCount();
+    // Make the links between the annotations of the page, such as
+    // popups and replies, point to the copies. Copies of widgets
+    // of a field are added to the field kids
+    for (auto& pair : copies)
+    {
+        auto& annotDict = pair.second->GetDictionary();
+        for (string_view key : { "Popup"sv, "Parent"sv, "IRT"sv })
+        {
+            auto linkObj = annotDict.GetKey(key);
+            if (linkObj == nullptr || !linkObj->IsReference())
+                continue;
 
-    leftStartPage += pageOffset;
-    rightStartPage += pageOffset;
+            auto found = copies.find(linkObj->GetReference());
+            if (found != copies.end())
+            {
+                *linkObj = found->second->GetIndirectReference();
+                continue;
+            }
 
-    // append in the whole document
-    this->AppendDocumentPages(doc);
+            PdfObject* fieldObj;
+            PdfObject* kidsObj;
+            PdfArray* kids;
+            if (key == "Parent"
+                && annotDict.FindKeyAs<PdfName>("Subtype") == "Widget"
+                && (fieldObj = m_Objects.GetObject(linkObj->GetReference())) != nullptr
+                && fieldObj->IsDictionary()
+                && (kidsObj = fieldObj->GetDictionary().FindKey("Kids")) != nullptr
+                && kidsObj->TryGetArray(kids))
+            {
+                kids->Add(pair.second->GetIndirectReference());
+            }
+        }
+    }
 
-    // delete
-    if (rightCount > 0)
-        this->deletePages(rightStartPage, rightCount);
-    if (leftCount > 0)
-        this->deletePages(leftStartPage, leftCount);
+    dict.AddKey("Annots", newAnnots);
 }
 
-void PdfDocument::deletePages(unsigned atIndex, unsigned pageCount)
+void PdfDocument::BalancePageTree()
 {
-    for (unsigned i = 0; i < pageCount; i++)
-        this->GetPages().RemovePageAt(atIndex);
+    // NOTE: A tree not yet modified is left as is, since
+    // managing it would load and rewrite all the pages
+    if (m_Pages->m_root != nullptr && m_Pages->m_maxKids == 0)
+        m_Pages->BalanceStructure();
+}
+
+void PdfDocument::beginImport(const PdfDocument& doc)
+{
+    if (m_ImportSourceId == doc.m_InstanceId)
+        return;
+
+    m_ImportSourceId = doc.m_InstanceId;
+    m_ImportedObjects.clear();
+}
+
+void PdfDocument::importObjects(const PdfIndirectObjectList& sourceObjects, ImportedObjectList& imported)
+{
+    // NOTE: The list grows while fixing the references
+    for (size_t i = 0; i < imported.size(); i++)
+    {
+        auto source = imported[i].first;
+        auto& obj = *imported[i].second;
+        importReferences(sourceObjects, obj, imported);
+        if (source->HasStream())
+            importStream(*source, obj);
+    }
+
+    // Share font programs identical to ones already in the document.
+    // NOTE: Streams that can't be read back were already written
+    if (!m_Objects.CanReadStreams())
+        return;
+
+    vector<PdfObject*> objects;
+    objects.reserve(imported.size());
+    for (auto& pair : imported)
+        objects.push_back(pair.second);
+
+    m_FontManager.ShareFontFiles(objects);
+}
+
+void PdfDocument::importStream(const PdfObject& source, PdfObject& obj)
+{
+    // The stream is copied raw after the dictionary references have been
+    // fixed, as streamed documents write the object immediately
+    bool loaded = source.m_IsDelayedLoadStreamDone;
+    auto& sourceStream = source.MustGetStream();
+    auto input = sourceStream.GetInputStream(true);
+    obj.GetOrCreateStream().SetData(input, sourceStream.GetFilters(), true);
+
+    // Release the streams loaded on demand just for the copy, so
+    // importing doesn't retain the source stream data in memory.
+    // NOTE: Only the stream is released, as it's loaded and decrypted again
+    // when needed, while the object itself may be referenced
+    if (!loaded && dynamic_cast<const PdfParserObject*>(&source) != nullptr)
+    {
+        auto& mutableSource = const_cast<PdfObject&>(source);
+        mutableSource.FreeStream();
+        mutableSource.EnableDelayedLoadingStream();
+    }
+}
+
+void PdfDocument::importReferences(const PdfIndirectObjectList& sourceObjects, PdfObject& obj, ImportedObjectList& imported)
+{
+    PdfDictionary* dict;
+    PdfArray* arr;
+    if (obj.IsReference())
+    {
+        // References to objects that are not imported are
+        // replaced with null, which is equivalent by the specification
+        PdfReference ref;
+        if (tryImportObject(sourceObjects, obj.GetReference(), imported, ref))
+            obj = PdfObject(ref);
+        else
+            obj = PdfObject::Null;
+    }
+    else if (obj.TryGetDictionary(dict))
+    {
+        for (auto& pair : *dict)
+            importReferences(sourceObjects, pair.second, imported);
+    }
+    else if (obj.TryGetArray(arr))
+    {
+        for (auto& child : *arr)
+            importReferences(sourceObjects, child, imported);
+    }
+}
+
+bool PdfDocument::tryImportObject(const PdfIndirectObjectList& sourceObjects, const PdfReference& ref,
+    ImportedObjectList& imported, PdfReference& importedRef)
+{
+    auto found = m_ImportedObjects.find(ref);
+    if (found != m_ImportedObjects.end() && m_Objects.GetObject(found->second) != nullptr)
+    {
+        importedRef = found->second;
+        return true;
+    }
+
+    auto source = sourceObjects.GetObject(ref);
+    if (source == nullptr)
+        return false;
+
+    // Don't follow links to the catalog and to the page tree,
+    // such as /Parent back-links or destinations of other pages
+    const PdfDictionary* dict;
+    if (source->TryGetDictionary(dict))
+    {
+        auto type = dict->FindKeyAs<PdfName>("Type");
+        if (type == "Page" || type == "Pages" || type == "Catalog")
+            return false;
+    }
+
+    // NOTE: The stream is copied later, see importObjects()
+    PdfObject* obj;
+    if (source->HasStream())
+    {
+        obj = &m_Objects.CreateObject(source->GetDictionary());
+        obj->GetDictionary().RemoveKey("Length");
+    }
+    else
+    {
+        obj = &m_Objects.CreateObject(*source);
+    }
+
+    importedRef = obj->GetIndirectReference();
+    m_ImportedObjects[ref] = importedRef;
+    imported.push_back({ source, obj });
+    return true;
 }
 
 PdfAction* PdfDocument::createAction(const type_info& typeInfo)
@@ -340,18 +450,8 @@ PdfInfo& PdfDocument::GetOrCreateInfo()
 
 Rect PdfDocument::FillXObjectFromPage(PdfXObjectForm& xobj, const PdfPage& page, bool useTrimBox)
 {
-    unsigned difference = 0;
     auto& sourceDoc = page.GetDocument();
-    if (this != &sourceDoc)
-    {
-        difference = static_cast<unsigned>(m_Objects.GetSize() + m_Objects.GetFreeObjects().size());
-        append(sourceDoc, false);
-    }
-
-    // TODO: remove unused objects: page, ...
-
-    auto& pageObj = m_Objects.MustGetObject(PdfReference(page.GetObject().GetIndirectReference().ObjectNumber()
-        + difference, page.GetObject().GetIndirectReference().GenerationNumber()));
+    auto& pageObj = page.GetObject();
     Rect box = page.GetMediaBox();
 
     // intersect with crop-box
@@ -362,8 +462,22 @@ Rect PdfDocument::FillXObjectFromPage(PdfXObjectForm& xobj, const PdfPage& page,
         box.Intersect(page.GetTrimBox());
 
     // link resources from external doc to x-object
-    if (pageObj.IsDictionary() && pageObj.GetDictionary().HasKey("Resources"))
-        xobj.GetDictionary().AddKey("Resources", *pageObj.GetDictionary().GetKey("Resources"));
+    auto resources = pageObj.GetDictionary().FindKeyParent("Resources");
+    if (resources != nullptr)
+    {
+        PdfObject resourcesObj = resources->IsIndirect()
+            ? PdfObject(resources->GetIndirectReference()) : *resources;
+        if (this != &sourceDoc)
+        {
+            // Copy only the objects reachable from the resources
+            beginImport(sourceDoc);
+            ImportedObjectList imported;
+            importReferences(sourceDoc.GetObjects(), resourcesObj, imported);
+            importObjects(sourceDoc.GetObjects(), imported);
+        }
+
+        xobj.GetDictionary().AddKey("Resources", resourcesObj);
+    }
 
     // copy top-level content from external doc to x-object
     if (pageObj.IsDictionary() && pageObj.GetDictionary().HasKey("Contents"))
@@ -383,17 +497,17 @@ Rect PdfDocument::FillXObjectFromPage(PdfXObjectForm& xobj, const PdfPage& page,
                 if (child.IsReference())
                 {
                     // TODO: not very efficient !!
-                    auto obj = GetObjects().GetObject(child.GetReference());
+                    const PdfObject* obj = sourceDoc.GetObjects().GetObject(child.GetReference());
 
                     while (obj != nullptr)
                     {
                         if (obj->IsReference())    // Recursively look for the stream
                         {
-                            obj = GetObjects().GetObject(obj->GetReference());
+                            obj = sourceDoc.GetObjects().GetObject(obj->GetReference());
                         }
                         else if (obj->HasStream())
                         {
-                            PdfObjectStream& contStream = obj->GetOrCreateStream();
+                            auto& contStream = obj->MustGetStream();
 
                             charbuff contStreamBuffer;
                             contStream.CopyTo(contStreamBuffer);
@@ -419,7 +533,7 @@ Rect PdfDocument::FillXObjectFromPage(PdfXObjectForm& xobj, const PdfPage& page,
         else if (contents.HasStream())
         {
             // copy stream to xobject
-            auto& contentsStream = contents.GetOrCreateStream();
+            auto& contentsStream = contents.MustGetStream();
             auto contentsInput = contentsStream.GetInputStream();
 
             auto& xobjStream = xobj.GetObject().GetOrCreateStream();
@@ -435,49 +549,14 @@ Rect PdfDocument::FillXObjectFromPage(PdfXObjectForm& xobj, const PdfPage& page,
     return box;
 }
 
-void PdfDocument::fixObjectReferences(PdfObject& obj, int difference)
+void PdfDocument::CollectGarbage()
 {
-    if (obj.IsDictionary())
-    {
-        for (auto& pair : obj.GetDictionary())
-        {
-            if (pair.second.IsReference())
-            {
-                pair.second = PdfObject(PdfReference(pair.second.GetReference().ObjectNumber() + difference,
-                    pair.second.GetReference().GenerationNumber()));
-            }
-            else if (pair.second.IsDictionary() ||
-                pair.second.IsArray())
-            {
-                fixObjectReferences(pair.second, difference);
-            }
-        }
-    }
-    else if (obj.IsArray())
-    {
-        for (auto& child : obj.GetArray())
-        {
-            if (child.IsReference())
-            {
-                child = PdfObject(PdfReference(child.GetReference().ObjectNumber() + difference,
-                    child.GetReference().GenerationNumber()));
-            }
-            else if (child.IsDictionary() || child.IsArray())
-            {
-                fixObjectReferences(child, difference);
-            }
-        }
-    }
-    else if (obj.IsReference())
-    {
-        obj = PdfObject(PdfReference(obj.GetReference().ObjectNumber() + difference,
-            obj.GetReference().GenerationNumber()));
-    }
+    m_Objects.CollectGarbage();
 }
 
-void PdfDocument::CollectGarbage()
+unsigned PdfDocument::DeduplicateStreams()
 {
-    m_Objects.CollectGarbage();
+    return m_Objects.DeduplicateStreams();
 }
 
 PdfOutlines& PdfDocument::GetOrCreateOutlines()
@@ -696,3 +775,9 @@ unique_ptr<PdfFileSpec> PdfDocument::CreateFileSpec()
 {
     return unique_ptr<PdfFileSpec>(new PdfFileSpec(*this));
 }
+
+uint64_t getNextInstanceId()
+{
+    static atomic<uint64_t> s_instanceId;
+    return ++s_instanceId;
+}
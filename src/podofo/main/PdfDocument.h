@@ -166,6 +166,13 @@ public:
 
     void CollectGarbage();
 
+    /** Merge the streams with identical data and dictionary, such as
+     *  repeated images or forms from imported pages
+     *  \returns the number of merged duplicate streams
+     *  \see PdfIndirectObjectList::DeduplicateStreams()
+     */
+    unsigned DeduplicateStreams();
+
     /** Construct a new PdfImage object
      *  \param prefix optional prefix for XObject-name
      */
@@ -278,6 +285,40 @@ public:
     PdfDocumentFieldIterable GetFieldsIterator();
     PdfDocumentConstFieldIterable GetFieldsIterator() const;
 
+    /** Extract the text of all the pages, processing them in parallel
+     * \param entries the extracted entries, one vector for every page in page order
+     * \param threadCount number of worker threads. 0 means the hardware concurrency
+     * \see ExtractText
+     */
+    void ExtractTextTo(std::vector<std::vector<PdfTextEntry>>& entries,
+        const PdfTextExtractParams& params = { }, unsigned threadCount = 0) const;
+
+    /** Extract the text of all the pages, processing them in parallel
+     * \param callback a callback receiving the entries of every page. It's
+     *        called serially and in page order, but it runs on the worker
+     *        threads, including the calling one, while the other workers
+     *        keep extracting the following pages
+     * \param threadCount number of worker threads. 0 means the hardware concurrency
+     * \remarks The document must not be modified during the extraction.
+     *        A cache in the params is not shared across threads: instead
+     *        every worker uses its own cache with the same maximum size
+     */
+    void ExtractText(const PdfTextExtractCallback& callback,
+        const PdfTextExtractParams& params = { }, unsigned threadCount = 0) const;
+
+    /** Reduce the size of the images drawn in the pages, processing them in parallel.
+     * The effective resolution of every image is computed from the largest size
+     * it's drawn with in the page content streams: images exceeding the
+     * threshold resolution are downsampled to the target resolution and re-encoded
+     * \param threadCount number of worker threads. 0 means the hardware concurrency
+     * \returns the number of images that have been replaced
+     * \remarks Only images with DeviceGray or DeviceRGB color spaces and 8 bits
+     *        samples, or 1 bit samples for bilevel images, are supported. Bilevel
+     *        images are re-encoded with flate compression. A re-encoded image is
+     *        kept only if smaller than the original
+     */
+    unsigned OptimizeImages(const PdfImageOptimizeParams& params = { }, unsigned threadCount = 0);
+
     /** Clear all internal structures and reset PdfDocument to an empty state.
       */
     void Reset();
@@ -391,6 +432,11 @@ protected:
 
     virtual void reset();
 
+    /** Balance the page tree, if the pages have been modified
+     * with a flat structure. See PdfSaveOptions::BalancePageTree
+     */
+    void BalancePageTree();
+
     /** Clear all variables that have internal memory usage
       */
     void Clear();
@@ -419,17 +465,24 @@ private:
     PdfInfo& GetOrCreateInfo();
 
 private:
-    void append(const PdfDocument& doc, bool appendAll);
-    /** Recursively changes every PdfReference in the PdfObject and in any child
-     *  that is either an PdfArray or a direct object.
-     *  The reference is changed so that difference is added to the object number
-     *  of the reference.
-     *  \param obj object to change
-     *  \param difference add this value to every reference that is encountered
-     */
-    void fixObjectReferences(PdfObject& obj, int difference);
-
-    void deletePages(unsigned atIndex, unsigned pageCount);
+    /** Copy the pages of another document, together with the objects
+     * reachable from them. Objects already imported from the same
+     * document are shared
+     */
+    void importPages(const PdfDocument& doc, unsigned atIndex, unsigned pageIndex, unsigned pageCount);
+    /** Copy the annotations of a page copied from the same document,
+     * since an annotation can't belong to more than one page
+     */
+    void copyPageAnnotations(PdfObject& pageObj);
+    void beginImport(const PdfDocument& doc);
+    // Source and target objects of an import operation
+    using ImportedObjectList = std::vector<std::pair<const PdfObject*, PdfObject*>>;
+    void importObjects(const PdfIndirectObjectList& sourceObjects, ImportedObjectList& imported);
+    void importStream(const PdfObject& source, PdfObject& obj);
+    void importReferences(const PdfIndirectObjectList& sourceObjects, PdfObject& obj,
+        ImportedObjectList& imported);
+    bool tryImportObject(const PdfIndirectObjectList& sourceObjects, const PdfReference& ref,
+        ImportedObjectList& imported, PdfReference& importedRef);
 
     PdfAction* createAction(const std::type_info& typeInfo);
 
@@ -450,6 +503,9 @@ private:
     std::unique_ptr<PdfAcroForm> m_AcroForm;
     std::unique_ptr<PdfOutlines> m_Outlines;
     std::unique_ptr<PdfNameTrees> m_NameTrees;
+    uint64_t m_InstanceId;
+    uint64_t m_ImportSourceId;
+    std::unordered_map<PdfReference, PdfReference> m_ImportedObjects; // Source to target references of imported objects
 };
 
 template<typename TAction>
@@ -0,0 +1,569 @@
+/**
+ * SPDX-FileCopyrightText: (C) 2022 Francesco Pretto <ceztko@gmail.com>
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ * SPDX-License-Identifier: MPL-2.0
+ */
+
+#include <podofo/private/PdfDeclarationsPrivate.h>
+#include "PdfDocument.h"
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include <zlib.h>
+
+#include <podofo/private/ImageUtils.h>
+#include <podofo/private/ParallelUtils.h>
+#include <podofo/private/PdfFilterFactory.h>
+
+#include "PdfContentStreamReader.h"
+
+using namespace std;
+using namespace PoDoFo;
+
+namespace
+{
+    enum class ImageEncoding
+    {
+        Flate,
+        Jpeg,
+        Bilevel,    ///< 1 bit samples, flate compressed
+    };
+
+    // Largest size an image is drawn with, in inches
+    struct ImagePlacement
+    {
+        double Width = 0;
+        double Height = 0;
+    };
+
+    struct ImageJob
+    {
+        unique_ptr<PdfImage> Image;
+        unique_ptr<PdfImage> SMask;
+        unsigned Width = 0;         // Width of the re-encoded image
+        unsigned Height = 0;        // Height of the re-encoded image
+        unsigned Components = 0;
+        ImageEncoding Encoding = ImageEncoding::Flate;
+        size_t OriginalSize = 0;    // Size of the encoded image and /SMask data
+        charbuff Data;
+        charbuff SMaskData;
+        bool Replace = false;
+    };
+}
+
+using ImagePlacementMap = unordered_map<const PdfObject*, ImagePlacement>;
+using SMaskUseMap = unordered_map<const PdfObject*, unsigned>;
+
+// Maximum size of the encoded image data loaded at once
+static constexpr size_t MaxBatchDataSize = 64 * 1024 * 1024;
+
+static void collectPlacements(const PdfPage& page, ImagePlacementMap& placements);
+static bool tryCreateJob(PdfObject& obj, const ImagePlacement& placement, const PdfImageOptimizeParams& params,
+    const ImagePlacementMap& placements, const SMaskUseMap& smaskUses, ImageJob& job);
+static void loadJob(ImageJob& job);
+static void resolveReferences(const PdfObject* obj, unordered_set<const PdfObject*>& visited);
+static bool isSupportedImage(PdfImage& image, bool& bilevel, unsigned& components);
+static void processImage(ImageJob& job, const PdfImageOptimizeParams& params);
+static void encodeImage(charbuff& output, const bufferview& samples, unsigned width, unsigned height,
+    unsigned components, ImageEncoding encoding, const PdfImageOptimizeParams& params);
+static void applyImage(PdfImage& image, const charbuff& data, unsigned width, unsigned height, ImageEncoding encoding);
+static unsigned getDecodedScanLineSize(unsigned width, unsigned components);
+
+unsigned PdfDocument::OptimizeImages(const PdfImageOptimizeParams& params, unsigned threadCount)
+{
+    if (params.TargetResolution <= 0)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::ValueOutOfRange, "The target resolution must be positive");
+
+    // Find the images drawn in the pages and the largest size they are
+    // drawn with, then create the jobs from the image dictionaries only
+    auto& pages = GetPages();
+    unsigned pageCount = pages.GetCount();
+    ImagePlacementMap placements;
+    for (unsigned i = 0; i < pageCount; i++)
+        collectPlacements(pages.GetPageAt(i), placements);
+
+    // Collect all the /SMask images first, so the images that are
+    // also used as a /SMask, and the shared /SMask, are skipped
+    // regardless of the order the images are processed
+    SMaskUseMap smaskUses;
+    for (auto& pair : placements)
+    {
+        const PdfObject* smaskObj;
+        if (pair.first->IsDictionary()
+            && (smaskObj = pair.first->GetDictionary().FindKey("SMask")) != nullptr)
+        {
+            smaskUses[smaskObj]++;
+        }
+    }
+
+    vector<ImageJob> jobs;
+    for (auto& pair : placements)
+    {
+        ImageJob job;
+        if (tryCreateJob(const_cast<PdfObject&>(*pair.first), pair.second, params, placements, smaskUses, job))
+            jobs.push_back(std::move(job));
+    }
+
+    // Process the images in batches of bounded size, so the
+    // streams of all the images are not loaded at once
+    unsigned count = 0;
+    size_t batchStart = 0;
+    while (batchStart < jobs.size())
+    {
+        // Load the streams serially, since loading
+        // objects is not thread safe
+        size_t batchEnd = batchStart;
+        size_t batchDataSize = 0;
+        do
+        {
+            loadJob(jobs[batchEnd]);
+            batchDataSize += jobs[batchEnd].OriginalSize;
+            batchEnd++;
+        } while (batchEnd < jobs.size() && batchDataSize < MaxBatchDataSize);
+
+        // Decode, resample and encode the images on the workers
+        utls::RunParallel((unsigned)(batchEnd - batchStart), threadCount, [&](unsigned index, unsigned workerIndex) {
+            (void)workerIndex;
+            auto& job = jobs[batchStart + index];
+            try
+            {
+                processImage(job, params);
+            }
+            catch (PdfError& ex)
+            {
+                // Leave the images that can't be decoded untouched
+                PoDoFo::LogMessage(PdfLogSeverity::Warning, "Unable to optimize image {}: {}",
+                    job.Image->GetObject().GetIndirectReference().ToString(), ex.what());
+            }
+        });
+
+        // Replace the image data serially
+        for (size_t i = batchStart; i < batchEnd; i++)
+        {
+            auto& job = jobs[i];
+            if (!job.Replace)
+                continue;
+
+            applyImage(*job.Image, job.Data, job.Width, job.Height, job.Encoding);
+            if (job.SMask != nullptr)
+                applyImage(*job.SMask, job.SMaskData, job.Width, job.Height, ImageEncoding::Flate);
+
+            charbuff().swap(job.Data);
+            charbuff().swap(job.SMaskData);
+            count++;
+        }
+
+        batchStart = batchEnd;
+    }
+
+    return count;
+}
+
+void collectPlacements(const PdfPage& page, ImagePlacementMap& placements)
+{
+    // The image space unit square is mapped to the
+    // user space by the CTM, see PDF 32000-1:2008 8.9.4
+    Matrix ctm;
+    vector<Matrix> states;
+    vector<size_t> formStateIndices;
+    PdfContentStreamReader reader(page);
+    PdfContent content;
+    while (reader.TryReadNext(content))
+    {
+        switch (content.Type)
+        {
+            case PdfContentType::Operator:
+            {
+                if ((content.Warnings & PdfContentWarnings::InvalidOperator)
+                    != PdfContentWarnings::None)
+                {
+                    // Ignore invalid operators
+                    continue;
+                }
+
+                switch (content.Operator)
+                {
+                    case PdfOperator::cm:
+                    {
+                        double coeffs[6];
+                        bool valid = content.Stack.GetSize() == 6;
+                        for (unsigned i = 0; valid && i < 6; i++)
+                            valid = content.Stack[5 - i].TryGetReal(coeffs[i]);
+
+                        if (valid)
+                            ctm = Matrix::FromArray(coeffs) * ctm;
+
+                        break;
+                    }
+                    case PdfOperator::q:
+                    {
+                        states.push_back(ctm);
+                        break;
+                    }
+                    case PdfOperator::Q:
+                    {
+                        // Be lenient with unbalanced save/restore
+                        size_t minSize = formStateIndices.size() == 0 ? 0 : formStateIndices.back() + 1;
+                        if (states.size() > minSize)
+                        {
+                            ctm = states.back();
+                            states.pop_back();
+                        }
+                        break;
+                    }
+                    default:
+                    {
+                        // Ignore all the other operators
+                        break;
+                    }
+                }
+
+                break;
+            }
+            case PdfContentType::DoXObject:
+            {
+                if (content.XObject->GetType() == PdfXObjectType::Form)
+                {
+                    formStateIndices.push_back(states.size());
+                    states.push_back(ctm);
+                    ctm = content.XObject->GetMatrix() * ctm;
+                }
+                else if (content.XObject->GetType() == PdfXObjectType::Image)
+                {
+                    auto& placement = placements[&content.XObject->GetObject()];
+                    placement.Width = std::max(placement.Width, std::hypot(ctm[0], ctm[1]) / 72);
+                    placement.Height = std::max(placement.Height, std::hypot(ctm[2], ctm[3]) / 72);
+                }
+
+                break;
+            }
+            case PdfContentType::EndXObjectForm:
+            {
+                PODOFO_ASSERT(formStateIndices.size() != 0);
+                states.resize(formStateIndices.back() + 1);
+                ctm = states.back();
+                states.pop_back();
+                formStateIndices.pop_back();
+                break;
+            }
+            default:
+            {
+                // Ignore inline images
+                break;
+            }
+        }
+    }
+}
+
+bool tryCreateJob(PdfObject& obj, const ImagePlacement& placement, const PdfImageOptimizeParams& params,
+    const ImagePlacementMap& placements, const SMaskUseMap& smaskUses, ImageJob& job)
+{
+    // An image used also as a /SMask is resized together
+    // with the image it's the /SMask of, if at all
+    if (smaskUses.find(&obj) != smaskUses.end()
+        || !PdfXObject::TryCreateFromObject(obj, job.Image))
+    {
+        return false;
+    }
+
+    bool bilevel;
+    if (!isSupportedImage(*job.Image, bilevel, job.Components))
+        return false;
+
+    if (placement.Width <= 0 || placement.Height <= 0)
+        return false;
+
+    unsigned width = job.Image->GetWidth();
+    unsigned height = job.Image->GetHeight();
+    double resolution = std::min(width / placement.Width, height / placement.Height);
+    bool downsample = resolution > params.ThresholdResolution && resolution > params.TargetResolution;
+    if (!downsample && (params.Flags & PdfImageOptimizeFlags::RecompressAll) == PdfImageOptimizeFlags::None)
+        return false;
+
+    if (downsample)
+    {
+        double scale = params.TargetResolution / resolution;
+        job.Width = std::clamp((unsigned)std::lround(width * scale), 1u, width);
+        job.Height = std::clamp((unsigned)std::lround(height * scale), 1u, height);
+    }
+    else
+    {
+        job.Width = width;
+        job.Height = height;
+    }
+
+    auto filters = PdfFilterFactory::CreateFilterList(obj);
+    bool isJpeg = filters.size() != 0 && filters.back() == PdfFilterType::DCTDecode;
+    if (isJpeg && !downsample)
+    {
+        // Don't re-encode JPEG images with the same
+        // size, to not further degrade their quality
+        return false;
+    }
+
+    auto& dict = obj.GetDictionary();
+    auto smaskObj = dict.FindKey("SMask");
+    if (smaskObj != nullptr)
+    {
+        // The /SMask is resized together with the image, so it
+        // must have the same size, must not be shared and must
+        // not be drawn directly as well
+        bool smaskBilevel;
+        unsigned smaskComponents;
+        if (smaskUses.at(smaskObj) != 1
+            || placements.find(smaskObj) != placements.end()
+            || !PdfXObject::TryCreateFromObject(*smaskObj, job.SMask)
+            || !isSupportedImage(*job.SMask, smaskBilevel, smaskComponents)
+            || smaskBilevel || smaskComponents != 1
+            || job.SMask->GetWidth() != width || job.SMask->GetHeight() != height)
+        {
+            return false;
+        }
+    }
+
+    if (bilevel)
+    {
+        job.Encoding = ImageEncoding::Bilevel;
+    }
+    else
+    {
+#ifdef PODOFO_HAVE_JPEG_LIB
+        if (isJpeg || (params.Flags & PdfImageOptimizeFlags::PreferJpeg) != PdfImageOptimizeFlags::None)
+            job.Encoding = ImageEncoding::Jpeg;
+        else
+#endif // PODOFO_HAVE_JPEG_LIB
+            job.Encoding = ImageEncoding::Flate;
+    }
+
+    return true;
+}
+
+void loadJob(ImageJob& job)
+{
+    // Load the streams and resolve the objects reachable from the image
+    // dictionaries, such as an indirect /DecodeParms or /ColorSpace,
+    // since they may be shared with the images processed concurrently
+    unordered_set<const PdfObject*> visited;
+    resolveReferences(&job.Image->GetObject(), visited);
+    job.OriginalSize = job.Image->GetObject().MustGetStream().GetLength();
+    if (job.SMask != nullptr)
+    {
+        resolveReferences(&job.SMask->GetObject(), visited);
+        job.OriginalSize += job.SMask->GetObject().MustGetStream().GetLength();
+    }
+}
+
+void resolveReferences(const PdfObject* obj, unordered_set<const PdfObject*>& visited)
+{
+    if (obj == nullptr || !visited.insert(obj).second)
+        return;
+
+    // NOTE: Accessing the stream also forces
+    // loading the object, if it was delayed
+    (void)obj->GetStream();
+
+    const PdfDictionary* dict;
+    const PdfArray* arr;
+    if (obj->TryGetDictionary(dict))
+    {
+        for (auto pair : dict->GetIndirectIterator())
+            resolveReferences(pair.second, visited);
+    }
+    else if (obj->TryGetArray(arr))
+    {
+        for (auto child : arr->GetIndirectIterator())
+            resolveReferences(child, visited);
+    }
+}
+
+bool isSupportedImage(PdfImage& image, bool& bilevel, unsigned& components)
+{
+    auto& dict = image.GetDictionary();
+    if (dict.FindKeyAsSafe<bool>("ImageMask") || dict.HasKey("Mask")
+        || image.GetWidth() == 0 || image.GetHeight() == 0)
+    {
+        return false;
+    }
+
+    // NOTE: The filters are read from the dictionary,
+    // so the stream is not loaded
+    if (!image.GetObject().HasStream())
+        return false;
+
+    for (auto filter : PdfFilterFactory::CreateFilterList(image.GetObject()))
+    {
+        switch (filter)
+        {
+            case PdfFilterType::JBIG2Decode:
+            case PdfFilterType::JPXDecode:
+            case PdfFilterType::Crypt:
+#ifndef PODOFO_HAVE_JPEG_LIB
+            case PdfFilterType::DCTDecode:
+#endif // PODOFO_HAVE_JPEG_LIB
+                return false;
+            default:
+                break;
+        }
+    }
+
+    unsigned bitsPerComponent = (unsigned)dict.FindKeyAsSafe<int64_t>("BitsPerComponent");
+    switch (image.GetColorSpace().GetType())
+    {
+        case PdfColorSpaceType::DeviceGray:
+            components = 1;
+            bilevel = bitsPerComponent == 1;
+            return bilevel || bitsPerComponent == 8;
+        case PdfColorSpaceType::DeviceRGB:
+            components = 3;
+            bilevel = false;
+            return bitsPerComponent == 8;
+        default:
+            return false;
+    }
+}
+
+void processImage(ImageJob& job, const PdfImageOptimizeParams& params)
+{
+    unsigned width = job.Image->GetWidth();
+    unsigned height = job.Image->GetHeight();
+    auto format = job.Components == 1 ? PdfPixelFormat::Grayscale : PdfPixelFormat::RGB24;
+
+    charbuff decoded;
+    charbuff resampled;
+    job.Image->DecodeTo(decoded, format);
+    utls::ResampleImage(resampled, job.Width, job.Height, decoded,
+        width, height, getDecodedScanLineSize(width, job.Components), job.Components);
+    encodeImage(job.Data, resampled, job.Width, job.Height, job.Components, job.Encoding, params);
+
+    if (job.SMask != nullptr)
+    {
+        job.SMask->DecodeTo(decoded, PdfPixelFormat::Grayscale);
+        utls::ResampleImage(resampled, job.Width, job.Height, decoded,
+            width, height, getDecodedScanLineSize(width, 1), 1);
+        encodeImage(job.SMaskData, resampled, job.Width, job.Height, 1, ImageEncoding::Flate, params);
+    }
+
+    // Keep the re-encoded image only if it's actually smaller
+    job.Replace = job.Data.size() + job.SMaskData.size() < job.OriginalSize;
+    if (!job.Replace)
+    {
+        charbuff().swap(job.Data);
+        charbuff().swap(job.SMaskData);
+    }
+}
+
+void encodeImage(charbuff& output, const bufferview& samples, unsigned width, unsigned height,
+    unsigned components, ImageEncoding encoding, const PdfImageOptimizeParams& params)
+{
+    switch (encoding)
+    {
+        case ImageEncoding::Jpeg:
+        {
+#ifdef PODOFO_HAVE_JPEG_LIB
+            jpeg_compress_struct ctx;
+            JpegErrorHandler jerr;
+            try
+            {
+                InitJpegCompressContext(ctx, jerr);
+
+                JpegBufferDestination jdest;
+                PoDoFo::SetJpegBufferDestination(ctx, output, jdest);
+
+                ctx.image_width = width;
+                ctx.image_height = height;
+                ctx.input_components = (int)components;
+                ctx.in_color_space = components == 1 ? JCS_GRAYSCALE : JCS_RGB;
+
+                jpeg_set_defaults(&ctx);
+                jpeg_set_quality(&ctx, (int)(std::clamp(params.JpegQuality, 0.0, 1.0) * 100), TRUE);
+                jpeg_start_compress(&ctx, TRUE);
+
+                JSAMPROW row_pointer[1];
+                for (unsigned i = 0; i < height; i++)
+                {
+                    row_pointer[0] = (JSAMPROW)const_cast<char*>(samples.data() + (size_t)i * width * components);
+                    (void)jpeg_write_scanlines(&ctx, row_pointer, 1);
+                }
+
+                jpeg_finish_compress(&ctx);
+            }
+            catch (...)
+            {
+                jpeg_destroy_compress(&ctx);
+                throw;
+            }
+
+            jpeg_destroy_compress(&ctx);
+            break;
+#else
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::NotImplemented, "Missing jpeg support");
+#endif
+        }
+        case ImageEncoding::Flate:
+        case ImageEncoding::Bilevel:
+        {
+            charbuff packed;
+            bufferview data = samples;
+            if (encoding == ImageEncoding::Bilevel)
+            {
+                // Threshold the averaged gray levels and pack them to 1 bit samples
+                unsigned scanLineSize = (width + 7) / 8;
+                packed.resize((size_t)scanLineSize * height);
+                for (unsigned i = 0; i < height; i++)
+                {
+                    auto src = (const unsigned char*)samples.data() + (size_t)i * width;
+                    auto dst = (unsigned char*)packed.data() + (size_t)i * scanLineSize;
+                    for (unsigned j = 0; j < width; j++)
+                    {
+                        if (src[j] >= 128)
+                            dst[j / 8] |= (unsigned char)(0x80 >> (j % 8));
+                    }
+                }
+
+                data = packed;
+            }
+
+            uLongf compressedLen = compressBound((uLong)data.size());
+            output.resize(compressedLen);
+            if (compress2((Bytef*)output.data(), &compressedLen, (const Bytef*)data.data(),
+                (uLong)data.size(), Z_DEFAULT_COMPRESSION) != Z_OK)
+            {
+                PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InternalLogic, "Image flate compression failed");
+            }
+
+            output.resize(compressedLen);
+            break;
+        }
+        default:
+            PODOFO_RAISE_ERROR(PdfErrorCode::InvalidEnumValue);
+    }
+}
+
+void applyImage(PdfImage& image, const charbuff& data, unsigned width, unsigned height, ImageEncoding encoding)
+{
+    auto& dict = image.GetDictionary();
+    PdfImageInfo info;
+    info.Width = width;
+    info.Height = height;
+    info.BitsPerComponent = encoding == ImageEncoding::Bilevel ? 1 : 8;
+    info.ColorSpace = PdfColorSpaceFilterFactory::GetTrivialFilter(image.GetColorSpace().GetType());
+    info.Filters = PdfFilterList{ encoding == ImageEncoding::Jpeg ? PdfFilterType::DCTDecode : PdfFilterType::FlateDecode };
+
+    // The /Decode array maps the samples as before
+    const PdfArray* decodeArr;
+    if (dict.TryFindKeyAs("Decode", decodeArr))
+    {
+        for (unsigned i = 0; i < decodeArr->GetSize(); i++)
+            info.DecodeArray.push_back((*decodeArr)[i].GetReal());
+    }
+
+    image.SetDataRaw(data, info);
+    dict.RemoveKey("DecodeParms");
+}
+
+unsigned getDecodedScanLineSize(unsigned width, unsigned components)
+{
+    // Scan lines decoded by PdfImage::DecodeTo() are 4 bytes aligned
+    return 4 * ((width * components + 3) / 4);
+}
@@ -0,0 +1,200 @@
+/**
+ * SPDX-FileCopyrightText: (C) 2022 Francesco Pretto <ceztko@gmail.com>
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ * SPDX-License-Identifier: MPL-2.0
+ */
+
+#include <podofo/private/PdfDeclarationsPrivate.h>
+#include "PdfDocument.h"
+
+#include <unordered_set>
+
+#include <podofo/private/ParallelUtils.h>
+
+#include "PdfContentStreamCache.h"
+#include "PdfXObjectForm.h"
+#include "PdfFont.h"
+
+using namespace std;
+using namespace PoDoFo;
+
+static void preloadPage(const PdfPage& page, unordered_set<const PdfObject*>& visited,
+    unordered_set<const PdfObject*>& visitedResources);
+static void preloadObject(const PdfObject& obj, unordered_set<const PdfObject*>& visited);
+static void preloadResources(const PdfResources& resources, unordered_set<const PdfObject*>& visitedResources);
+
+void PdfDocument::ExtractTextTo(vector<vector<PdfTextEntry>>& entries,
+    const PdfTextExtractParams& params, unsigned threadCount) const
+{
+    entries.clear();
+    ExtractText([&entries](unsigned pageIndex, vector<PdfTextEntry>& pageEntries) {
+        (void)pageIndex;
+        entries.push_back(std::move(pageEntries));
+    }, params, threadCount);
+}
+
+void PdfDocument::ExtractText(const PdfTextExtractCallback& callback,
+    const PdfTextExtractParams& params, unsigned threadCount) const
+{
+    // Load pages, all the objects reachable from their contents
+    // and resources, including the streams of forms shared between
+    // pages, and the fonts used by them serially, since loading
+    // objects and fonts is not thread safe. The workers then only
+    // decode the already loaded streams with PdfObjectStream::CopyTo(),
+    // which doesn't lock the stream and can be used concurrently
+    auto& pages = GetPages();
+    unsigned pageCount = pages.GetCount();
+    vector<const PdfPage*> loadedPages(pageCount);
+    unordered_set<const PdfObject*> visited;
+    unordered_set<const PdfObject*> visitedResources;
+    for (unsigned i = 0; i < pageCount; i++)
+    {
+        auto& page = pages.GetPageAt(i);
+        preloadPage(page, visited, visitedResources);
+        loadedPages[i] = &page;
+    }
+
+    // Results are handed to the callback in page order, by one worker
+    // at a time and outside the lock, so a slow callback doesn't stall
+    // the other workers. Each worker has its own forms cache, since
+    // it's not thread safe
+    threadCount = utls::GetParallelThreadCount(pageCount, threadCount);
+    vector<unique_ptr<PdfContentStreamCache>> caches(threadCount);
+    std::mutex mutex;
+    vector<vector<PdfTextEntry>> results(pageCount);
+    vector<bool> done(pageCount);
+    unsigned nextPageToEmit = 0;
+    bool emitting = false;
+    utls::RunParallel(pageCount, threadCount, [&](unsigned pageIndex, unsigned workerIndex) {
+        PdfTextExtractParams workerParams = params;
+        if (params.Cache != nullptr)
+        {
+            auto& cache = caches[workerIndex];
+            if (cache == nullptr)
+                cache.reset(new PdfContentStreamCache(params.Cache->GetMaxSize()));
+
+            workerParams.Cache = cache.get();
+        }
+
+        vector<PdfTextEntry> entries;
+        loadedPages[pageIndex]->ExtractTextTo(entries, workerParams);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            results[pageIndex] = std::move(entries);
+            done[pageIndex] = true;
+
+            // The worker delivering the results
+            // will also deliver this page
+            if (emitting)
+                return;
+
+            emitting = true;
+        }
+
+        vector<pair<unsigned, vector<PdfTextEntry>>> ready;
+        while (true)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                while (nextPageToEmit < pageCount && done[nextPageToEmit])
+                {
+                    ready.push_back({ nextPageToEmit, std::move(results[nextPageToEmit]) });
+                    nextPageToEmit++;
+                }
+
+                if (ready.size() == 0)
+                {
+                    emitting = false;
+                    return;
+                }
+            }
+
+            for (auto& result : ready)
+                callback(result.first, result.second);
+
+            // Free the memory of the page entries
+            ready.clear();
+        }
+    });
+}
+
+void preloadPage(const PdfPage& page, unordered_set<const PdfObject*>& visited,
+    unordered_set<const PdfObject*>& visitedResources)
+{
+    auto contents = page.GetContents();
+    if (contents != nullptr)
+        preloadObject(contents->GetObject(), visited);
+
+    auto resources = page.GetResources();
+    if (resources != nullptr)
+    {
+        preloadObject(resources->GetObject(), visited);
+        preloadResources(*resources, visitedResources);
+    }
+}
+
+// Load the fonts of the resources, and of the resources
+// of the nested forms, and initialize their lazy state
+void preloadResources(const PdfResources& resources, unordered_set<const PdfObject*>& visitedResources)
+{
+    if (!visitedResources.insert(&resources.GetObject()).second)
+        return;
+
+    const PdfDictionary* dict;
+    if (resources.GetDictionary().TryFindKeyAs("Font", dict))
+    {
+        for (auto& pair : *dict)
+        {
+            auto font = resources.GetFont(pair.first);
+            if (font != nullptr)
+                (void)font->GetWordSpacingLength(PdfTextState());
+        }
+    }
+
+    if (resources.GetDictionary().TryFindKeyAs("XObject", dict))
+    {
+        for (auto pair : dict->GetIndirectIterator())
+        {
+            unique_ptr<const PdfXObjectForm> form;
+            if (pair.second == nullptr || !pair.second->IsDictionary()
+                || !PdfXObject::TryCreateFromObject(*pair.second, form))
+                continue;
+
+            auto formResources = form->GetResources();
+            if (formResources != nullptr)
+                preloadResources(*formResources, visitedResources);
+        }
+    }
+}
+
+void preloadObject(const PdfObject& obj, unordered_set<const PdfObject*>& visited)
+{
+    if (!visited.insert(&obj).second)
+        return;
+
+    // NOTE: Accessing the stream also forces
+    // loading the object, if it was delayed
+    (void)obj.GetStream();
+
+    const PdfDictionary* dict;
+    const PdfArray* arr;
+    if (obj.TryGetDictionary(dict))
+    {
+        for (auto pair : dict->GetIndirectIterator())
+        {
+            // Don't climb up trees
+            if (pair.first == "Parent" || pair.second == nullptr)
+                continue;
+
+            preloadObject(*pair.second, visited);
+        }
+    }
+    else if (obj.TryGetArray(arr))
+    {
+        for (auto child : arr->GetIndirectIterator())
+        {
+            if (child != nullptr)
+                preloadObject(*child, visited);
+        }
+    }
+}
@@ -176,6 +176,10 @@ bool PdfEncoding::tryGetCharCode(PdfFont& font, unsigned gid, const unicodeview&
 {
     if (font.IsSubsettingEnabled())
     {
+        // Simple encodings of subset fonts may not map all the code points
+        if (!IsDynamicEncoding() && !GetToUnicodeMapSafe().TryGetCharCode(codePoints, codeUnit))
+            return false;
+
         codeUnit = font.AddSubsetGIDSafe(gid, codePoints).Unit;
         return true;
     }
@@ -708,14 +712,7 @@ bool PdfStringScanContext::IsEndOfString() const
 
 bool PdfStringScanContext::TryScan(PdfCID& cid, string& utf8str, vector<codepoint>& codepoints)
 {
-    bool success = true;
-    if (!m_encoding->TryGetNextCID(m_it, m_end, cid))
-    {
-        PdfCharCode unit = fetchFallbackCharCode(m_it, m_end, m_limits);
-        cid = PdfCID(unit);
-        success = false;
-    }
-
+    bool success = TryScan(cid);
     if (m_toUnicode->TryGetCodePoints(cid.Unit, codepoints))
     {
         for (size_t i = 0; i < codepoints.size(); i++)
@@ -736,5 +733,15 @@ bool PdfStringScanContext::TryScan(PdfCID& cid, string& utf8str, vector<codepoin
     return success;
 }
 
+bool PdfStringScanContext::TryScan(PdfCID& cid)
+{
+    if (m_encoding->TryGetNextCID(m_it, m_end, cid))
+        return true;
+
+    PdfCharCode unit = fetchFallbackCharCode(m_it, m_end, m_limits);
+    cid = PdfCID(unit);
+    return false;
+}
+
 PdfDynamicEncodingMap::PdfDynamicEncodingMap(const shared_ptr<PdfCharCodeMap>& map)
     : PdfEncodingMapBase(map, PdfEncodingMapType::CMap) { }
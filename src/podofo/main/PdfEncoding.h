@@ -35,6 +35,11 @@ namespace PoDoFo
          */
         bool TryScan(PdfCID& cid, std::string& utf8str, std::vector<codepoint>& codepoints);
 
+        /** Advance string reading, with no unicode codepoints retrieval
+         * \return true if success
+         */
+        bool TryScan(PdfCID& cid);
+
     private:
         std::string_view::iterator m_it;
         std::string_view::iterator m_end;
@@ -57,6 +62,7 @@ namespace PoDoFo
         friend class PdfFont;
         friend class PdfFontCID;
         friend class PdfFontCIDTrueType;
+        friend class PdfFontCIDType1;
         friend class PdfFontSimple;
 
     public:
@@ -562,16 +562,17 @@ void PdfBuiltInEncoding::CreateUnicodeToGIDMap(const unordered_map<unsigned, uns
 
 void PdfBuiltInEncoding::initEncodingTable()
 {
-    if (!m_EncodingTable.empty())
-        return;
-
-    const char32_t* cpUnicodeTable = this->GetToUnicodeTable();
-    for (unsigned i = 0; i < 256; i++)
-    {
-        // fill the table with data
-        m_EncodingTable[cpUnicodeTable[i]] =
-            static_cast<unsigned char>(i);
-    }
+    // NOTE: Built-in encodings are global instances
+    // that may be used from multiple threads
+    std::call_once(m_EncodingTableInit, [this]() {
+        const char32_t* cpUnicodeTable = this->GetToUnicodeTable();
+        for (unsigned i = 0; i < 256; i++)
+        {
+            // fill the table with data
+            m_EncodingTable[cpUnicodeTable[i]] =
+                static_cast<unsigned char>(i);
+        }
+    });
 }
 
 bool PdfBuiltInEncoding::tryGetCharCode(char32_t codePoint, PdfCharCode& codeUnit) const
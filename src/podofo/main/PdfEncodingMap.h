@@ -8,6 +8,9 @@
 #define PDF_ENCODING_MAP_H
 
 #include "PdfDeclarations.h"
+
+#include <mutex>
+
 #include "PdfObject.h"
 #include "PdfName.h"
 #include "PdfCharCodeMap.h"
@@ -186,6 +189,7 @@ private:
 class PODOFO_API PdfEncodingMapBase : public PdfEncodingMap
 {
     friend class PdfDynamicEncodingMap;
+    friend class PdfCMapEncoding;
 
 protected:
     PdfEncodingMapBase(PdfCharCodeMap&& map, PdfEncodingMapType type);
@@ -294,6 +298,7 @@ private:
 private:
     PdfName m_Name;         // The name of the encoding
     std::unordered_map<char32_t, char> m_EncodingTable; // The helper table for conversions into this encoding
+    std::once_flag m_EncodingTableInit;
 };
 
 /** Dummy encoding map that will just throw exception
@@ -11,6 +11,8 @@
 
 namespace PoDoFo {
 
+class InputStream;
+
 /** This factory creates a PdfEncodingMap
  */
 class PODOFO_API PdfEncodingMapFactory final
@@ -32,6 +34,30 @@ public:
      */
     static std::unique_ptr<PdfEncodingMap> ParseCMapEncoding(const PdfObject& cmapObj);
 
+    /** Set the maximum number of parsed CMaps retained by the process
+     * wide cache shared by all documents. CMaps with identical content
+     * are parsed only once. 0 disables the cache
+     */
+    static void SetCMapCacheSize(unsigned maxCount);
+
+    /** Get the maximum number of parsed CMaps retained by the process wide cache
+     */
+    static unsigned GetCMapCacheSize();
+
+    /** Clear the process wide cache of parsed CMaps
+     */
+    static void ClearCMapCache();
+
+    /** Write the parsed CMaps currently cached in a compact binary form
+     * \see LoadCMapCache
+     */
+    static void SaveCMapCache(OutputStream& stream);
+
+    /** Load in the cache the CMaps written with SaveCMapCache(),
+     * so they will be reused without parsing them again
+     */
+    static void LoadCMapCache(InputStream& stream);
+
     /** Singleton method which returns a global instance
      *  of WinAnsiEncoding.
      *
@@ -132,6 +132,7 @@ void PdfFont::initBase(const PdfEncoding& encoding)
     m_IsEmbedded = false;
     m_EmbeddingEnabled = false;
     m_SubsettingEnabled = false;
+    m_MinimalSubsetEnabled = false;
     m_cidToGidMap = m_Metrics->GetCIDToGIDMap();
 
     if (encoding.IsNull())
@@ -167,13 +168,14 @@ void PdfFont::WriteStringToStream(OutputStream& stream, const string_view& str)
         utls::SerializeEncodedString(stream, encoded, true);
 }
 
-void PdfFont::InitImported(bool wantEmbed, bool wantSubset)
+void PdfFont::InitImported(bool wantEmbed, bool wantSubset, bool wantMinimalSubset)
 {
     PODOFO_ASSERT(!IsObjectLoaded());
 
     // No embedding implies no subsetting
     m_EmbeddingEnabled = wantEmbed;
     m_SubsettingEnabled = wantEmbed && wantSubset && SupportsSubsetting();
+    m_MinimalSubsetEnabled = m_SubsettingEnabled && wantMinimalSubset;
     if (m_SubsettingEnabled)
     {
         // If it exist a glyph for the space character,
@@ -293,11 +295,20 @@ double PdfFont::GetStringLength(const string_view& str, const PdfTextState& stat
 
 bool PdfFont::TryGetStringLength(const string_view& str, const PdfTextState& state, double& length) const
 {
-    vector<unsigned> gids;
-    bool success = tryConvertToGIDs(str, PdfGlyphAccess::Width, gids);
+    // NOTE: Glyphs are measured one by one with no temporary storage
+    bool success = true;
     length = 0;
-    for (unsigned i = 0; i < gids.size(); i++)
-        length += getGlyphLength(m_Metrics->GetGlyphWidth(gids[i]), state, false);
+    auto it = str.begin();
+    auto end = str.end();
+    unsigned gid;
+    while (it != end)
+    {
+        char32_t cp = utf8::next(it, end);
+        if (!tryGetGIDFallback(cp, PdfGlyphAccess::Width, gid))
+            success = false;
+
+        length += getGlyphLength(m_Metrics->GetGlyphWidth(gid), state, false);
+    }
 
     return success;
 }
@@ -312,12 +323,18 @@ double PdfFont::GetEncodedStringLength(const PdfString& encodedStr, const PdfTex
 
 bool PdfFont::TryGetEncodedStringLength(const PdfString& encodedStr, const PdfTextState& state, double& length) const
 {
-    vector<PdfCID> cids;
     bool success = true;
-    if (!m_Encoding->TryConvertToCIDs(encodedStr, cids))
-        success = false;
+    length = 0;
+    auto context = m_Encoding->StartStringScan(encodedStr);
+    PdfCID cid;
+    while (!context.IsEndOfString())
+    {
+        if (!context.TryScan(cid))
+            success = false;
+
+        length += getGlyphLength(GetCIDLengthRaw(cid.Id), state, false);
+    }
 
-    length = getStringLength(cids, state);
     return success;
 }
 
@@ -589,9 +606,16 @@ void PdfFont::embedFontFileData(PdfObject& descriptor, const PdfName& fontFileNa
 
 void PdfFont::initSpaceDescriptors()
 {
-    if (m_WordSpacingLengthRaw >= 0)
-        return;
+    // NOTE: The descriptors are lazily computed also from const
+    // accessors, which may be called concurrently (eg. when extracting
+    // text from pages in parallel)
+    std::call_once(m_SpaceDescriptorsInit, [this]() {
+        computeSpaceDescriptors();
+    });
+}
 
+void PdfFont::computeSpaceDescriptors()
+{
     // TODO: Maybe try looking up other characters if U' ' is missing?
     // https://docs.microsoft.com/it-it/dotnet/api/system.char.iswhitespace
     unsigned gid;
@@ -627,15 +651,6 @@ void PdfFont::initImported()
     // By default do nothing
 }
 
-double PdfFont::getStringLength(const vector<PdfCID>& cids, const PdfTextState& state) const
-{
-    double length = 0;
-    for (auto& cid : cids)
-        length += getGlyphLength(GetCIDLengthRaw(cid.Id), state, false);
-
-    return length;
-}
-
 double PdfFont::GetLineSpacing(const PdfTextState& state) const
 {
     return m_Metrics->GetLineSpacing() * state.FontSize;
@@ -714,76 +729,48 @@ PdfCharCode PdfFont::AddCharCodeSafe(unsigned gid, const unicodeview& codePoints
     return code;
 }
 
-bool PdfFont::tryConvertToGIDs(const std::string_view& utf8Str, PdfGlyphAccess access, std::vector<unsigned>& gids) const
+bool PdfFont::tryGetGIDFallback(char32_t codePoint, PdfGlyphAccess access, unsigned& gid) const
 {
-    bool success = true;
     if (IsObjectLoaded() || !m_Metrics->HasUnicodeMapping())
     {
         // NOTE: This is a best effort strategy. It's not intended to
         // be accurate in loaded fonts
-        auto it = utf8Str.begin();
-        auto end = utf8Str.end();
-
-        auto& toUnicode = m_Encoding->GetToUnicodeMapSafe();
-        while (it != end)
+        PdfCharCode codeUnit;
+        unsigned cid;
+        if (m_Encoding->GetToUnicodeMapSafe().TryGetCharCode(codePoint, codeUnit))
         {
-            char32_t cp = utf8::next(it, end);
-            PdfCharCode codeUnit;
-            unsigned cid;
-            unsigned gid;
-            if (toUnicode.TryGetCharCode(cp, codeUnit))
+            if (m_Encoding->TryGetCIDId(codeUnit, cid))
             {
-                if (m_Encoding->TryGetCIDId(codeUnit, cid))
-                {
-                    if (!TryMapCIDToGID(cid, access, gid))
-                    {
-                        // Fallback
-                        gid = cid;
-                        success = false;
-                    }
-                }
-                else
-                {
-                    // Fallback
-                    gid = codeUnit.Code;
-                    success = false;
-                }
+                if (TryMapCIDToGID(cid, access, gid))
+                    return true;
+
+                // Fallback
+                gid = cid;
+                return false;
             }
             else
             {
                 // Fallback
-                gid = cp;
-                success = false;
+                gid = codeUnit.Code;
+                return false;
             }
-
-            gids.push_back(gid);
+        }
+        else
+        {
+            // Fallback
+            gid = codePoint;
+            return false;
         }
     }
     else
     {
-        auto it = utf8Str.begin();
-        auto end = utf8Str.end();
-        while (it != end)
-        {
-            char32_t cp = utf8::next(it, end);
-            unsigned gid;
-            if (!m_Metrics->TryGetGID(cp, gid))
-            {
-                // Fallback
-                gid = cp;
-                success = false;
-            }
-
-            gids.push_back(gid);
-        }
+        if (m_Metrics->TryGetGID(codePoint, gid))
+            return true;
 
-        // Try to subsistute GIDs for fonts that support
-        // a glyph substitution mechanism
-        vector<unsigned char> backwardMap;
-        m_Metrics->SubstituteGIDs(gids, backwardMap);
+        // Fallback
+        gid = codePoint;
+        return false;
     }
-
-    return success;
 }
 
 bool PdfFont::tryAddSubsetGID(unsigned gid, const unicodeview& codePoints, PdfCID& cid)
@@ -800,6 +787,7 @@ bool PdfFont::tryAddSubsetGID(unsigned gid, const unicodeview& codePoints, PdfCI
         if (!inserted.second)
             return false;
 
+        m_SubsetCIDToGIDs.emplace(cid.Id, gid);
         m_DynamicCIDMap->PushMapping(cid.Unit, cid.Id);
         m_DynamicToUnicodeMap->PushMapping(cid.Unit, codePoints);
         return true;
@@ -900,6 +888,20 @@ bool PdfFont::tryMapCIDToGID(unsigned cid, unsigned& gid) const
 
         return true;
     }
+    else if (m_SubsettingEnabled && m_Encoding->IsDynamicEncoding())
+    {
+        // Dynamic encodings of subset fonts use the
+        // CIDs incrementally assigned to the used GIDs
+        auto found = m_SubsetCIDToGIDs.find(cid);
+        if (found == m_SubsetCIDToGIDs.end())
+        {
+            gid = 0;
+            return false;
+        }
+
+        gid = found->second;
+        return true;
+    }
     else
     {
         // The font is not loaded, hence it's imported:
@@ -10,6 +10,8 @@
 #include "PdfDeclarations.h"
 
 #include <ostream>
+#include <mutex>
+#include <unordered_map>
 
 #include "PdfTextState.h"
 #include "PdfName.h"
@@ -349,6 +351,12 @@ protected:
 
     virtual bool tryMapCIDToGID(unsigned cid, unsigned& gid) const;
 
+    /** True if the subset should contain only the font tables
+     * needed to render the glyphs
+     * \see PdfFontCreateFlags::SubsetMinimalTables
+     */
+    inline bool IsMinimalSubsetEnabled() const { return m_MinimalSubsetEnabled; }
+
     /**
      * Get the raw width of a CID identifier
      */
@@ -382,7 +390,7 @@ private:
      * Perform initialization tasks for fonts imported or created
      * from scratch
      */
-    void InitImported(bool wantEmbed, bool wantSubset);
+    void InitImported(bool wantEmbed, bool wantSubset, bool wantMinimalSubset);
 
     /** Add glyph to used in case of subsetting
      *  It either maps them using the font encoding or generate a new code
@@ -407,13 +415,12 @@ private:
     bool TryMapCIDToGID(unsigned cid, PdfGlyphAccess access, unsigned& gid) const;
 
 private:
-    bool tryConvertToGIDs(const std::string_view& utf8Str, PdfGlyphAccess access, std::vector<unsigned>& gids) const;
+    // Get the GID of the code point, with a fallback value on failure
+    bool tryGetGIDFallback(char32_t codePoint, PdfGlyphAccess access, unsigned& gid) const;
     bool tryAddSubsetGID(unsigned gid, const unicodeview& codePoints, PdfCID& cid);
 
     void initBase(const PdfEncoding& encoding);
 
-    double getStringLength(const std::vector<PdfCID>& cids, const PdfTextState& state) const;
-
     void embedFontFileData(PdfObject& descriptor, const PdfName& fontFileName,
         const std::function<void(PdfDictionary& dict)>& dictWriter, const bufferview& data);
 
@@ -422,16 +429,22 @@ private:
 
     void initSpaceDescriptors();
 
+    void computeSpaceDescriptors();
+
 private:
     std::string m_Name;
     std::string m_SubsetPrefix;
     bool m_EmbeddingEnabled;
     bool m_IsEmbedded;
     bool m_SubsettingEnabled;
+    bool m_MinimalSubsetEnabled;
     UsedGIDsMap m_SubsetGIDs;
+    // Reverse map of the CIDs assigned to the used GIDs of dynamic encodings
+    std::unordered_map<unsigned, unsigned> m_SubsetCIDToGIDs;
     PdfCIDToGIDMapConstPtr m_cidToGidMap;
     double m_WordSpacingLengthRaw;
     double m_SpaceCharLengthRaw;
+    std::once_flag m_SpaceDescriptorsInit;
 
 protected:
     PdfFontMetricsConstPtr m_Metrics;
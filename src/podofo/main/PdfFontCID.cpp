@@ -152,6 +152,35 @@ CIDToGIDMap PdfFontCID::getCIDToGIDMapSubset(const UsedGIDsMap& usedGIDs)
     return ret;
 }
 
+void PdfFontCID::createCIDSet(const UsedGIDsMap& usedGIDs)
+{
+    // We prepare the /CIDSet content now. NOTE: The CIDSet
+    // entry is optional and it's actually deprecated in PDF 2.0
+    // but it's required for PDFA/1 compliance in subset CID fonts
+    string cidSetData;
+    for (auto& pair : usedGIDs)
+    {
+        // ISO 32000-1:2008: Table 124 – Additional font descriptor entries for CIDFonts
+        // CIDSet "The stream’s data shall be organized as a table of bits
+        // indexed by CID. The bits shall be stored in bytes with the
+        // high - order bit first.Each bit shall correspond to a CID.
+        // The most significant bit of the first byte shall correspond
+        // to CID 0, the next bit to CID 1, and so on"
+
+        static const char bits[] = { '\x80', '\x40', '\x20', '\x10', '\x08', '\x04', '\x02', '\x01' };
+        unsigned cid = pair.second.Id;
+        unsigned dataIndex = cid >> 3;
+        if (cidSetData.size() < dataIndex + 1)
+            cidSetData.resize(dataIndex + 1);
+
+        cidSetData[dataIndex] |= bits[cid & 7];
+    }
+
+    auto& cidSetObj = GetDocument().GetObjects().CreateDictionaryObject();
+    cidSetObj.GetOrCreateStream().SetData(cidSetData);
+    GetDescriptor().GetDictionary().AddKeyIndirect("CIDSet", cidSetObj);
+}
+
 WidthExporter::WidthExporter(unsigned cid, unsigned width)
 {
     reset(cid, width);
@@ -7,6 +7,8 @@
 #include <podofo/private/PdfDeclarationsPrivate.h>
 #include "PdfFontCIDType1.h"
 
+#include <podofo/private/FontCFFSubset.h>
+
 using namespace std;
 using namespace PoDoFo;
 
@@ -15,8 +17,8 @@ PdfFontCIDType1::PdfFontCIDType1(PdfDocument& doc, const PdfFontMetricsConstPtr&
 
 bool PdfFontCIDType1::SupportsSubsetting() const
 {
-    // Not yet supported
-    return false;
+    // Only CFF based fonts are supported
+    return GetMetrics().GetFontFileType() == PdfFontFileType::Type1CCF;
 }
 
 PdfFontType PdfFontCIDType1::GetType() const
@@ -26,5 +28,20 @@ PdfFontType PdfFontCIDType1::GetType() const
 
 void PdfFontCIDType1::embedFontSubset()
 {
-    PODOFO_RAISE_ERROR(PdfErrorCode::NotImplemented);
+    auto& usedGIDs = GetUsedGIDs();
+    // Prepare a CID to GID for the subsetting
+    CIDToGIDMap cidToGidMap = getCIDToGIDMapSubset(usedGIDs);
+    createWidths(GetDescendantFont().GetDictionary(), cidToGidMap);
+    m_Encoding->ExportToFont(*this);
+
+    // Prepare a gid list to be used for subsetting. The
+    // subset glyphs are renumbered so the CIDs equal the GIDs
+    vector<unsigned> gids;
+    for (auto& pair : cidToGidMap)
+        gids.push_back(pair.second);
+
+    charbuff buffer;
+    FontCFFSubset::BuildFont(buffer, GetMetrics(), gids);
+    EmbedFontFileType1CCF(GetDescriptor(), buffer);
+    createCIDSet(usedGIDs);
 }
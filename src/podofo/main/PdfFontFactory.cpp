@@ -30,11 +30,12 @@ unique_ptr<PdfFont> PdfFont::Create(PdfDocument& doc, const PdfFontMetricsConstP
     bool embeddingEnabled = (createParams.Flags & PdfFontCreateFlags::DontEmbed) == PdfFontCreateFlags::None;
     bool subsettingEnabled = (createParams.Flags & PdfFontCreateFlags::DontSubset) == PdfFontCreateFlags::None;
     bool preferNonCid = (createParams.Flags & PdfFontCreateFlags::PreferNonCID) != PdfFontCreateFlags::None;
+    bool minimalSubset = (createParams.Flags & PdfFontCreateFlags::SubsetMinimalTables) != PdfFontCreateFlags::None;
 
     auto font = createFontForType(doc, metrics, createParams.Encoding,
         metrics->GetFontFileType(), preferNonCid);
     if (font != nullptr)
-        font->InitImported(embeddingEnabled, subsettingEnabled);
+        font->InitImported(embeddingEnabled, subsettingEnabled, minimalSubset);
 
     return font;
 }
@@ -202,7 +203,7 @@ unique_ptr<PdfFont> PdfFont::CreateStandard14(PdfDocument& doc, PdfStandard14Fon
         font.reset(new PdfFontCIDType1(doc, metrics, createParams.Encoding));
 
     if (font != nullptr)
-        font->InitImported(embeddingEnabled, subsettingEnabled);
+        font->InitImported(embeddingEnabled, subsettingEnabled, false);
 
     return font;
 }
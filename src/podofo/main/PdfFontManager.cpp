@@ -8,6 +8,7 @@
 #include "PdfFontManager.h"
 
 #include <algorithm>
+#include <list>
 #include <podofo/private/FileSystem.h>
 
 #if defined(_WIN32) && defined(PODOFO_HAVE_WIN32GDI)
@@ -19,6 +20,7 @@
 #include <utf8cpp/utf8.h>
 
 #include "PdfDictionary.h"
+#include "PdfDocument.h"
 #include <podofo/auxiliary/InputDevice.h>
 #include <podofo/auxiliary/OutputDevice.h>
 #include "PdfFont.h"
@@ -44,9 +46,208 @@ shared_ptr<PdfFontConfigWrapper> PdfFontManager::m_fontConfig;
 #endif
 
 static constexpr unsigned SUBSET_PREFIX_LEN = 6;
+static constexpr unsigned DEFAULT_SHARED_METRICS_CACHE_SIZE = 32;
+
+namespace
+{
+    struct MetricsKey
+    {
+        string FilePath;
+        unsigned FaceIndex;
+
+        bool operator==(const MetricsKey& rhs) const
+        {
+            return FaceIndex == rhs.FaceIndex && FilePath == rhs.FilePath;
+        }
+    };
+
+    struct QueryKey
+    {
+        string Pattern;
+        bool HasStyle;
+        PdfFontStyle Style;
+        PdfFontMatchBehaviorFlags MatchBehavior;
+
+        bool operator==(const QueryKey& rhs) const
+        {
+            return HasStyle == rhs.HasStyle && Style == rhs.Style
+                && MatchBehavior == rhs.MatchBehavior && Pattern == rhs.Pattern;
+        }
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const MetricsKey& key) const
+        {
+            size_t hash = 0;
+            utls::hash_combine(hash, key.FilePath, key.FaceIndex);
+            return hash;
+        }
+
+        size_t operator()(const QueryKey& key) const
+        {
+            size_t hash = 0;
+            utls::hash_combine(hash, key.Pattern, key.HasStyle,
+                (unsigned)key.Style, (unsigned)key.MatchBehavior);
+            return hash;
+        }
+    };
+
+    /** A process wide cache of font search results and of
+     * font metrics, with their font file data, shared by
+     * all the documents
+     */
+    class SharedFontCache final
+    {
+    public:
+        SharedFontCache()
+            : m_maxSize(DEFAULT_SHARED_METRICS_CACHE_SIZE) { }
+
+    public:
+        bool TryGetQuery(const QueryKey& key, MetricsKey& result)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto found = m_queries.find(key);
+            if (found == m_queries.end())
+                return false;
+
+            result = found->second;
+            return true;
+        }
+
+        void AddQuery(const QueryKey& key, const MetricsKey& result)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_maxSize == 0)
+                return;
+
+            m_queries[key] = result;
+        }
+
+        PdfFontMetricsConstPtr GetMetrics(const MetricsKey& key)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto found = m_metrics.find(key);
+            if (found == m_metrics.end())
+                return nullptr;
+
+            auto ret = found->second.Metrics.lock();
+            if (ret == nullptr)
+            {
+                // The metrics was evicted and it's not used anymore
+                m_metrics.erase(found);
+                return nullptr;
+            }
+
+            touch(found->second, key, ret);
+            return ret;
+        }
+
+        PdfFontMetricsConstPtr AddMetrics(const MetricsKey& key, const PdfFontMetricsConstPtr& metrics)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_maxSize == 0)
+                return metrics;
+
+            auto& entry = m_metrics[key];
+            auto existing = entry.Metrics.lock();
+            if (existing != nullptr)
+            {
+                // Another thread created the same metrics in the meantime
+                touch(entry, key, existing);
+                return existing;
+            }
+
+            entry.Metrics = metrics;
+            entry.Retained = m_retained.end();
+            touch(entry, key, metrics);
+            return metrics;
+        }
+
+        void SetMaxSize(unsigned maxSize)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_maxSize = maxSize;
+            if (maxSize == 0)
+            {
+                clear();
+                return;
+            }
+
+            trim();
+        }
+
+        void Clear()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            clear();
+        }
+
+        void ClearQueries()
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_queries.clear();
+        }
+
+    private:
+        using RetainedList = list<pair<MetricsKey, PdfFontMetricsConstPtr>>;
+
+        struct Entry
+        {
+            // Metrics still in use are found even after they
+            // have been evicted from the retained list
+            weak_ptr<const PdfFontMetrics> Metrics;
+            RetainedList::iterator Retained;
+        };
+
+    private:
+        // Move the metrics to the front of the most recently used list
+        void touch(Entry& entry, const MetricsKey& key, const PdfFontMetricsConstPtr& metrics)
+        {
+            if (entry.Retained == m_retained.end())
+            {
+                m_retained.push_front({ key, metrics });
+                entry.Retained = m_retained.begin();
+                trim();
+            }
+            else
+            {
+                m_retained.splice(m_retained.begin(), m_retained, entry.Retained);
+            }
+        }
+
+        void trim()
+        {
+            while (m_retained.size() > m_maxSize)
+            {
+                auto found = m_metrics.find(m_retained.back().first);
+                PODOFO_ASSERT(found != m_metrics.end());
+                found->second.Retained = m_retained.end();
+                m_retained.pop_back();
+            }
+        }
+
+        void clear()
+        {
+            m_queries.clear();
+            m_metrics.clear();
+            m_retained.clear();
+        }
+
+    private:
+        std::mutex m_mutex;
+        unsigned m_maxSize;
+        unordered_map<QueryKey, MetricsKey, KeyHash> m_queries;
+        unordered_map<MetricsKey, Entry, KeyHash> m_metrics;
+        RetainedList m_retained;
+    };
+}
+
+static SharedFontCache& getSharedCache();
+static PdfFontMetricsConstPtr getOrCreateSharedMetrics(const string_view& filepath, unsigned faceIndex);
 
 PdfFontManager::PdfFontManager(PdfDocument& doc)
-    : m_doc(&doc)
+    : m_doc(&doc), m_fontFilesIndexed(false)
 {
     m_currentPrefix = "AAAAAA+";
 }
@@ -54,7 +255,10 @@ PdfFontManager::PdfFontManager(PdfDocument& doc)
 void PdfFontManager::Clear()
 {
     m_cachedQueries.clear();
+    m_cachedData.clear();
     m_fonts.clear();
+    m_fontFiles.clear();
+    m_fontFilesIndexed = false;
 }
 
 string PdfFontManager::GenerateSubsetPrefix()
@@ -96,6 +300,8 @@ const PdfFont* PdfFontManager::GetLoadedFont(const PdfResources& resources, cons
     if (fontObj == nullptr)
         PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "A font with name {} was not found", name);
 
+    std::lock_guard<std::mutex> lock(m_loadedFontsMutex);
+
     if (fontObj->IsIndirect())
     {
         auto found = m_fonts.find(fontObj->GetIndirectReference());
@@ -203,7 +409,11 @@ PdfFont& PdfFontManager::GetOrCreateFont(const string_view& fontPath, unsigned f
     if (found != m_cachedPaths.end())
         return *found->second;
 
-    auto& ret = getOrCreateFontHashed(PdfFontMetrics::Create(fontPath, faceIndex), params);
+    auto metrics = getOrCreateSharedMetrics(normalizedPath, faceIndex);
+    if (metrics == nullptr)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Could not load font {}", fontPath);
+
+    auto& ret = getOrCreateFontHashed(metrics, params);
     m_cachedPaths[descriptor] = &ret;
     return ret;
 }
@@ -220,24 +430,139 @@ PdfFont& PdfFontManager::GetOrCreateFont(const PdfFontMetricsConstPtr& metrics,
 
 PdfFont& PdfFontManager::GetOrCreateFontFromBuffer(const bufferview& buffer, unsigned faceIndex, const PdfFontCreateParams& params)
 {
-    return getOrCreateFontHashed(PdfFontMetrics::CreateFromBuffer(buffer, faceIndex), params);
+    if (faceIndex == 0)
+    {
+        // Try to find a font with identical data before parsing it.
+        // NOTE: Data of fonts from collections is extracted,
+        // so they are found only after creating the metrics
+        auto found = findFontByData(buffer, utls::HashData(buffer), params);
+        if (found != nullptr)
+            return *found;
+    }
+
+    auto metrics = PdfFontMetrics::CreateFromBuffer(buffer, faceIndex);
+    if (metrics == nullptr)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Could not load font from buffer");
+
+    return getOrCreateFontHashed(std::move(metrics), params);
 }
 
 PdfFont& PdfFontManager::getOrCreateFontHashed(const PdfFontMetricsConstPtr& metrics, const PdfFontCreateParams& params)
 {
-    // TODO: Create a map indexed only on the hash of the font data
-    // and search on that. Then remove the following
-    Descriptor descriptor(metrics->GetFontNameSafe(),
-        PdfStandard14FontType::Unknown,
-        params.Encoding,
-        true,
-        metrics->GetStyle());
-    auto& fonts = m_cachedQueries[descriptor];
-    if (fonts.size() != 0)
-        return *fonts[0];
+    auto data = metrics->GetOrLoadFontFileData();
+    if (data.size() == 0)
+    {
+        // Without font data, fallback matching the font name and style
+        Descriptor descriptor(metrics->GetFontNameSafe(),
+            PdfStandard14FontType::Unknown,
+            params.Encoding,
+            true,
+            metrics->GetStyle());
+        auto& fonts = m_cachedQueries[descriptor];
+        if (fonts.size() != 0)
+            return *fonts[0];
+
+        auto newfont = PdfFont::Create(*m_doc, metrics, params);
+        return *addImported(fonts, std::move(newfont));
+    }
+
+    size_t dataHash = utls::HashData(data);
+    auto found = findFontByData(data, dataHash, params);
+    if (found != nullptr)
+        return *found;
+
+    auto ret = AddImported(PdfFont::Create(*m_doc, metrics, params));
+    m_cachedData[DataDescriptor(dataHash, params.Encoding)].push_back(ret);
+    return *ret;
+}
+
+PdfFont* PdfFontManager::findFontByData(const bufferview& data, size_t dataHash, const PdfFontCreateParams& params)
+{
+    auto found = m_cachedData.find(DataDescriptor(dataHash, params.Encoding));
+    if (found == m_cachedData.end())
+        return nullptr;
+
+    // Verify the data to exclude hash collisions
+    for (auto font : found->second)
+    {
+        auto fontData = font->GetMetrics().GetOrLoadFontFileData();
+        if (fontData.size() == data.size()
+            && std::memcmp(fontData.data(), data.data(), data.size()) == 0)
+        {
+            return font;
+        }
+    }
+
+    return nullptr;
+}
+
+void PdfFontManager::ShareFontFiles(const vector<PdfObject*>& objects)
+{
+    auto processDescriptor = [this](PdfObject& obj) {
+        PdfDictionary* dict;
+        if (!obj.TryGetDictionary(dict)
+            || dict->FindKeyAs<PdfName>("Type") != "FontDescriptor")
+        {
+            return;
+        }
+
+        shareFontFile(*dict, "FontFile");
+        shareFontFile(*dict, "FontFile2");
+        shareFontFile(*dict, "FontFile3");
+    };
+
+    if (!m_fontFilesIndexed)
+    {
+        // Index the font programs already in the document the
+        // first time. The given objects are part of the document
+        for (auto obj : m_doc->GetObjects())
+            processDescriptor(*obj);
+
+        m_fontFilesIndexed = true;
+    }
+    else
+    {
+        for (auto obj : objects)
+            processDescriptor(*obj);
+    }
+}
+
+void PdfFontManager::shareFontFile(PdfDictionary& descriptor, const PdfName& fontFileKey)
+{
+    auto fontFileObj = descriptor.GetKey(fontFileKey);
+    if (fontFileObj == nullptr || !fontFileObj->IsReference())
+        return;
 
-    auto newfont = PdfFont::Create(*m_doc, metrics, params);
-    return *addImported(fonts, std::move(newfont));
+    auto& objects = m_doc->GetObjects();
+    auto fontFileRef = fontFileObj->GetReference();
+    auto fontFile = objects.GetObject(fontFileRef);
+    if (fontFile == nullptr || !fontFile->HasStream())
+        return;
+
+    auto data = fontFile->GetStream()->GetCopy(true);
+    size_t dataHash = utls::HashData(data);
+    auto range = m_fontFiles.equal_range(dataHash);
+    for (auto it = range.first; it != range.second; it++)
+    {
+        if (it->second == fontFileRef)
+            return;
+
+        // Verify the candidate is still an identical font
+        // program, to exclude hash collisions and changes
+        auto candidate = objects.GetObject(it->second);
+        if (candidate == nullptr
+            || !candidate->HasStream()
+            || candidate->GetDictionary() != fontFile->GetDictionary()
+            || candidate->GetStream()->GetCopy(true) != data)
+        {
+            continue;
+        }
+
+        descriptor.AddKey(fontFileKey, it->second);
+        return;
+    }
+
+    m_fontFiles.insert({ dataHash, fontFileRef });
 }
 
 void PdfFontManager::adaptSearchParams(string& fontName, PdfFontSearchParams& searchParams)
@@ -315,6 +640,8 @@ void PdfFontManager::AddFontDirectory(const string_view& path)
     auto& fc = GetFontConfigWrapper();
     fc.AddFontDirectory(path);
 #endif
+    // New fonts may change the results of cached queries
+    getSharedCache().ClearQueries();
 #if defined(_WIN32) && defined(PODOFO_HAVE_WIN32GDI)
     string fontDir(path);
     if (fontDir[fontDir.size() - 1] != '\\')
@@ -347,25 +674,34 @@ void PdfFontManager::AddFontDirectory(const string_view& path)
 #endif
 }
 
-unique_ptr<const PdfFontMetrics> PdfFontManager::getFontMetrics(const string_view& fontName,
+PdfFontMetricsConstPtr PdfFontManager::getFontMetrics(const string_view& fontName,
     const PdfFontSearchParams& params)
 {
-    string path;
-    unsigned faceIndex = 0;
+    MetricsKey found{ { }, 0 };
 #ifdef PODOFO_HAVE_FONTCONFIG
-    PdfFontConfigSearchParams fcParams;
-    fcParams.Style = params.Style;
-    fcParams.Flags = (params.MatchBehavior & PdfFontMatchBehaviorFlags::MatchPostScriptName) == PdfFontMatchBehaviorFlags::None
-        ? PdfFontConfigSearchFlags::None
-        : PdfFontConfigSearchFlags::MatchPostScriptName;
-
-    auto& fc = GetFontConfigWrapper();
-    path = fc.SearchFontPath(fontName, fcParams, faceIndex);
+    // Font queries are cached process wide, since
+    // searching with fontconfig is expensive
+    QueryKey query{ (string)fontName, params.Style.has_value(),
+        params.Style.has_value() ? *params.Style : PdfFontStyle::Regular,
+        params.MatchBehavior & PdfFontMatchBehaviorFlags::MatchPostScriptName };
+    auto& cache = getSharedCache();
+    if (!cache.TryGetQuery(query, found))
+    {
+        PdfFontConfigSearchParams fcParams;
+        fcParams.Style = params.Style;
+        fcParams.Flags = (params.MatchBehavior & PdfFontMatchBehaviorFlags::MatchPostScriptName) == PdfFontMatchBehaviorFlags::None
+            ? PdfFontConfigSearchFlags::None
+            : PdfFontConfigSearchFlags::MatchPostScriptName;
+
+        auto& fc = GetFontConfigWrapper();
+        found.FilePath = fc.SearchFontPath(fontName, fcParams, found.FaceIndex);
+        cache.AddQuery(query, found);
+    }
 #endif
 
-    unique_ptr<const PdfFontMetrics> ret = nullptr;
-    if (!path.empty())
-        ret = PdfFontMetrics::Create(path, faceIndex);
+    PdfFontMetricsConstPtr ret;
+    if (!found.FilePath.empty())
+        ret = getOrCreateSharedMetrics(found.FilePath, found.FaceIndex);
 
     if (ret == nullptr)
     {
@@ -384,6 +720,16 @@ unique_ptr<const PdfFontMetrics> PdfFontManager::getFontMetrics(const string_vie
     return ret;
 }
 
+void PdfFontManager::SetSharedCacheSize(unsigned maxCount)
+{
+    getSharedCache().SetMaxSize(maxCount);
+}
+
+void PdfFontManager::ClearSharedCache()
+{
+    getSharedCache().Clear();
+}
+
 void PdfFontManager::EmbedFonts()
 {
     // Embed all imported fonts
@@ -396,6 +742,38 @@ void PdfFontManager::EmbedFonts()
     // Clear imported font cache
     // TODO: Don't clean standard14 and full embedded fonts
     m_cachedQueries.clear();
+    m_cachedData.clear();
+}
+
+SharedFontCache& getSharedCache()
+{
+    // NOTE: Initialize FreeType before the cache, so the cached
+    // faces are released before the library at exit
+    (void)FT::GetLibrary();
+    static SharedFontCache s_cache;
+    return s_cache;
+}
+
+PdfFontMetricsConstPtr getOrCreateSharedMetrics(const string_view& filepath, unsigned faceIndex)
+{
+    MetricsKey key{ (string)filepath, faceIndex };
+    auto& cache = getSharedCache();
+    auto ret = cache.GetMetrics(key);
+    if (ret != nullptr)
+        return ret;
+
+    // NOTE: Create the metrics outside the lock, since it reads the font file
+    PdfFontMetricsConstPtr metrics = PdfFontMetrics::Create(filepath, faceIndex);
+    if (metrics == nullptr)
+        return nullptr;
+
+    // Initialize lazily computed properties before sharing
+    // the metrics, so they can be read concurrently
+    (void)metrics->GetFontNameSafe();
+    (void)metrics->GetBaseFontNameSafe();
+    (void)metrics->GetStyle();
+    (void)metrics->GetFontFileLength1();
+    return cache.AddMetrics(key, metrics);
 }
 
 #if defined(_WIN32) && defined(PODOFO_HAVE_WIN32GDI)
@@ -485,6 +863,7 @@ void PdfFontManager::SetFontConfigWrapper(const shared_ptr<PdfFontConfigWrapper>
         PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidHandle, "Fontconfig wrapper can't be null");
 
     m_fontConfig = fontConfig;
+    getSharedCache().ClearQueries();
 }
 
 PdfFontConfigWrapper& PdfFontManager::GetFontConfigWrapper()
@@ -526,6 +905,16 @@ size_t PdfFontManager::HashElement::operator()(const Descriptor& elem) const
     return hash;
 }
 
+PdfFontManager::DataDescriptor::DataDescriptor(size_t dataHash, const PdfEncoding& encoding)
+    : DataHash(dataHash), EncodingId(encoding.GetId()) { }
+
+size_t PdfFontManager::HashElement::operator()(const DataDescriptor& elem) const
+{
+    size_t hash = 0;
+    utls::hash_combine(hash, elem.DataHash, elem.EncodingId);
+    return hash;
+}
+
 size_t PdfFontManager::HashElement::operator()(const PathDescriptor& elem) const
 {
     size_t hash = 0;
@@ -549,6 +938,12 @@ bool PdfFontManager::EqualElement::operator()(const PathDescriptor& lhs, const P
         && lhs.EncodingId == rhs.EncodingId;
 }
 
+bool PdfFontManager::EqualElement::operator()(const DataDescriptor& lhs, const DataDescriptor& rhs) const
+{
+    return lhs.DataHash == rhs.DataHash
+        && lhs.EncodingId == rhs.EncodingId;
+}
+
 #if defined(_WIN32) && defined(PODOFO_HAVE_WIN32GDI)
 
 // Returned font data is also extracted from collections
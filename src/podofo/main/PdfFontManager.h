@@ -9,6 +9,8 @@
 
 #include "PdfDeclarations.h"
 
+#include <mutex>
+
 #include "PdfFont.h"
 #include "PdfEncodingFactory.h"
 
@@ -114,6 +116,18 @@ public:
     static PdfFontConfigWrapper& GetFontConfigWrapper();
 #endif // PODOFO_HAVE_FONTCONFIG
 
+    /** Set the maximum number of font metrics, including their font
+     * file data, retained by the process wide cache shared by all
+     * documents. Metrics still in use by some document are reused
+     * regardless of the limit. 0 disables the cache
+     * \remarks Font search results are also cached process wide
+     */
+    static void SetSharedCacheSize(unsigned maxCount);
+
+    /** Clear the process wide cache of font metrics and font search results
+     */
+    static void ClearSharedCache();
+
     /** Called by PdfDocument before saving
      */
     void EmbedFonts();
@@ -140,6 +154,13 @@ private:
 
     static void AddFontDirectory(const std::string_view& path);
 
+    /** Make font descriptors among the given objects refer to
+     * identical font programs already in the document, so
+     * duplicated ones are dropped when collecting garbage.
+     * Used when appending documents
+     */
+    void ShareFontFiles(const std::vector<PdfObject*>& objects);
+
 private:
     /** A private structure, which represents a cached font
      */
@@ -168,20 +189,33 @@ private:
         const unsigned EncodingId;
     };
 
+    /** A descriptor of a font by the hash of its font file data
+     */
+    struct DataDescriptor
+    {
+        DataDescriptor(size_t dataHash, const PdfEncoding& encoding);
+        DataDescriptor(const DataDescriptor& rhs) = default;
+        const size_t DataHash;
+        const unsigned EncodingId;
+    };
+
     struct HashElement
     {
         size_t operator()(const Descriptor& elem) const;
         size_t operator()(const PathDescriptor& elem) const;
+        size_t operator()(const DataDescriptor& elem) const;
     };
 
     struct EqualElement
     {
         bool operator()(const Descriptor& lhs, const Descriptor& rhs) const;
         bool operator()(const PathDescriptor& lhs, const PathDescriptor& rhs) const;
+        bool operator()(const DataDescriptor& lhs, const DataDescriptor& rhs) const;
     };
 
     using CachedPaths = std::unordered_map<PathDescriptor, PdfFont*, HashElement, EqualElement>;
     using CachedQueries = std::unordered_map<Descriptor, std::vector<PdfFont*>, HashElement, EqualElement>;
+    using CachedData = std::unordered_map<DataDescriptor, std::vector<PdfFont*>, HashElement, EqualElement>;
 
     struct Storage
     {
@@ -196,7 +230,7 @@ private:
     static std::shared_ptr<PdfFontConfigWrapper> ensureInitializedFontConfig();
 #endif // PODOFO_HAVE_FONTCONFIG
 
-    static std::unique_ptr<const PdfFontMetrics> getFontMetrics(const std::string_view& fontName,
+    static PdfFontMetricsConstPtr getFontMetrics(const std::string_view& fontName,
         const PdfFontSearchParams& params);
     PdfFont* getImportedFont(const std::string_view& patternName,
         const PdfFontSearchParams& searchParams, const PdfFontCreateParams& createParams);
@@ -204,6 +238,8 @@ private:
         PdfFontSearchParams& searchParams);
     PdfFont* addImported(std::vector<PdfFont*>& fonts, std::unique_ptr<PdfFont>&& font);
     PdfFont& getOrCreateFontHashed(const PdfFontMetricsConstPtr& metrics, const PdfFontCreateParams& params);
+    PdfFont* findFontByData(const bufferview& data, size_t dataHash, const PdfFontCreateParams& params);
+    void shareFontFile(PdfDictionary& descriptor, const PdfName& fontFileKey);
 
 #if defined(_WIN32) && defined(PODOFO_HAVE_WIN32GDI)
     static std::unique_ptr<charbuff> getWin32FontData(const std::string_view& fontName,
@@ -223,6 +259,11 @@ private:
 
     // Map of cached font paths
     CachedPaths m_cachedPaths;
+    // Map of fonts by the hash of their font file data
+    CachedData m_cachedData;
+    // Font program streams by the hash of their raw data
+    std::unordered_multimap<size_t, PdfReference> m_fontFiles;
+    bool m_fontFilesIndexed;
 
     // Map of all indirect fonts
     FontMap m_fonts;
@@ -230,6 +271,10 @@ private:
     // Map of all invalid inline fonts
     std::unordered_map<std::string, std::unique_ptr<PdfFont>> m_inlineFonts;
 
+    // Guards loaded fonts, that can be queried concurrently
+    // during parallel text extraction
+    std::mutex m_loadedFontsMutex;
+
 #ifdef PODOFO_HAVE_FONTCONFIG
     static std::shared_ptr<PdfFontConfigWrapper> m_fontConfig;
 #endif
@@ -354,7 +354,7 @@ const PdfCIDToGIDMapConstPtr& PdfFontMetrics::getCIDToGIDMap() const
 }
 
 PdfFontMetricsBase::PdfFontMetricsBase()
-    : m_dataInit(false), m_faceInit(false), m_Face(nullptr) { }
+    : m_Face(nullptr) { }
 
 PdfFontMetricsBase::~PdfFontMetricsBase()
 {
@@ -363,28 +363,25 @@ PdfFontMetricsBase::~PdfFontMetricsBase()
 
 const datahandle& PdfFontMetricsBase::GetFontFileDataHandle() const
 {
-    if (!m_dataInit)
-    {
+    // NOTE: Metrics may be shared between documents and
+    // threads (eg. the Standard14 ones), initialize once
+    std::call_once(m_dataInit, [this]() {
         auto& rthis = const_cast<PdfFontMetricsBase&>(*this);
         rthis.m_Data = getFontFileDataHandle();
-        rthis.m_dataInit = true;
-    }
+    });
 
     return m_Data;
 }
 
 FT_Face PdfFontMetricsBase::GetFaceHandle() const
 {
-    if (!m_faceInit)
-    {
+    std::call_once(m_faceInit, [this]() {
         auto& rthis = const_cast<PdfFontMetricsBase&>(*this);
         auto view = GetFontFileDataHandle().view();
         // NOTE: The data always represent a face, collections are not 
         if (view.size() != 0)
             rthis.m_Face = FT::CreateFaceFromBuffer(view);
-
-        rthis.m_faceInit = true;
-    }
+    });
 
     return m_Face;
 }
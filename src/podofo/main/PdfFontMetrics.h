@@ -9,6 +9,8 @@
 
 #include "PdfDeclarations.h"
 
+#include <mutex>
+
 #include "PdfString.h"
 #include "PdfCMapEncoding.h"
 #include "PdfCIDToGIDMap.h"
@@ -355,9 +357,9 @@ protected:
     virtual datahandle getFontFileDataHandle() const = 0;
 
 private:
-    bool m_dataInit;
+    mutable std::once_flag m_dataInit;
     datahandle m_Data;
-    bool m_faceInit;
+    mutable std::once_flag m_faceInit;
     FT_Face m_Face;
 };
 
@@ -10,6 +10,7 @@
 #include <podofo/private/FreetypePrivate.h>
 #include FT_TRUETYPE_TABLES_H
 #include FT_TYPE1_TABLES_H
+#include FT_ADVANCES_H
 
 #include "PdfArray.h"
 #include "PdfDictionary.h"
@@ -319,15 +320,35 @@ unsigned PdfFontMetricsFreetype::GetGlyphCount() const
 
 bool PdfFontMetricsFreetype::TryGetGlyphWidth(unsigned gid, double& width) const
 {
-    if (FT_Load_Glyph(m_Face, gid, FT_LOAD_NO_SCALE | FT_LOAD_NO_BITMAP) != 0)
+    if (gid >= (unsigned)m_Face->num_glyphs)
     {
         width = -1;
         return false;
     }
 
-    // zero return code is success!
-    width = m_Face->glyph->metrics.horiAdvance / (double)m_Face->units_per_EM;
-    return true;
+    std::call_once(m_glyphWidthsInit, [this]() {
+        unsigned glyphCount = (unsigned)m_Face->num_glyphs;
+        m_glyphWidths.reset(new atomic<double>[glyphCount]);
+        for (unsigned i = 0; i < glyphCount; i++)
+            m_glyphWidths[i].store(numeric_limits<double>::quiet_NaN(), memory_order_relaxed);
+    });
+
+    width = m_glyphWidths[gid].load(memory_order_relaxed);
+    if (std::isnan(width))
+    {
+        // The face is shared and not safe for concurrent access
+        std::lock_guard<std::mutex> lock(m_faceMutex);
+        FT_Fixed advance;
+        // zero return code is success!
+        if (FT_Get_Advance(m_Face, gid, FT_LOAD_NO_SCALE | FT_LOAD_NO_BITMAP, &advance) == 0)
+            width = advance / (double)m_Face->units_per_EM;
+        else
+            width = -1;
+
+        m_glyphWidths[gid].store(width, memory_order_relaxed);
+    }
+
+    return width >= 0;
 }
 
 bool PdfFontMetricsFreetype::HasUnicodeMapping() const
@@ -356,6 +377,7 @@ bool PdfFontMetricsFreetype::TryGetGID(char32_t codePoint, unsigned& gid) const
         return true;
     }
 
+    std::lock_guard<std::mutex> lock(m_faceMutex);
     gid = FT_Get_Char_Index(m_Face, codePoint);
     return gid != 0;
 }
@@ -367,6 +389,8 @@ unique_ptr<PdfCMapEncoding> PdfFontMetricsFreetype::CreateToUnicodeMap(const Pdf
     FT_ULong charcode;
     FT_UInt gid;
 
+    // NOTE: Iterating the charmap updates the face state
+    std::lock_guard<std::mutex> lock(m_faceMutex);
     charcode = FT_Get_First_Char(m_Face, &gid);
     while (gid != 0)
     {
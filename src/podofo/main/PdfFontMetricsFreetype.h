@@ -9,6 +9,9 @@
 
 #include "PdfDeclarations.h"
 
+#include <atomic>
+#include <mutex>
+
 #include "PdfFontMetrics.h"
 #include "PdfString.h"
 
@@ -146,6 +149,12 @@ private:
     double m_StrikeThroughThickness;
     double m_StrikeThroughPosition;
 
+    // Glyph widths indexed by GID, lazily filled. Not yet
+    // queried glyphs are NaN, missing ones are negative
+    mutable std::unique_ptr<std::atomic<double>[]> m_glyphWidths;
+    mutable std::once_flag m_glyphWidthsInit;
+    mutable std::mutex m_faceMutex;     // Serializes the FreeType calls on the shared face
+
     bool m_LengthsReady;
     unsigned m_Length1;
     unsigned m_Length2;
@@ -573,11 +573,10 @@ unsigned PdfFontMetricsObject::GetFontFileLength3() const
 
 void PdfFontMetricsObject::extractFontHints()
 {
-    if (m_FontBaseName.length() != 0)
-        return;
-
-    PODOFO_ASSERT(m_FontName.length() != 0);
-    m_FontBaseName = PoDoFo::ExtractFontHints(m_FontName, m_IsItalicHint, m_IsBoldHint);
+    std::call_once(m_FontHintsInit, [this]() {
+        PODOFO_ASSERT(m_FontName.length() != 0);
+        m_FontBaseName = PoDoFo::ExtractFontHints(m_FontName, m_IsItalicHint, m_IsBoldHint);
+    });
 }
 
 vector<double> PdfFontMetricsObject::getBBox(const PdfObject& obj)
@@ -128,6 +128,7 @@ private:
     std::string m_FontName;
     std::string m_FontNameRaw;
     std::string m_FontBaseName;
+    std::once_flag m_FontHintsInit;
     std::string m_FontFamilyName;
     PdfFontStretch m_FontStretch;
     int m_Weight;
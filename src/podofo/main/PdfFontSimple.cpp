@@ -85,6 +85,12 @@ void PdfFontSimple::initImported()
 void PdfFontSimple::embedFont()
 {
     PODOFO_ASSERT(m_Descriptor != nullptr);
+    createWidths();
+    EmbedFontFile(*m_Descriptor);
+}
+
+void PdfFontSimple::createWidths()
+{
     this->GetDictionary().AddKey("FirstChar", PdfVariant(static_cast<int64_t>(m_Encoding->GetFirstChar().Code)));
     this->GetDictionary().AddKey("LastChar", PdfVariant(static_cast<int64_t>(m_Encoding->GetLastChar().Code)));
 
@@ -102,6 +108,4 @@ void PdfFontSimple::embedFont()
         GetBoundingBox(arr);
         GetDictionary().AddKey("FontBBox", std::move(arr));
     }
-
-    EmbedFontFile(*m_Descriptor);
 }
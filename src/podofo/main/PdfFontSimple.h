@@ -43,6 +43,7 @@ protected:
     void initImported() override;
 
 private:
+    void createWidths();
     void getWidthsArray(PdfArray& widths) const;
     void getFontMatrixArray(PdfArray& fontMatrix) const;
 
@@ -16,6 +16,7 @@
 #include "PdfObjectStream.h"
 #include "PdfDifferenceEncoding.h"
 #include "PdfDocument.h"
+#include <podofo/private/FontCFFSubset.h>
 
 using namespace std;
 using namespace PoDoFo;
@@ -28,9 +29,9 @@ PdfFontType1::PdfFontType1(PdfDocument& doc, const PdfFontMetricsConstPtr& metri
 
 bool PdfFontType1::SupportsSubsetting() const
 {
-    // TODO: Re-enable me by fixing below code
-    // return true;
-    return false;
+    // Only CFF based fonts are supported. TODO: Support
+    // Type1 font programs by fixing the code below
+    return GetMetrics().GetFontFileType() == PdfFontFileType::Type1CCF;
 }
 
 PdfFontType PdfFontType1::GetType() const
@@ -38,6 +39,22 @@ PdfFontType PdfFontType1::GetType() const
     return PdfFontType::Type1;
 }
 
+void PdfFontType1::embedFontSubset()
+{
+    PODOFO_ASSERT(m_Descriptor != nullptr);
+    createWidths();
+
+    // Simple fonts address glyphs by name or with the font
+    // builtin encoding, so retain the original glyph order
+    vector<unsigned> gids;
+    for (auto& pair : GetUsedGIDs())
+        gids.push_back(pair.first);
+
+    charbuff buffer;
+    FontCFFSubset::BuildFontRetainGIDs(buffer, GetMetrics(), gids);
+    EmbedFontFileType1CCF(*m_Descriptor, buffer);
+}
+
 /*
 // Helper Class needed for parsing type1-font for subsetting
 class PdfType1Encrypt
@@ -42,7 +42,7 @@ public:
     PdfFontType GetType() const override;
 
 protected:
-    //void embedFontSubset() override;
+    void embedFontSubset() override;
     //void embedFontFile(PdfObject& descriptor) override;
 
 private:
@@ -50,7 +50,9 @@ using namespace PoDoFo;
 
 #ifdef PODOFO_HAVE_PNG_LIB
 #include <png.h>
+#include <zlib.h>
 static void pngReadData(png_structp pngPtr, png_bytep data, png_size_t length);
+static bool tryLoadFromPngIDAT(PdfImage& image, const unsigned char* data, size_t len);
 static void loadFromPngContent(PdfImage& image, png_structp png, png_infop info);
 static void createPngContext(png_structp& png, png_infop& pnginfo);
 #endif // PODOFO_HAVE_PNG_LIB
@@ -76,18 +78,20 @@ void PdfImage::DecodeTo(const bufferspan& buffer, PdfPixelFormat format, int sca
     DecodeTo(stream, format, scanLineSize);
 }
 
-// TODO: Improve performance and format support
+// NOTE: The image data and the /SMask are read incrementally
+// from the filter chain while scan lines are written to the
+// output stream, so no full size staging buffer is needed
+// TODO: Improve format support
 void PdfImage::DecodeTo(OutputStream& stream, PdfPixelFormat format, int scanLineSize) const
 {
     auto istream = GetObject().MustGetStream().GetInputStream();
     auto& mediaFilters = istream.GetMediaFilters();
-    charbuff imageData;
-    ContainerStreamDevice device(imageData);
-    istream.CopyTo(device);
 
     // TODO: Consider premultiplying alpha for buffer formats
     //  that don't have an alpha chnanel. Consider also opt-out flag
-    charbuff smaskData;
+    unique_ptr<const PdfImage> smask;
+    PdfObjectInputStream smaskStream;
+    InputStream* smaskStreamPtr = nullptr;
     switch (format)
     {
         case PdfPixelFormat::RGBA:
@@ -98,12 +102,19 @@ void PdfImage::DecodeTo(OutputStream& stream, PdfPixelFormat format, int scanLin
             auto smaskObj = GetDictionary().FindKey("SMask");
             if (smaskObj != nullptr)
             {
-                unique_ptr<const PdfImage> smask;
-                if (!PdfXObject::TryCreateFromObject(*smaskObj, smask) ||
-                    (smask->GetObject().MustGetStream().CopyTo(smaskData), smaskData.size() < (size_t)m_Width * m_Height))
+                if (!PdfXObject::TryCreateFromObject(*smaskObj, smask)
+                    || smask->GetObject().GetStream() == nullptr
+                    || (size_t)smask->GetWidth() * smask->GetHeight() < (size_t)m_Width * m_Height)
                 {
                     PoDoFo::LogMessage(PdfLogSeverity::Warning, "Invalid /SMask");
-                    smaskData.clear();
+                }
+                else
+                {
+                    smaskStream = smask->GetObject().GetStream()->GetInputStream();
+                    if (smaskStream.GetMediaFilters().size() == 0)
+                        smaskStreamPtr = &smaskStream;
+                    else
+                        PoDoFo::LogMessage(PdfLogSeverity::Warning, "Unsupported /SMask filter");
                 }
             }
             break;
@@ -114,11 +125,8 @@ void PdfImage::DecodeTo(OutputStream& stream, PdfPixelFormat format, int scanLin
 
     if (mediaFilters.size() == 0)
     {
-        if ((size_t)m_ColorSpace->GetSourceScanLineSize(m_Width, m_BitsPerComponent) * m_Height > imageData.size())
-            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnsupportedImageFormat, "The source buffer size is too small");
-
-        utls::FetchImage(stream, format, scanLineSize, (const unsigned char*)imageData.data(),
-            m_Width, m_Height, m_BitsPerComponent, *m_ColorSpace, smaskData);
+        utls::FetchImage(stream, format, scanLineSize, istream,
+            m_Width, m_Height, m_BitsPerComponent, *m_ColorSpace, smaskStreamPtr);
     }
     else
     {
@@ -134,7 +142,7 @@ void PdfImage::DecodeTo(OutputStream& stream, PdfPixelFormat format, int scanLin
                 {
                     InitJpegDecompressContext(ctx, jerr);
 
-                    PoDoFo::jpeg_memory_src(&ctx, reinterpret_cast<JOCTET*>(imageData.data()), imageData.size());
+                    PoDoFo::jpeg_stream_src(&ctx, istream);
 
                     if (jpeg_read_header(&ctx, TRUE) <= 0)
                         PODOFO_RAISE_ERROR(PdfErrorCode::UnexpectedEOF);
@@ -147,7 +155,7 @@ void PdfImage::DecodeTo(OutputStream& stream, PdfPixelFormat format, int scanLin
 
                     jpeg_start_decompress(&ctx);
 
-                    utls::FetchImageJPEG(stream, format, scanLineSize, &ctx, m_Width, m_Height, smaskData);
+                    utls::FetchImageJPEG(stream, format, scanLineSize, &ctx, m_Width, m_Height, smaskStreamPtr);
                 }
                 catch (...)
                 {
@@ -179,11 +187,17 @@ void PdfImage::DecodeTo(OutputStream& stream, PdfPixelFormat format, int scanLin
                     columns = (int)decodeParms->FindKeyAs<int64_t>("Columns", 1728);
                     rows = (int)decodeParms->FindKeyAs<int64_t>("Rows");
                 }
+
+                // NOTE: The fax decoder needs the whole compressed
+                // data, but it still decodes one scan line at time
+                charbuff imageData;
+                BufferStreamDevice device(imageData);
+                istream.CopyTo(device);
                 auto decoder = fxcodec::FaxModule::CreateDecoder(
                     pdfium::span<const uint8_t>((const uint8_t *)imageData.data(), imageData.size()),
                     (int)m_Width, (int)m_Height, k, endOfLine, encodedByteAlign, blackIs1, columns, rows);
 
-                utls::FetchImageCCITT(stream, format, scanLineSize, *decoder, m_Width, m_Height, smaskData);
+                utls::FetchImageCCITT(stream, format, scanLineSize, *decoder, m_Width, m_Height, smaskStreamPtr);
                 break;
             }
             case PdfFilterType::JBIG2Decode:
@@ -311,6 +325,7 @@ void PdfImage::SetData(InputStream& stream, unsigned width, unsigned height, Pdf
     dict.AddKey("Height", static_cast<int64_t>(height));
     dict.AddKey("BitsPerComponent", static_cast<int64_t>(8));
     dict.AddKey("ColorSpace", PdfName(PoDoFo::ToString(colorSpace)));
+    m_ColorSpace = PdfColorSpaceFilterFactory::GetTrivialFilter(colorSpace);
     // Remove possibly existing /Decode array
     dict.RemoveKey("Decode");
 }
@@ -959,9 +974,18 @@ void PdfImage::loadFromPng(const string_view& filename)
             "{} not found or error opening file", filename);
     }
 
+    // NOTE: The whole file is read in memory, so
+    // the compressed image data can be used as is
+    charbuff buffer;
     try
     {
-        loadFromPngHandle(file);
+        char chunk[4096];
+        size_t read;
+        while ((read = fread(chunk, 1, sizeof(chunk), file)) != 0)
+            buffer.append(chunk, read);
+
+        if (ferror(file))
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidDeviceOperation, "Error reading {}", filename);
     }
     catch (...)
     {
@@ -970,32 +994,7 @@ void PdfImage::loadFromPng(const string_view& filename)
     }
 
     fclose(file);
-}
-
-void PdfImage::loadFromPngHandle(FILE* stream)
-{
-    png_byte header[8];
-    if (fread(header, 1, 8, stream) != 8 ||
-        png_sig_cmp(header, 0, 8))
-    {
-        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnsupportedImageFormat, "The file could not be recognized as a PNG file");
-    }
-
-    png_structp png = nullptr;
-    png_infop pnginfo = nullptr;
-    try
-    {
-        createPngContext(png, pnginfo);
-        png_init_io(png, stream);
-        loadFromPngContent(*this, png, pnginfo);
-    }
-    catch (...)
-    {
-        png_destroy_read_struct(&png, &pnginfo, (png_infopp)nullptr);
-        throw;
-    }
-
-    png_destroy_read_struct(&png, &pnginfo, (png_infopp)nullptr);
+    loadFromPngData((const unsigned char*)buffer.data(), buffer.size());
 }
 
 struct PngData
@@ -1034,6 +1033,9 @@ void PdfImage::loadFromPngData(const unsigned char* data, size_t len)
     if (png_sig_cmp(header, 0, 8))
         PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnsupportedImageFormat, "The file could not be recognized as a PNG file");
 
+    if (tryLoadFromPngIDAT(*this, data, len))
+        return;
+
     png_structp png;
     png_infop pnginfo;
     try
@@ -1051,6 +1053,149 @@ void PdfImage::loadFromPngData(const unsigned char* data, size_t len)
     png_destroy_read_struct(&png, &pnginfo, (png_infopp)nullptr);
 }
 
+// Embed the concatenated IDAT chunks as they are, with a /FlateDecode
+// filter and a PNG predictor, when the PNG samples can be used directly
+// as PDF image samples. The pixel data is not decoded nor compressed again
+bool tryLoadFromPngIDAT(PdfImage& image, const unsigned char* data, size_t len)
+{
+    constexpr uint32_t IHDRChunk = 0x49484452;
+    constexpr uint32_t PLTEChunk = 0x504C5445;
+    constexpr uint32_t IDATChunk = 0x49444154;
+    constexpr uint32_t IENDChunk = 0x49454E44;
+    constexpr uint32_t tRNSChunk = 0x74524E53;
+
+    auto readUInt32 = [](const unsigned char* bytes) {
+        return (uint32_t)bytes[0] << 24 | (uint32_t)bytes[1] << 16 | (uint32_t)bytes[2] << 8 | (uint32_t)bytes[3];
+    };
+
+    uint32_t width = 0;
+    uint32_t height = 0;
+    unsigned char depth = 0;
+    unsigned char colorType = 0;
+    bool hasHeader = false;
+    const unsigned char* palette = nullptr;
+    size_t paletteLen = 0;
+    charbuff idat;
+    size_t pos = 8;
+    while (true)
+    {
+        if (len < pos + 12)
+            return false;
+
+        uint32_t chunkLen = readUInt32(data + pos);
+        uint32_t chunkType = readUInt32(data + pos + 4);
+        if (chunkLen > len - pos - 12)
+            return false;
+
+        const unsigned char* chunkData = data + pos + 8;
+        if (crc32(crc32(0, nullptr, 0), data + pos + 4, chunkLen + 4) != readUInt32(chunkData + chunkLen))
+            return false;
+
+        pos += (size_t)chunkLen + 12;
+        if (chunkType == IENDChunk)
+            break;
+
+        if (!hasHeader && chunkType != IHDRChunk)
+            return false;
+
+        switch (chunkType)
+        {
+            case IHDRChunk:
+            {
+                // Require non interlaced images with 8 bits samples
+                // and without alpha channel
+                if (hasHeader || chunkLen != 13)
+                    return false;
+
+                width = readUInt32(chunkData);
+                height = readUInt32(chunkData + 4);
+                depth = chunkData[8];
+                colorType = chunkData[9];
+                if (width == 0 || height == 0 || depth != 8
+                    || (colorType != PNG_COLOR_TYPE_GRAY && colorType != PNG_COLOR_TYPE_RGB
+                        && colorType != PNG_COLOR_TYPE_PALETTE)
+                    || chunkData[10] != 0 || chunkData[11] != 0 || chunkData[12] != PNG_INTERLACE_NONE)
+                {
+                    return false;
+                }
+
+                hasHeader = true;
+                break;
+            }
+            case PLTEChunk:
+            {
+                palette = chunkData;
+                paletteLen = chunkLen;
+                break;
+            }
+            case tRNSChunk:
+            {
+                // The transparency needs a /SMask
+                return false;
+            }
+            case IDATChunk:
+            {
+                idat.append((const char*)chunkData, chunkLen);
+                break;
+            }
+            default:
+            {
+                // Unknown critical chunks can't be ignored
+                if ((chunkType & 0x20000000) == 0)
+                    return false;
+
+                break;
+            }
+        }
+    }
+
+    if (!hasHeader || idat.empty())
+        return false;
+
+    PdfImageInfo info;
+    info.Width = (unsigned)width;
+    info.Height = (unsigned)height;
+    info.BitsPerComponent = depth;
+    info.Filters = PdfFilterList{ PdfFilterType::FlateDecode };
+    int64_t colors;
+    switch (colorType)
+    {
+        case PNG_COLOR_TYPE_PALETTE:
+        {
+            if (palette == nullptr || paletteLen == 0 || paletteLen % 3 != 0)
+                return false;
+
+            info.ColorSpace.reset(new PdfColorSpaceFilterIndexed(PdfColorSpaceFilterFactory::GetDeviceRGBInstace(),
+                (unsigned)(paletteLen / 3), charbuff(bufferview((const char*)palette, paletteLen))));
+            colors = 1;
+            break;
+        }
+        case PNG_COLOR_TYPE_GRAY:
+        {
+            info.ColorSpace = PdfColorSpaceFilterFactory::GetDeviceGrayInstace();
+            colors = 1;
+            break;
+        }
+        default:
+        {
+            info.ColorSpace = PdfColorSpaceFilterFactory::GetDeviceRGBInstace();
+            colors = 3;
+            break;
+        }
+    }
+
+    image.SetDataRaw(idat, info);
+
+    // The PNG predictor reverses the per row PNG filters
+    PdfDictionary decodeParms;
+    decodeParms.AddKey("Predictor", static_cast<int64_t>(15));
+    decodeParms.AddKey("Colors", colors);
+    decodeParms.AddKey("BitsPerComponent", static_cast<int64_t>(depth));
+    decodeParms.AddKey("Columns", static_cast<int64_t>(width));
+    image.GetDictionary().AddKey("DecodeParms", decodeParms);
+    return true;
+}
+
 void loadFromPngContent(PdfImage& image, png_structp png, png_infop pnginfo)
 {
     png_set_sig_bytes(png, 8);
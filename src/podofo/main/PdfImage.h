@@ -30,6 +30,14 @@ struct PODOFO_API PdfImageInfo final
     std::vector<double> DecodeArray;
 };
 
+struct PODOFO_API PdfImageOptimizeParams final
+{
+    double TargetResolution = 150;      ///< Resolution in DPI the images are downsampled to
+    double ThresholdResolution = 225;   ///< Only images with an effective resolution in DPI above this value are downsampled
+    double JpegQuality = 0.75;          ///< Quality of the JPEG encoding, in range [0, 1]
+    PdfImageOptimizeFlags Flags = PdfImageOptimizeFlags::None;
+};
+
 /** A PdfImage object is needed when ever you want to embed an image
  *  file into a PDF document.
  *  The PdfImage object is embedded once and can be drawn as often
@@ -201,7 +209,6 @@ private:
 #endif // PODOFO_HAVE_TIFF_LIB
 
 #ifdef PODOFO_HAVE_PNG_LIB
-    void loadFromPngHandle(FILE* stream);
     /** Load the image data from a PNG file
      *  \param filename
      */
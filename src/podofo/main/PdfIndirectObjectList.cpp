@@ -23,6 +23,17 @@ using namespace PoDoFo;
 
 static constexpr unsigned MaxXRefGenerationNum = 65535;
 
+using ReferenceMap = unordered_map<PdfReference, PdfReference>;
+
+static PdfReference resolveDuplicate(const ReferenceMap& duplicates, PdfReference ref);
+static void hashObject(size_t& seed, const PdfObject& obj, const ReferenceMap& duplicates);
+static void hashStreamDictionary(size_t& seed, const PdfDictionary& dict, const ReferenceMap& duplicates);
+static bool objectsEqual(const PdfObject& lhs, const PdfObject& rhs, const ReferenceMap& duplicates);
+static bool dictionariesEqual(const PdfDictionary& lhs, const PdfDictionary& rhs,
+    const ReferenceMap& duplicates, bool skipLength);
+static bool streamsEqual(const PdfObject& lhs, const PdfObject& rhs, const ReferenceMap& duplicates);
+static void replaceDuplicates(PdfObject& obj, const ReferenceMap& duplicates);
+
 namespace
 {
     struct ObjectComparatorPredicate
@@ -352,6 +363,131 @@ void PdfIndirectObjectList::CollectGarbage()
     m_Objects.swap(newlist);
 }
 
+unsigned PdfIndirectObjectList::DeduplicateStreams()
+{
+    if (m_Document == nullptr)
+        return 0;
+
+    struct StreamEntry
+    {
+        PdfObject* Object;
+        size_t DataHash;
+    };
+
+    // Collect the candidate streams. Page content streams are
+    // excluded, since sharing them would make editing a page
+    // affect the others
+    unordered_set<PdfReference> pageContents;
+    vector<PdfObject*> candidates;
+    for (PdfObject* obj : m_Objects)
+    {
+        PdfDictionary* dict;
+        if (m_objectStreams.find(obj->GetIndirectReference().ObjectNumber()) != m_objectStreams.end()
+            || !obj->TryGetDictionary(dict))
+        {
+            continue;
+        }
+
+        auto type = dict->FindKeyAs<PdfName>("Type");
+        if (type == "Page")
+        {
+            auto contents = dict->GetKey("Contents");
+            if (contents == nullptr)
+                continue;
+
+            if (contents->IsReference())
+            {
+                // /Contents may also be a reference to an array
+                // of content streams
+                pageContents.insert(contents->GetReference());
+                contents = GetObject(contents->GetReference());
+                if (contents == nullptr)
+                    continue;
+            }
+
+            if (contents->IsArray())
+            {
+                for (auto& child : contents->GetArray())
+                {
+                    if (child.IsReference())
+                        pageContents.insert(child.GetReference());
+                }
+            }
+        }
+        else if (obj->HasStream() && type != "XRef" && type != "ObjStm")
+        {
+            candidates.push_back(obj);
+        }
+    }
+
+    vector<StreamEntry> streams;
+    streams.reserve(candidates.size());
+    for (auto obj : candidates)
+    {
+        if (pageContents.find(obj->GetIndirectReference()) != pageContents.end())
+            continue;
+
+        streams.push_back({ obj, utls::HashData(obj->MustGetStream().GetCopy(true)) });
+    }
+
+    // Find the duplicates. Dictionaries are compared resolving the
+    // references to the duplicates found so far, so repeat until
+    // no more streams are merged: this catches forms that become
+    // identical after merging the images they use
+    ReferenceMap duplicates;
+    bool merged;
+    do
+    {
+        merged = false;
+        unordered_multimap<size_t, PdfObject*> index;
+        for (auto& entry : streams)
+        {
+            auto& ref = entry.Object->GetIndirectReference();
+            if (duplicates.find(ref) != duplicates.end())
+                continue;
+
+            size_t hash = entry.DataHash;
+            hashStreamDictionary(hash, entry.Object->GetDictionary(), duplicates);
+            PdfObject* original = nullptr;
+            auto range = index.equal_range(hash);
+            for (auto it = range.first; it != range.second; it++)
+            {
+                // Verify the candidate to exclude hash collisions
+                if (streamsEqual(*it->second, *entry.Object, duplicates))
+                {
+                    original = it->second;
+                    break;
+                }
+            }
+
+            if (original == nullptr)
+            {
+                index.insert({ hash, entry.Object });
+                continue;
+            }
+
+            duplicates[ref] = original->GetIndirectReference();
+            merged = true;
+        }
+    } while (merged);
+
+    if (duplicates.size() == 0)
+        return 0;
+
+    // Rewrite the references in a single pass. The duplicates
+    // are now unreferenced and left to the garbage collection
+    for (PdfObject* obj : m_Objects)
+    {
+        if (duplicates.find(obj->GetIndirectReference()) != duplicates.end())
+            continue;
+
+        replaceDuplicates(*obj, duplicates);
+    }
+
+    replaceDuplicates(m_Document->GetTrailer().GetObject(), duplicates);
+    return (unsigned)duplicates.size();
+}
+
 void PdfIndirectObjectList::visitObject(const PdfObject& obj, unordered_set<PdfReference>& referencedObjects)
 {
     switch (obj.GetDataType())
@@ -487,3 +623,166 @@ size_t PdfIndirectObjectList::size() const
 {
     return m_Objects.size();
 }
+
+PdfReference resolveDuplicate(const ReferenceMap& duplicates, PdfReference ref)
+{
+    // Merged streams may be merged again on later rounds
+    while (true)
+    {
+        auto found = duplicates.find(ref);
+        if (found == duplicates.end())
+            return ref;
+
+        ref = found->second;
+    }
+}
+
+void hashObject(size_t& seed, const PdfObject& obj, const ReferenceMap& duplicates)
+{
+    utls::hash_combine(seed, (int)obj.GetDataType());
+    switch (obj.GetDataType())
+    {
+        case PdfDataType::Reference:
+        {
+            utls::hash_combine(seed, resolveDuplicate(duplicates, obj.GetReference()));
+            break;
+        }
+        case PdfDataType::Array:
+        {
+            for (auto& child : obj.GetArray())
+                hashObject(seed, child, duplicates);
+            break;
+        }
+        case PdfDataType::Dictionary:
+        {
+            for (auto& pair : obj.GetDictionary())
+            {
+                utls::hash_combine(seed, pair.first);
+                hashObject(seed, pair.second, duplicates);
+            }
+            break;
+        }
+        default:
+        {
+            utls::hash_combine(seed, obj.ToString());
+            break;
+        }
+    }
+}
+
+void hashStreamDictionary(size_t& seed, const PdfDictionary& dict, const ReferenceMap& duplicates)
+{
+    // NOTE: /Length is skipped, since it may be an indirect
+    // object and it's anyway determined by the stream data
+    for (auto& pair : dict)
+    {
+        if (pair.first == "Length")
+            continue;
+
+        utls::hash_combine(seed, pair.first);
+        hashObject(seed, pair.second, duplicates);
+    }
+}
+
+bool objectsEqual(const PdfObject& lhs, const PdfObject& rhs, const ReferenceMap& duplicates)
+{
+    if (lhs.GetDataType() != rhs.GetDataType())
+        return false;
+
+    switch (lhs.GetDataType())
+    {
+        case PdfDataType::Reference:
+        {
+            return resolveDuplicate(duplicates, lhs.GetReference())
+                == resolveDuplicate(duplicates, rhs.GetReference());
+        }
+        case PdfDataType::Array:
+        {
+            auto& lhsArr = lhs.GetArray();
+            auto& rhsArr = rhs.GetArray();
+            if (lhsArr.GetSize() != rhsArr.GetSize())
+                return false;
+
+            for (unsigned i = 0; i < lhsArr.GetSize(); i++)
+            {
+                if (!objectsEqual(lhsArr[i], rhsArr[i], duplicates))
+                    return false;
+            }
+
+            return true;
+        }
+        case PdfDataType::Dictionary:
+        {
+            return dictionariesEqual(lhs.GetDictionary(), rhs.GetDictionary(), duplicates, false);
+        }
+        default:
+        {
+            return lhs == rhs;
+        }
+    }
+}
+
+bool dictionariesEqual(const PdfDictionary& lhs, const PdfDictionary& rhs,
+    const ReferenceMap& duplicates, bool skipLength)
+{
+    unsigned lhsSize = lhs.GetSize();
+    unsigned rhsSize = rhs.GetSize();
+    if (skipLength)
+    {
+        if (lhs.HasKey("Length"))
+            lhsSize--;
+        if (rhs.HasKey("Length"))
+            rhsSize--;
+    }
+
+    if (lhsSize != rhsSize)
+        return false;
+
+    for (auto& pair : lhs)
+    {
+        if (skipLength && pair.first == "Length")
+            continue;
+
+        auto rhsObj = rhs.GetKey(pair.first);
+        if (rhsObj == nullptr || !objectsEqual(pair.second, *rhsObj, duplicates))
+            return false;
+    }
+
+    return true;
+}
+
+bool streamsEqual(const PdfObject& lhs, const PdfObject& rhs, const ReferenceMap& duplicates)
+{
+    auto& lhsStream = lhs.MustGetStream();
+    auto& rhsStream = rhs.MustGetStream();
+    return lhsStream.GetLength() == rhsStream.GetLength()
+        && dictionariesEqual(lhs.GetDictionary(), rhs.GetDictionary(), duplicates, true)
+        && lhsStream.GetCopy(true) == rhsStream.GetCopy(true);
+}
+
+void replaceDuplicates(PdfObject& obj, const ReferenceMap& duplicates)
+{
+    auto replace = [&duplicates](PdfObject& child) {
+        if (child.IsReference())
+        {
+            auto ref = child.GetReference();
+            if (duplicates.find(ref) != duplicates.end())
+                child = PdfObject(resolveDuplicate(duplicates, ref));
+        }
+        else if (child.IsDictionary() || child.IsArray())
+        {
+            replaceDuplicates(child, duplicates);
+        }
+    };
+
+    if (obj.IsDictionary())
+    {
+        for (auto& pair : obj.GetDictionary())
+            replace(pair.second);
+    }
+    else if (obj.IsArray())
+    {
+        for (auto& child : obj.GetArray())
+            replace(child);
+    }
+}
@@ -91,6 +91,18 @@ public:
      */
     void CollectGarbage();
 
+    /**
+     * Merges streams with identical raw data and stream dictionary,
+     * rewriting all references to the duplicates to point to
+     * a single instance. Objects using the merged streams are
+     * compared again, so identical forms referencing duplicated
+     * images are also merged. Page content streams are never merged
+     * \returns the number of merged duplicate streams
+     * \remarks The duplicates are left unreferenced: they are
+     * removed by CollectGarbage()
+     */
+    unsigned DeduplicateStreams();
+
 public:
     /**
      * \returns the size of the internal object list
@@ -316,6 +328,11 @@ private:
      */
     void SetStreamFactory(StreamFactory* factory);
 
+    /** \returns true if the object streams can be read back, that is
+     * no StreamFactory, such as one writing them immediately, is set
+     */
+    inline bool CanReadStreams() const { return m_StreamFactory == nullptr; }
+
 private:
     using ObjectNumSet = std::set<uint32_t>;
     using ReferenceSet = std::set<PdfReference>;
@@ -278,6 +278,18 @@ void PdfMemDocument::beforeWrite(PdfSaveOptions opts)
 
     GetFonts().EmbedFonts();
 
+    if ((opts & PdfSaveOptions::BalancePageTree) !=
+        PdfSaveOptions::None)
+    {
+        BalancePageTree();
+    }
+
+    if ((opts & PdfSaveOptions::DeduplicateStreams) !=
+        PdfSaveOptions::None)
+    {
+        (void)DeduplicateStreams();
+    }
+
     // After we are done with all operations on objects,
     // we can collect garbage
     if ((opts & PdfSaveOptions::NoCollectGarbage) ==
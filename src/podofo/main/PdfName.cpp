@@ -209,27 +209,7 @@ string UnescapeName(const string_view& view)
     // the same length as the encoded one, so:
     string ret;
     ret.reserve(view.length());
-    size_t incount = 0;
-    const char* curr = view.data();
-    while (incount++ < view.length())
-    {
-        if (*curr == '#' && incount + 1 < view.length())
-        {
-            unsigned char hi = static_cast<unsigned char>(*(++curr));
-            incount++;
-            unsigned char low = static_cast<unsigned char>(*(++curr));
-            incount++;
-            hi -= (hi < 'A' ? '0' : 'A' - 10);
-            low -= (low < 'A' ? '0' : 'A' - 10);
-            unsigned char codepoint = (hi << 4) | (low & 0x0F);
-            ret.push_back((char)codepoint);
-        }
-        else
-            ret.push_back(*curr);
-
-        curr++;
-    }
-
+    utls::UnescapeNameTo(ret, view);
     return ret;
 }
 
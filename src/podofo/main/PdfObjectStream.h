@@ -198,7 +198,7 @@ public:
      */
     size_t GetLength() const;
 
-    const PdfFilterList& GetFilters() { return m_Filters; }
+    const PdfFilterList& GetFilters() const { return m_Filters; }
 
     /** Create a copy of a PdfObjectStream object
      *  \param rhs the object to clone
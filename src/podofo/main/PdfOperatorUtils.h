@@ -14,6 +14,11 @@ namespace PoDoFo
     PODOFO_API PdfOperator GetPdfOperator(const std::string_view& opstr);
     PODOFO_API bool TryGetPdfOperator(const std::string_view& opstr, PdfOperator& op);
 
+    /** Get the operator and its operands count with a single lookup
+     * \param operandCount the number of operand, -1 means variadic number of operands
+     */
+    PODOFO_API bool TryGetPdfOperator(const std::string_view& opstr, PdfOperator& op, int& operandCount);
+
     /** Get the operands count of the operator
      * \returns count the number of operand, -1 means variadic number of operands
      */
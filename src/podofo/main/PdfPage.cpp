@@ -300,20 +300,7 @@ void PdfPage::SetRotation(int rotation)
 
 void PdfPage::MoveAt(unsigned index)
 {
-    // TODO: CHECK-ME FOR CORRECT WORKING
-    auto& doc = GetDocument();
-    auto& pages = doc.GetPages();
-    unsigned fromIndex = m_Index;
-    pages.InsertDocumentPageAt(index, doc, m_Index);
-    if (index < fromIndex)
-    {
-        // If we inserted the page before the old 
-        // position we have to increment the from position
-        fromIndex++;
-    }
-
-    pages.RemovePageAt(fromIndex);
-    m_Index = fromIndex;
+    GetDocument().GetPages().movePageAt(*this, index);
 }
 
 PdfField& PdfPage::CreateField(const string_view& name, PdfFieldType fieldType, const Rect& rect, bool rawRect)
@@ -390,7 +377,14 @@ void PdfPage::SetArtBox(const Rect& rect, bool raw)
 
 unsigned PdfPage::GetPageNumber() const
 {
-    return m_Index + 1;
+    return GetIndex() + 1;
+}
+
+unsigned PdfPage::GetIndex() const
+{
+    // The indices are fixed lazily after page insertions and removals
+    const_cast<PdfPageCollection&>(GetDocument().GetPages()).fixIndices();
+    return m_Index;
 }
 
 void PdfPage::SetICCProfile(const string_view& csTag, InputStream& stream,
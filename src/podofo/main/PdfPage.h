@@ -22,6 +22,8 @@ namespace PoDoFo {
 class PdfDocument;
 class InputStream;
 class PdfPage;
+class PdfContentStreamCache;
+class PdfTextSearchPattern;
 
 struct PODOFO_API PdfTextEntry final
 {
@@ -37,8 +39,16 @@ struct PODOFO_API PdfTextExtractParams final
 {
     nullable<Rect> ClipRect;
     PdfTextExtractFlags Flags = PdfTextExtractFlags::None;
+    PdfContentStreamCache* Cache = nullptr; ///< Optional cache of pre-tokenized XObject forms, to be shared across pages
+    const PdfTextSearchPattern* Pattern = nullptr; ///< Optional compiled search pattern, to be shared across pages and documents
 };
 
+/** Callback receiving the text entries extracted from a page
+ * \param pageIndex index of the page
+ * \param entries the entries of the page, that can be moved away
+ */
+using PdfTextExtractCallback = std::function<void(unsigned pageIndex, std::vector<PdfTextEntry>& entries)>;
+
 template <typename TField>
 class PdfPageFieldIterableBase final
 {
@@ -151,6 +161,10 @@ public:
     void ExtractTextTo(std::vector<PdfTextEntry>& entries,
         const PdfTextExtractParams& params) const;
 
+    /**
+     * \param pattern a pattern to search. When not empty, it's compiled
+     *        with the flags in the params and it overrides PdfTextExtractParams::Pattern
+     */
     void ExtractTextTo(std::vector<PdfTextEntry>& entries,
         const std::string_view& pattern = { },
         const PdfTextExtractParams& params = { }) const;
@@ -276,7 +290,7 @@ public:
     PdfPageConstFieldIterable GetFieldsIterator() const;
 
 public:
-    unsigned GetIndex() const { return m_Index; }
+    unsigned GetIndex() const;
     PdfContents& GetOrCreateContents();
     PdfResources& GetOrCreateResources() override;
     inline const PdfContents* GetContents() const { return m_Contents.get(); }
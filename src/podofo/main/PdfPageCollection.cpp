@@ -29,18 +29,25 @@ namespace
     };
 }
 
+// Maximum depth of the page tree descended to load a single page
+static constexpr unsigned MaxPageTreeDepth = 256;
+
 static PdfPageTreeNodeType getPageTreeNodeType(const PdfObject& nodeObj);
 static unsigned getChildCount(const PdfObject& nodeObj);
+static bool tryGetNodeCount(const PdfObject& nodeObj, unsigned& count);
 
 PdfPageCollection::PdfPageCollection(PdfDocument& doc)
-    : PdfDictionaryElement(doc, "Pages"), m_initialized(true)
+    : PdfDictionaryElement(doc, "Pages"), m_initialized(true), m_allPagesLoaded(true),
+    m_maxKids(0), m_firstDirtyIndex(numeric_limits<unsigned>::max())
 {
-    m_kidsArray = &GetDictionary().AddKey(PdfNames::Kids, PdfArray()).GetArray();
+    auto& kids = GetDictionary().AddKey(PdfNames::Kids, PdfArray()).GetArray();
     GetDictionary().AddKey(PdfNames::Count, static_cast<int64_t>(0));
+    m_root.reset(new TreeNode{ &GetObject(), &kids, nullptr, { }, 0, true });
 }
 
 PdfPageCollection::PdfPageCollection(PdfObject& pagesRoot)
-    : PdfDictionaryElement(pagesRoot), m_initialized(false), m_kidsArray(nullptr)
+    : PdfDictionaryElement(pagesRoot), m_initialized(false), m_allPagesLoaded(false),
+    m_maxKids(0), m_firstDirtyIndex(numeric_limits<unsigned>::max())
 {
 }
 
@@ -48,6 +55,9 @@ PdfPageCollection::~PdfPageCollection()
 {
     for (unsigned i = 0; i < m_Pages.size(); i++)
         delete m_Pages[i];
+
+    for (auto page : m_orphanedPages)
+        delete page;
 }
 
 unsigned PdfPageCollection::GetCount() const
@@ -58,32 +68,46 @@ unsigned PdfPageCollection::GetCount() const
 
 PdfPage& PdfPageCollection::GetPageAt(unsigned index)
 {
-    const_cast<PdfPageCollection&>(*this).initPages();
+    initPages();
     if (index >= m_Pages.size())
         PODOFO_RAISE_ERROR_INFO(PdfErrorCode::PageNotFound, "Page with index {} not found", index);
 
-    return *m_Pages[index];
+    auto page = m_Pages[index];
+    if (page == nullptr)
+        return loadPageAt(index);
+
+    return *page;
 }
 
 const PdfPage& PdfPageCollection::GetPageAt(unsigned index) const
 {
-    const_cast<PdfPageCollection&>(*this).initPages();
-    if (index >= m_Pages.size())
-        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::PageNotFound, "Page with index {} not found", index);
-
-    return *m_Pages[index];
+    return const_cast<PdfPageCollection&>(*this).GetPageAt(index);
 }
 
 PdfPage& PdfPageCollection::GetPage(const PdfReference& ref)
 {
-    const_cast<PdfPageCollection&>(*this).initPages();
+    initPages();
+    if (!m_allPagesLoaded)
+    {
+        // Determine the page index walking the /Parent chain
+        auto pageObj = GetDocument().GetObjects().GetObject(ref);
+        unsigned index;
+        if (pageObj != nullptr && tryGetPageIndex(*pageObj, index))
+        {
+            auto& page = GetPageAt(index);
+            if (page.GetObject().GetIndirectReference() == ref)
+                return page;
+        }
+
+        loadAllPages();
+    }
+
     return getPage(ref);
 }
 
 const PdfPage& PdfPageCollection::GetPage(const PdfReference& ref) const
 {
-    const_cast<PdfPageCollection&>(*this).initPages();
-    return getPage(ref);
+    return const_cast<PdfPageCollection&>(*this).GetPage(ref);
 }
 
 Rect PdfPageCollection::getActualRect(const nullable<Rect>& size)
@@ -118,27 +142,31 @@ PdfPage& PdfPageCollection::getPage(const PdfReference& ref) const
 
 PdfPageCollection::iterator PdfPageCollection::begin()
 {
+    loadAllPages();
     return m_Pages.begin();
 }
 
 PdfPageCollection::iterator PdfPageCollection::end()
 {
+    loadAllPages();
     return m_Pages.end();
 }
 
 PdfPageCollection::const_iterator PdfPageCollection::begin() const
 {
+    const_cast<PdfPageCollection&>(*this).loadAllPages();
     return m_Pages.begin();
 }
 
 PdfPageCollection::const_iterator PdfPageCollection::end() const
 {
+    const_cast<PdfPageCollection&>(*this).loadAllPages();
     return m_Pages.end();
 }
 
 void PdfPageCollection::InsertPageAt(unsigned atIndex, PdfPage& pageObj)
 {
-    FlattenStructure();
+    ensureManaged();
     vector<PdfPage*> objs = { &pageObj };
     insertPagesAt(atIndex, objs);
 }
@@ -151,33 +179,66 @@ void PdfPageCollection::insertPageAt(unsigned atIndex, PdfPage& pageObj)
 
 void PdfPageCollection::InsertPagesAt(unsigned atIndex, cspan<PdfPage*> pages)
 {
-    FlattenStructure();
+    ensureManaged();
     insertPagesAt(atIndex, pages);
 }
 
 void PdfPageCollection::insertPagesAt(unsigned atIndex, cspan<PdfPage*> pages)
 {
-    // Insert the pages and fix the indices
+    if (pages.size() == 0)
+        return;
+
+    // Insert the pages. Their indices, and the ones of
+    // the following pages, are fixed lazily
     m_Pages.insert(m_Pages.begin() + atIndex, pages.begin(), pages.end());
-    for (unsigned i = atIndex; i < m_Pages.size(); i++)
-        m_Pages[i]->SetIndex(i);
+    m_firstDirtyIndex = std::min(m_firstDirtyIndex, atIndex);
 
-    // Update the actual /Kids array and set /Parent to the new pages
+    // Update the /Kids array of the leaf containing the
+    // insertion point and set /Parent to the new pages
+    unsigned relativeIndex;
+    auto& leaf = findLeaf(atIndex, relativeIndex);
     vector<PdfObject> pageObjects;
     pageObjects.reserve(pages.size());
     for (unsigned i = 0; i < pages.size(); i++)
     {
         pageObjects.push_back(pages[i]->GetObject().GetIndirectReference());
-        pages[i]->GetDictionary().AddKey(PdfNames::Parent, GetObject().GetIndirectReference());
+        pages[i]->GetDictionary().AddKey(PdfNames::Parent, leaf.Object->GetIndirectReference());
     }
 
-    m_kidsArray->insert(m_kidsArray->begin() + atIndex, pageObjects.begin(), pageObjects.end());
-    GetDictionary().AddKey(PdfNames::Count, static_cast<int64_t>(m_Pages.size()));
+    leaf.Kids->insert(leaf.Kids->begin() + relativeIndex, pageObjects.begin(), pageObjects.end());
+    updateCount(leaf, (int)pages.size());
+    if (m_maxKids != 0 && leaf.Kids->GetSize() > m_maxKids)
+        splitNode(leaf);
+}
+
+void PdfPageCollection::removePageAt(unsigned atIndex)
+{
+    m_Pages.erase(m_Pages.begin() + atIndex);
+    m_firstDirtyIndex = std::min(m_firstDirtyIndex, atIndex);
+
+    unsigned relativeIndex;
+    auto node = &findLeaf(atIndex, relativeIndex);
+    node->Kids->RemoveAt(relativeIndex);
+    updateCount(*node, -1);
+
+    // Remove the nodes left empty, except the root
+    while (node->Count == 0 && node->Parent != nullptr)
+    {
+        auto parent = node->Parent;
+        auto found = std::find_if(parent->Children.begin(), parent->Children.end(),
+            [node](const unique_ptr<TreeNode>& child) { return child.get() == node; });
+        parent->Kids->RemoveAt((unsigned)(found - parent->Children.begin()));
+        parent->Children.erase(found);
+        node = parent;
+    }
+
+    if (node->Parent == nullptr && node->Children.size() == 0)
+        node->IsLeaf = true;
 }
 
 PdfPage& PdfPageCollection::CreatePage(const nullable<Rect>& size_)
 {
-    FlattenStructure();
+    ensureManaged();
     auto size = getActualRect(size_);
     auto page = new PdfPage(GetDocument(), size);
     insertPageAt((unsigned)m_Pages.size(), *page);
@@ -191,7 +252,7 @@ PdfPage& PdfPageCollection::CreatePage(PdfPageSize pageSize)
 
 PdfPage& PdfPageCollection::CreatePageAt(unsigned atIndex, const nullable<Rect>& size_)
 {
-    FlattenStructure();
+    ensureManaged();
     auto size = getActualRect(size_);
 
     unsigned pageCount = this->GetCount();
@@ -210,7 +271,7 @@ PdfPage& PdfPageCollection::CreatePageAt(unsigned atIndex, PdfPageSize pageSize)
 
 void PdfPageCollection::CreatePagesAt(unsigned atIndex, unsigned count, const nullable<Rect>& size_)
 {
-    FlattenStructure();
+    ensureManaged();
     auto size = getActualRect(size_);
 
     unsigned pageCount = this->GetCount();
@@ -246,18 +307,11 @@ void PdfPageCollection::InsertDocumentPageAt(unsigned atIndex, const PdfDocument
 
 void PdfPageCollection::RemovePageAt(unsigned atIndex)
 {
-    FlattenStructure();
+    ensureManaged();
     if (atIndex >= m_Pages.size())
         return;
 
-    m_Pages.erase(m_Pages.begin() + atIndex);
-    m_kidsArray->RemoveAt(atIndex);
-
-    // Fix page indices
-    for (unsigned i = atIndex; i < m_Pages.size(); i++)
-        m_Pages[i]->SetIndex(i);
-
-    GetDictionary().AddKey(PdfNames::Count, static_cast<int64_t>(m_Pages.size()));
+    removePageAt(atIndex);
 
     // After removing the page the /OpenAction entry may be invalidated,
     // prompting an error using Acrobat. Remove it for safer behavior
@@ -269,21 +323,243 @@ void PdfPageCollection::initPages()
     if (m_initialized)
         return;
 
-    vector<PdfObject*> parents;
+    // Pages are loaded lazily: just verify the root
+    // node and reserve the slots for the pages
+    unsigned count = getChildCount(GetObject());
+    if (count == 0)
+    {
+        m_initialized = true;
+        m_allPagesLoaded = true;
+        return;
+    }
+
+    const PageTreeNode* node;
+    if (!tryGetNode(GetObject(), node))
+    {
+        loadAllPages();
+        return;
+    }
+
+    m_Pages.resize(count);
+    m_initialized = true;
+}
+
+void PdfPageCollection::loadAllPages()
+{
+    if (m_allPagesLoaded)
+        return;
+
+    // Pages already loaded are reused, since they may
+    // be referenced. The traversal is done on a separate
+    // list so a broken tree doesn't alter the current one
+    unordered_map<PdfObject*, PdfPage*> loadedPages;
+    for (auto page : m_Pages)
+    {
+        if (page != nullptr)
+            loadedPages[&page->GetObject()] = page;
+    }
+
+    PageList pages;
     unsigned count = getChildCount(GetObject());
     if (count != 0)
     {
-        m_Pages.reserve(count);
+        pages.reserve(count);
+        vector<PdfObject*> parents;
         unordered_set<PdfObject*> visitedNodes;
-        (void)traversePageTreeNode(GetObject(), count, parents, visitedNodes);
+        try
+        {
+            (void)traversePageTreeNode(GetObject(), count, parents, visitedNodes, loadedPages, pages);
+        }
+        catch (...)
+        {
+            // Delete only the pages created by the traversal
+            unordered_set<PdfPage*> previousPages(m_Pages.begin(), m_Pages.end());
+            for (auto page : pages)
+            {
+                if (previousPages.find(page) == previousPages.end())
+                    delete page;
+            }
+
+            throw;
+        }
     }
 
+    // Pages loaded lazily but not found in the traversal
+    // belong to an inconsistent tree. They may be still
+    // referenced, so keep them alive with the collection
+    for (auto& pair : loadedPages)
+        m_orphanedPages.push_back(pair.second);
+
+    m_Pages.swap(pages);
+    for (unsigned i = 0; i < m_Pages.size(); i++)
+        m_Pages[i]->SetIndex(i);
+
+    m_nodes.clear();
     m_initialized = true;
+    m_allPagesLoaded = true;
+}
+
+PdfPage& PdfPageCollection::loadPageAt(unsigned index)
+{
+    // Descend the tree choosing the kid that contains
+    // the page, as determined by the nodes /Count
+    vector<PdfObject*> parents;
+    PdfObject* nodeObj = &GetObject();
+    unsigned relativeIndex = index;
+    while (true)
+    {
+        const PageTreeNode* node;
+        if (parents.size() == MaxPageTreeDepth
+            || std::find(parents.begin(), parents.end(), nodeObj) != parents.end()
+            || !tryGetNode(*nodeObj, node))
+        {
+            break;
+        }
+
+        parents.push_back(nodeObj);
+        auto found = std::upper_bound(node->Kids.begin(), node->Kids.end(), relativeIndex,
+            [](unsigned index, const PageTreeKid& kid) {
+                return index < kid.Offset;
+            });
+        if (found == node->Kids.begin())
+            break;
+
+        found--;
+        if (found->Object == nullptr)
+            break;
+
+        relativeIndex -= found->Offset;
+        if (found->IsPage)
+        {
+            if (relativeIndex != 0)
+                break;
+
+            auto page = new PdfPage(*found->Object, std::move(parents));
+            page->SetIndex(index);
+            m_Pages[index] = page;
+            return *page;
+        }
+
+        nodeObj = found->Object;
+    }
+
+    // The tree is inconsistent, load all the pages
+    // with a full traversal
+    loadAllPages();
+    if (index >= m_Pages.size())
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::PageNotFound, "Page with index {} not found", index);
+
+    return *m_Pages[index];
+}
+
+bool PdfPageCollection::tryGetNode(PdfObject& nodeObj, const PageTreeNode*& node)
+{
+    auto found = m_nodes.find(&nodeObj);
+    if (found != m_nodes.end())
+    {
+        node = &found->second;
+        return true;
+    }
+
+    unsigned count;
+    PdfArray* kidsArr;
+    auto kidsObj = nodeObj.GetDictionary().FindKey("Kids");
+    if (getPageTreeNodeType(nodeObj) != PdfPageTreeNodeType::Node
+        || !tryGetNodeCount(nodeObj, count)
+        || kidsObj == nullptr || !kidsObj->TryGetArray(kidsArr))
+    {
+        return false;
+    }
+
+    PageTreeNode newNode;
+    newNode.Kids.reserve(kidsArr->GetSize());
+    auto& objects = GetDocument().GetObjects();
+    unsigned offset = 0;
+    PdfReference ref;
+    for (unsigned i = 0; i < kidsArr->GetSize(); i++)
+    {
+        auto child = &(*kidsArr)[i];
+        if (child->TryGetReference(ref))
+            child = objects.GetObject(ref);
+
+        if (child == nullptr)
+        {
+            // Missing kids are skipped, as in the full traversal
+            newNode.Kids.push_back({ nullptr, offset, false });
+            continue;
+        }
+
+        if (!child->IsDictionary())
+            return false;
+
+        unsigned childCount;
+        switch (getPageTreeNodeType(*child))
+        {
+            case PdfPageTreeNodeType::Page:
+            {
+                newNode.Kids.push_back({ child, offset, true });
+                offset++;
+                break;
+            }
+            case PdfPageTreeNodeType::Node:
+            {
+                if (!tryGetNodeCount(*child, childCount))
+                    return false;
+
+                newNode.Kids.push_back({ child, offset, false });
+                offset += childCount;
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+
+    // The node can be used to locate pages
+    // only if the kids count is consistent
+    if (offset != count)
+        return false;
+
+    node = &m_nodes.emplace(&nodeObj, std::move(newNode)).first->second;
+    return true;
+}
+
+bool PdfPageCollection::tryGetPageIndex(PdfObject& pageObj, unsigned& index)
+{
+    if (getPageTreeNodeType(pageObj) != PdfPageTreeNodeType::Page)
+        return false;
+
+    // Sum the offsets of the page and its ancestors in their parents
+    index = 0;
+    PdfObject* childObj = &pageObj;
+    for (unsigned i = 0; i < MaxPageTreeDepth; i++)
+    {
+        auto parentObj = childObj->GetDictionary().FindKey("Parent");
+        const PageTreeNode* node;
+        if (parentObj == nullptr || !tryGetNode(*parentObj, node))
+            return false;
+
+        auto found = std::find_if(node->Kids.begin(), node->Kids.end(),
+            [childObj](const PageTreeKid& kid) {
+                return kid.Object == childObj;
+            });
+        if (found == node->Kids.end())
+            return false;
+
+        index += found->Offset;
+        if (parentObj == &GetObject())
+            return true;
+
+        childObj = parentObj;
+    }
+
+    return false;
 }
 
 // Returns the number of the remaining
 unsigned PdfPageCollection::traversePageTreeNode(PdfObject& obj, unsigned count,
-    vector<PdfObject*>& parents, unordered_set<PdfObject*>& visitedNodes)
+    vector<PdfObject*>& parents, unordered_set<PdfObject*>& visitedNodes,
+    unordered_map<PdfObject*, PdfPage*>& loadedPages, PageList& pages)
 {
     PODOFO_ASSERT(count != 0);
     utls::RecursionGuard guard;
@@ -314,7 +590,7 @@ unsigned PdfPageCollection::traversePageTreeNode(PdfObject& obj, unsigned count,
                 if (child == nullptr)
                     continue;
 
-                count = traversePageTreeNode(*child, count, parents, visitedNodes);
+                count = traversePageTreeNode(*child, count, parents, visitedNodes, loadedPages, pages);
                 if (count == 0)
                     break;
             }
@@ -324,10 +600,17 @@ unsigned PdfPageCollection::traversePageTreeNode(PdfObject& obj, unsigned count,
         }
         case PdfPageTreeNodeType::Page:
         {
-            unsigned index = (unsigned)m_Pages.size();
-            auto page = new PdfPage(obj, vector<PdfObject*>(parents));
-            m_Pages.push_back(page);
-            page->SetIndex(index);
+            auto found = loadedPages.find(&obj);
+            if (found == loadedPages.end())
+            {
+                pages.push_back(new PdfPage(obj, vector<PdfObject*>(parents)));
+            }
+            else
+            {
+                pages.push_back(found->second);
+                loadedPages.erase(found);
+            }
+
             return count - 1;
         }
         case PdfPageTreeNodeType::Unknown:
@@ -341,10 +624,29 @@ unsigned PdfPageCollection::traversePageTreeNode(PdfObject& obj, unsigned count,
 
 void PdfPageCollection::FlattenStructure()
 {
-    if (m_kidsArray != nullptr)
+    ensureManaged();
+    if (m_maxKids != 0)
+        rebuildTree(0);
+}
+
+void PdfPageCollection::BalanceStructure(unsigned maxKids)
+{
+    if (maxKids < 2)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::ValueOutOfRange, "The maximum number of kids must be at least 2");
+
+    ensureManaged();
+    if (m_maxKids == maxKids)
         return;
 
-    initPages();
+    rebuildTree(maxKids);
+}
+
+void PdfPageCollection::ensureManaged()
+{
+    if (m_root != nullptr)
+        return;
+
+    loadAllPages();
 
     // Flatten the document page structure by recreating a single /Pages
     // node and insert all pages there. This is allowed by PDF
@@ -353,8 +655,8 @@ void PdfPageCollection::FlattenStructure()
     // structure of the page tree"
     auto& kidsObj = GetDocument().GetObjects().CreateArrayObject();
     GetDictionary().AddKeyIndirect(PdfNames::Kids, kidsObj);
-    m_kidsArray = &kidsObj.GetArray();
-    m_kidsArray->reserve(m_Pages.size());
+    auto& kids = kidsObj.GetArray();
+    kids.reserve(m_Pages.size());
     for (unsigned i = 0; i < m_Pages.size(); i++)
     {
         auto page = m_Pages[i];
@@ -362,8 +664,192 @@ void PdfPageCollection::FlattenStructure()
 
         // Fix pages parent and add them to /Kids
         page->GetDictionary().AddKey(PdfNames::Parent, GetObject().GetIndirectReference());
-        (*m_kidsArray).AddIndirect(page->GetObject());
+        kids.AddIndirect(page->GetObject());
     }
+
+    GetDictionary().AddKey(PdfNames::Count, static_cast<int64_t>(m_Pages.size()));
+    m_root.reset(new TreeNode{ &GetObject(), &kids, nullptr, { }, (unsigned)m_Pages.size(), true });
+}
+
+void PdfPageCollection::rebuildTree(unsigned maxKids)
+{
+    // Put all the pages in the root, then split it. The previous
+    // intermediate nodes are left to the garbage collection
+    m_maxKids = maxKids;
+    auto& root = *m_root;
+    root.Children.clear();
+    root.IsLeaf = true;
+    root.Kids->Clear();
+    root.Kids->reserve(m_Pages.size());
+    for (auto page : m_Pages)
+    {
+        page->GetDictionary().AddKey(PdfNames::Parent, GetObject().GetIndirectReference());
+        root.Kids->AddIndirect(page->GetObject());
+    }
+
+    root.Count = (unsigned)m_Pages.size();
+    GetDictionary().AddKey(PdfNames::Count, static_cast<int64_t>(root.Count));
+    if (m_maxKids != 0 && root.Kids->GetSize() > m_maxKids)
+        splitNode(root);
+}
+
+PdfPageCollection::TreeNode& PdfPageCollection::findLeaf(unsigned index, unsigned& relativeIndex)
+{
+    // NOTE: An index equal to the count of the
+    // last child is the insertion point at its end
+    auto node = m_root.get();
+    while (!node->IsLeaf)
+    {
+        PODOFO_ASSERT(node->Children.size() != 0);
+        unsigned i = 0;
+        for (; i < node->Children.size() - 1; i++)
+        {
+            unsigned count = node->Children[i]->Count;
+            if (index < count)
+                break;
+
+            index -= count;
+        }
+
+        node = node->Children[i].get();
+    }
+
+    relativeIndex = index;
+    return *node;
+}
+
+void PdfPageCollection::splitNode(TreeNode& node)
+{
+    // Split the kids in chunks of almost equal size within the limit
+    unsigned size = node.Kids->GetSize();
+    unsigned chunkCount = (size + m_maxKids - 1) / m_maxKids;
+    auto getChunkStart = [size, chunkCount](unsigned i) {
+        return (unsigned)((uint64_t)size * i / chunkCount);
+    };
+
+    if (node.Parent == nullptr)
+    {
+        // The root object must be preserved: move all
+        // its kids to new nodes, that become its children
+        vector<unique_ptr<TreeNode>> children;
+        children.reserve(chunkCount);
+        for (unsigned i = 0; i < chunkCount; i++)
+            children.push_back(createNode(node, node, getChunkStart(i), getChunkStart(i + 1)));
+
+        node.Children = std::move(children);
+        node.IsLeaf = false;
+        node.Kids->Clear();
+        for (auto& child : node.Children)
+            node.Kids->AddIndirect(*child->Object);
+
+        if (node.Children.size() > m_maxKids)
+            splitNode(node);
+
+        return;
+    }
+
+    // Keep the first chunk in the node and move the
+    // others to new siblings following it in the parent
+    auto& parent = *node.Parent;
+    vector<unique_ptr<TreeNode>> siblings;
+    siblings.reserve(chunkCount - 1);
+    unsigned movedCount = 0;
+    for (unsigned i = 1; i < chunkCount; i++)
+    {
+        siblings.push_back(createNode(parent, node, getChunkStart(i), getChunkStart(i + 1)));
+        movedCount += siblings.back()->Count;
+    }
+
+    unsigned firstEnd = getChunkStart(1);
+    node.Kids->erase(node.Kids->begin() + firstEnd, node.Kids->end());
+    if (!node.IsLeaf)
+        node.Children.erase(node.Children.begin() + firstEnd, node.Children.end());
+
+    node.Count -= movedCount;
+    node.Object->GetDictionary().AddKey(PdfNames::Count, static_cast<int64_t>(node.Count));
+
+    auto found = std::find_if(parent.Children.begin(), parent.Children.end(),
+        [&node](const unique_ptr<TreeNode>& child) { return child.get() == &node; });
+    unsigned position = (unsigned)(found - parent.Children.begin()) + 1;
+    vector<PdfObject> siblingObjects;
+    siblingObjects.reserve(siblings.size());
+    for (auto& sibling : siblings)
+        siblingObjects.push_back(sibling->Object->GetIndirectReference());
+
+    parent.Kids->insert(parent.Kids->begin() + position, siblingObjects.begin(), siblingObjects.end());
+    parent.Children.insert(parent.Children.begin() + position,
+        std::make_move_iterator(siblings.begin()), std::make_move_iterator(siblings.end()));
+    if (parent.Children.size() > m_maxKids)
+        splitNode(parent);
+}
+
+unique_ptr<PdfPageCollection::TreeNode> PdfPageCollection::createNode(TreeNode& parent,
+    TreeNode& source, unsigned start, unsigned end)
+{
+    auto& obj = GetDocument().GetObjects().CreateDictionaryObject("Pages");
+    auto& dict = obj.GetDictionary();
+    dict.AddKey(PdfNames::Parent, parent.Object->GetIndirectReference());
+    auto& kids = dict.AddKey(PdfNames::Kids, PdfArray()).GetArray();
+    kids.insert(kids.end(), source.Kids->begin() + start, source.Kids->begin() + end);
+    unique_ptr<TreeNode> node(new TreeNode{ &obj, &kids, &parent, { }, 0, source.IsLeaf });
+    if (source.IsLeaf)
+    {
+        // Kids are pages
+        auto& objects = GetDocument().GetObjects();
+        for (auto& kid : kids)
+            objects.MustGetObject(kid.GetReference()).GetDictionary().AddKey(PdfNames::Parent, obj.GetIndirectReference());
+
+        node->Count = end - start;
+    }
+    else
+    {
+        node->Children.reserve(end - start);
+        for (unsigned i = start; i < end; i++)
+        {
+            auto& child = source.Children[i];
+            child->Parent = node.get();
+            child->Object->GetDictionary().AddKey(PdfNames::Parent, obj.GetIndirectReference());
+            node->Count += child->Count;
+            node->Children.push_back(std::move(child));
+        }
+    }
+
+    dict.AddKey(PdfNames::Count, static_cast<int64_t>(node->Count));
+    return node;
+}
+
+void PdfPageCollection::updateCount(TreeNode& node, int difference)
+{
+    for (auto current = &node; current != nullptr; current = current->Parent)
+    {
+        current->Count = (unsigned)((int)current->Count + difference);
+        current->Object->GetDictionary().AddKey(PdfNames::Count, static_cast<int64_t>(current->Count));
+    }
+}
+
+void PdfPageCollection::movePageAt(PdfPage& page, unsigned atIndex)
+{
+    ensureManaged();
+    unsigned fromIndex = page.GetIndex();
+    if (atIndex > m_Pages.size())
+        atIndex = (unsigned)m_Pages.size();
+
+    // The page is moved within the tree, so the objects
+    // referencing it, such as its annotations, stay valid.
+    // The index is the insertion point before the removal
+    removePageAt(fromIndex);
+    if (atIndex > fromIndex)
+        atIndex--;
+
+    insertPageAt(atIndex, page);
+}
+
+void PdfPageCollection::fixIndices()
+{
+    for (unsigned i = m_firstDirtyIndex; i < (unsigned)m_Pages.size(); i++)
+        m_Pages[i]->SetIndex(i);
+
+    m_firstDirtyIndex = numeric_limits<unsigned>::max();
 }
 
 PdfPageTreeNodeType getPageTreeNodeType(const PdfObject& obj)
@@ -380,6 +866,17 @@ PdfPageTreeNodeType getPageTreeNodeType(const PdfObject& obj)
         return PdfPageTreeNodeType::Unknown;
 }
 
+bool tryGetNodeCount(const PdfObject& nodeObj, unsigned& count)
+{
+    auto countObj = nodeObj.GetDictionary().FindKey("Count");
+    int64_t num;
+    if (countObj == nullptr || !countObj->TryGetNumber(num) || num < 0)
+        return false;
+
+    count = (unsigned)num;
+    return true;
+}
+
 unsigned getChildCount(const PdfObject& nodeObj)
 {
     auto countObj = nodeObj.GetDictionary().FindKey("Count");
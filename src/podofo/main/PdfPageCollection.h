@@ -41,12 +41,17 @@ public:
 
     /** Return the number of pages in document
      *  \returns number of pages
+     *  \remarks For loaded documents the count is read from the
+     *  root /Count, without loading the pages
      */
     unsigned GetCount() const;
 
     /** Return a PdfPage for the specified Page index
      *  The returned page is owned by the pages tree and
      *  deleted along with it.
+     *  For loaded documents the page tree is descended using
+     *  the /Count of the intermediate nodes, so only the nodes
+     *  on the path to the page are loaded
      *
      *  \param index page index, 0-based
      *  \returns a pointer to the requested page
@@ -97,6 +102,8 @@ public:
     void CreatePagesAt(unsigned atIndex, unsigned count, PdfPageSize pageSize);
 
     /** Appends another PdfDocument to this document.
+     *  Only the objects reachable from the pages are copied. Objects
+     *  already imported from the same document are shared
      *  \param doc the document to append
      */
     void AppendDocumentPages(const PdfDocument& doc);
@@ -134,6 +141,26 @@ public:
      */
     void FlattenStructure();
 
+    /** Rebuild the document page structure as a balanced tree
+     *
+     * Inheritable attributes are copied to the pages as in FlattenStructure(),
+     * then the pages are distributed in intermediate /Pages nodes with at most
+     * maxKids kids each. Pages inserted later keep the tree balanced,
+     * splitting the nodes that exceed the limit
+     * \param maxKids the maximum number of kids per node, at least 2
+     * \see PdfSaveOptions::BalancePageTree
+     */
+    void BalanceStructure(unsigned maxKids = DefaultMaxKids);
+
+    /** Default maximum number of kids per node of a balanced page tree
+     */
+    static constexpr unsigned DefaultMaxKids = 32;
+
+    /** \returns the maximum number of kids per node if the
+     * page structure is balanced, 0 otherwise
+     */
+    unsigned GetMaxKids() const { return m_maxKids; }
+
 public:
     template <typename TObject, typename TListIterator>
     class Iterator final
@@ -207,22 +234,75 @@ private:
      */
     void InsertPagesAt(unsigned atIndex, cspan<PdfPage*> pages);
 
+private:
+    struct PageTreeKid
+    {
+        PdfObject* Object;      // The kid object, nullptr if missing
+        unsigned Offset;        // Index of the first page of the kid, relative to the node
+        bool IsPage;
+    };
+
+    struct PageTreeNode
+    {
+        std::vector<PageTreeKid> Kids;
+    };
+
+    using NodeMap = std::unordered_map<const PdfObject*, PageTreeNode>;
+
+    // Node of the page tree managed by the collection after
+    // the first modification. Leaves have the pages as kids
+    struct TreeNode
+    {
+        PdfObject* Object;
+        PdfArray* Kids;
+        TreeNode* Parent;
+        std::vector<std::unique_ptr<TreeNode>> Children;
+        unsigned Count;
+        bool IsLeaf;
+    };
+
 private:
     void insertPageAt(unsigned atIndex, PdfPage& page);
     void insertPagesAt(unsigned atIndex, cspan<PdfPage*> pages);
+    void removePageAt(unsigned atIndex);
     Rect getActualRect(const nullable<Rect>& size);
 
+    void ensureManaged();
+    void rebuildTree(unsigned maxKids);
+    TreeNode& findLeaf(unsigned index, unsigned& relativeIndex);
+    void splitNode(TreeNode& node);
+    std::unique_ptr<TreeNode> createNode(TreeNode& parent, TreeNode& source, unsigned start, unsigned end);
+    void updateCount(TreeNode& node, int difference);
+
+    // To be called by PdfPage
+    void fixIndices();
+    void movePageAt(PdfPage& page, unsigned atIndex);
+
     PdfPage& getPage(const PdfReference& ref) const;
 
     void initPages();
 
+    void loadAllPages();
+
+    PdfPage& loadPageAt(unsigned index);
+
+    bool tryGetNode(PdfObject& nodeObj, const PageTreeNode*& node);
+
+    bool tryGetPageIndex(PdfObject& pageObj, unsigned& index);
+
     unsigned traversePageTreeNode(PdfObject& obj, unsigned count,
-        std::vector<PdfObject*>& parents, std::unordered_set<PdfObject*>& visitedNodes);
+        std::vector<PdfObject*>& parents, std::unordered_set<PdfObject*>& visitedNodes,
+        std::unordered_map<PdfObject*, PdfPage*>& loadedPages, PageList& pages);
 
 private:
     bool m_initialized;
-    PageList m_Pages;
-    PdfArray* m_kidsArray;
+    bool m_allPagesLoaded;
+    PageList m_Pages;               // Pages not loaded yet are nullptr
+    PageList m_orphanedPages;       // Loaded pages not found in the tree, deleted with the collection
+    NodeMap m_nodes;                // Cached nodes descended to load pages
+    std::unique_ptr<TreeNode> m_root;   // The managed tree, nullptr until the first modification
+    unsigned m_maxKids;             // Maximum kids per managed node, 0 if unbounded
+    unsigned m_firstDirtyIndex;     // First page with a stale index after insertions/removals
 };
 
 };
@@ -7,7 +7,6 @@
 #include <podofo/private/PdfDeclarationsPrivate.h>
 #include "PdfPage.h"
 
-#include <regex>
 #include <list>
 
 #include <utf8cpp/utf8.h>
@@ -18,6 +17,7 @@
 #include "PdfXObjectForm.h"
 #include "PdfContentStreamReader.h"
 #include "PdfFont.h"
+#include "PdfTextSearchPattern.h"
 
 #include <podofo/private/outstringstream.h>
 #include <podofo/auxiliary/StateStack.h>
@@ -108,7 +108,7 @@ struct XObjectState
 struct ExtractionContext
 {
 public:
-    ExtractionContext(vector<PdfTextEntry> &entries, const PdfPage &page, const string_view &pattern,
+    ExtractionContext(vector<PdfTextEntry> &entries, const PdfPage &page, const PdfTextSearchPattern* pattern,
         PdfTextExtractFlags flags, const nullable<Rect> &clipRect);
 public:
     void BeginText();
@@ -134,7 +134,7 @@ private:
     const PdfPage& m_page;
 public:
     const int PageIndex;
-    const string Pattern;
+    const PdfTextSearchPattern* Pattern;
     const EntryOptions Options;
     const nullable<Rect> ClipRect;
     unique_ptr<Matrix> Rotation;
@@ -163,23 +163,22 @@ static void splitStringBySpaces(vector<StatefulString> &separatedStrings, const
 static void trimSpacesBegin(StringChunk &chunk);
 static void trimSpacesEnd(StringChunk &chunk);
 static void addEntry(vector<PdfTextEntry> &textEntries, StringChunkList &strings,
-    const string_view &pattern, const EntryOptions &options, const nullable<Rect> &clipRect,
+    const PdfTextSearchPattern* pattern, const EntryOptions &options, const nullable<Rect> &clipRect,
     int pageIndex, const Matrix* rotation);
 static void addEntryChunk(vector<PdfTextEntry> &textEntries, StringChunkList &strings,
-    const string_view &pattern, const EntryOptions& options, const nullable<Rect> &clipRect,
+    const PdfTextSearchPattern* pattern, const EntryOptions& options, const nullable<Rect> &clipRect,
     int pageIndex, const Matrix* rotation);
 static void processChunks(const StringChunkList& chunks, string& destString,
     vector<unsigned>& positions, vector<const StatefulString*>& strings,
     vector<GlyphAddress>& glyphAddresses);
 static double computeLength(const vector<const StatefulString*>& strings, const vector<GlyphAddress>& glyphAddresses,
     unsigned lowerIndex, unsigned upperIndex);
-static bool isMatchWholeWordSubstring(const string_view& str, const string_view& pattern, size_t& matchPos);
 static Rect computeBoundingBox(const TextState& textState, double boxWidth);
 static void read(const PdfVariantStack& stack, double &tx, double &ty);
 static void read(const PdfVariantStack& stack, double &a, double &b, double &c, double &d, double &e, double &f);
 static void getSubstringIndices(const vector<unsigned>& positions, unsigned lowerPos, unsigned upperLimitPos,
     unsigned& lowerIndex, unsigned& upperLimitIndex);
-static EntryOptions optionsFromFlags(PdfTextExtractFlags flags);
+static EntryOptions optionsFromFlags(PdfTextExtractFlags flags, const PdfTextSearchPattern* pattern);
 
 void PdfPage::ExtractTextTo(vector<PdfTextEntry>& entries, const PdfTextExtractParams& params) const
 {
@@ -189,10 +188,25 @@ void PdfPage::ExtractTextTo(vector<PdfTextEntry>& entries, const PdfTextExtractP
 void PdfPage::ExtractTextTo(vector<PdfTextEntry>& entries, const string_view& pattern,
     const PdfTextExtractParams& params) const
 {
-    ExtractionContext context(entries, *this, pattern, params.Flags, params.ClipRect);
+    // Compile the pattern only once for all the entries
+    unique_ptr<PdfTextSearchPattern> compiledPattern;
+    auto searchPattern = params.Pattern;
+    if (!pattern.empty())
+    {
+        compiledPattern.reset(new PdfTextSearchPattern(pattern, params.Flags));
+        searchPattern = compiledPattern.get();
+    }
+    else if (searchPattern != nullptr && searchPattern->IsEmpty())
+    {
+        searchPattern = nullptr;
+    }
+
+    ExtractionContext context(entries, *this, searchPattern, params.Flags, params.ClipRect);
 
     // Look FIGURE 4.1 Graphics objects
-    PdfContentStreamReader reader(*this);
+    PdfContentReaderArgs args;
+    args.Cache = params.Cache;
+    PdfContentStreamReader reader(*this, args);
     PdfContent content;
     vector<double> lengths;
     vector<unsigned> positions;
@@ -429,7 +443,7 @@ void PdfPage::ExtractTextTo(vector<PdfTextEntry>& entries, const string_view& pa
     context.TryAddLastEntry();
 }
 
-void addEntry(vector<PdfTextEntry> &textEntries, StringChunkList &chunks, const string_view &pattern,
+void addEntry(vector<PdfTextEntry> &textEntries, StringChunkList &chunks, const PdfTextSearchPattern* pattern,
     const EntryOptions &options, const nullable<Rect> &clipRect, int pageIndex, const Matrix* rotation)
 {
     if (options.TokenizeWords)
@@ -494,7 +508,7 @@ void addEntry(vector<PdfTextEntry> &textEntries, StringChunkList &chunks, const
     }
 }
 
-void addEntryChunk(vector<PdfTextEntry> &textEntries, StringChunkList &chunks, const string_view &pattern,
+void addEntryChunk(vector<PdfTextEntry> &textEntries, StringChunkList &chunks, const PdfTextSearchPattern* pattern,
     const EntryOptions& options, const nullable<Rect> &clipRect, int pageIndex, const Matrix* rotation)
 {
     if (options.TrimSpaces)
@@ -549,79 +563,38 @@ void addEntryChunk(vector<PdfTextEntry> &textEntries, StringChunkList &chunks, c
     unsigned lowerIndex = 0;
     unsigned upperIndexLimit = (unsigned)glyphAddresses.size();
     auto textState = firstStr.State;
-    if (pattern.length() != 0)
+    if (pattern != nullptr)
     {
-        PODOFO_INVARIANT(utls::IsValidUtf8String(pattern));
         bool match;
-        if (options.RegexPattern)
+        if (options.ExtractSubstring)
         {
-            PODOFO_ASSERT(!(options.MatchWholeWord || options.ExtractSubstring));
-            auto flags = regex_constants::ECMAScript;
-            if (options.IgnoreCase)
-                flags |= regex_constants::icase;
-
-            // NOTE: regex_search returns true when a sub-part of the string
-            // matches the regex
-            regex pieces_regex((string)pattern, flags);
-            match = std::regex_search(str, pieces_regex);
-        }
-        else
-        {
-            if (options.ExtractSubstring)
+            size_t pos;
+            size_t matchLength;
+            match = pattern->TryFind(str, pos, matchLength);
+            if (match)
             {
-                size_t pos;
-                if (options.MatchWholeWord)
-                {
-                    if (options.IgnoreCase)
-                        match = isMatchWholeWordSubstring(utls::ToLower(str), utls::ToLower(pattern), pos);
-                    else
-                        match = isMatchWholeWordSubstring(str, pattern, pos);
-                }
-                else
-                {
-                    if (options.IgnoreCase)
-                        pos = utls::ToLower(str).find(utls::ToLower(pattern));
-                    else
-                        pos = str.find(pattern);
-                    match = pos != string::npos;
-                }
-
-                if (match)
-                {
-                    getSubstringIndices(positions, (unsigned)pos, (unsigned)(pos + pattern.size()),
-                        lowerIndex, upperIndexLimit);
+                // NOTE: With regular expressions the length of
+                // the match differs from the one of the pattern
+                getSubstringIndices(positions, (unsigned)pos, (unsigned)(pos + matchLength),
+                    lowerIndex, upperIndexLimit);
 
-                    // Assign actual found matched substring
-                    if (pos != 0 || str.size() != pattern.size())
-                        str = str.substr(pos, pattern.size());
+                // Assign actual found matched substring
+                if (pos != 0 || str.size() != matchLength)
+                    str = str.substr(pos, matchLength);
 
-                    if (lowerIndex != 0)
-                    {
-                        // Compute substring translation and apply it
-                        // TODO: Handle vertical scripts
-                        double substringTx = computeLength(strings, glyphAddresses, 0, lowerIndex - 1);
-                        textState.T_rm.Apply<Tx>(substringTx);
-                    }
-                }
-            }
-            else
-            {
-                if (options.MatchWholeWord)
-                {
-                    if (options.IgnoreCase)
-                        match = utls::ToLower(str) == utls::ToLower(pattern);
-                    else
-                        match = str == pattern;
-                }
-                else
+                if (lowerIndex != 0)
                 {
-                    if (options.IgnoreCase)
-                        match = utls::ToLower(str).find(utls::ToLower(pattern)) != string::npos;
-                    else
-                        match = str.find(pattern) != string::npos;
+                    // Compute substring translation and apply it
+                    // TODO: Handle vertical scripts
+                    double substringTx = computeLength(strings, glyphAddresses, 0, lowerIndex - 1);
+                    textState.T_rm.Apply<Tx>(substringTx);
                 }
             }
         }
+        else
+        {
+            match = pattern->IsMatch(str);
+        }
 
         if (!match)
         {
@@ -841,16 +814,16 @@ vector<double> StatefulString::computeLengths(const vector<double>& rawLengths)
     return ret;
 }
 
-ExtractionContext::ExtractionContext(vector<PdfTextEntry>& entries, const PdfPage& page, const string_view& pattern,
+ExtractionContext::ExtractionContext(vector<PdfTextEntry>& entries, const PdfPage& page, const PdfTextSearchPattern* pattern,
     PdfTextExtractFlags flags , const nullable<Rect>& clipRect) :
     m_page(page),
     PageIndex(page.GetPageNumber() - 1),
     Pattern(pattern),
-    Options(optionsFromFlags(flags)),
+    Options(optionsFromFlags(flags, pattern)),
     ClipRect(clipRect),
     Entries(entries)
 {
-    if (Options.ExtractSubstring && pattern.empty())
+    if (Options.ExtractSubstring && pattern == nullptr)
         PODOFO_RAISE_ERROR_INFO(PdfErrorCode::NotImplemented, "Unsupported ExtractSubstring flag with empty pattern");
 
     // Determine page rotation transformation
@@ -1320,46 +1293,6 @@ double computeLength(const vector<const StatefulString*>& strings, const vector<
 
 // Verify if the string matches the pattern and verify
 // presence of delimiters for whole word match
-bool isMatchWholeWordSubstring(const string_view& str, const string_view& pattern, size_t& matchPos)
-{
-    bool prevDelimiter;
-    auto found = str.find(pattern);
-    string_view::const_iterator it;
-    string_view::const_iterator end;
-    char32_t cp;
-    if (found == string_view::npos)
-        goto NoMatch;
-
-    it = str.begin();
-    end = str.begin() + found;
-
-    prevDelimiter = true;
-    while (it != end)
-    {
-        cp = utf8::unchecked::next(it);
-        prevDelimiter = utls::IsStringDelimiter(cp);
-    }
-
-    if (!prevDelimiter)
-        goto NoMatch;
-
-    it = str.begin() + found + pattern.length();
-    end = str.end();
-    if (it != end)
-    {
-        cp = utf8::unchecked::next(it);
-        if (!utls::IsStringDelimiter(cp))
-            goto NoMatch;
-    }
-
-    matchPos = found;
-    return true;
-
-NoMatch:
-    matchPos = string_view::npos;
-    return false;
-}
-
 Rect computeBoundingBox(const TextState& textState, double boxWidth)
 {
     // NOTE: This is very inaccurate
@@ -1408,8 +1341,12 @@ void getSubstringIndices(const vector<unsigned>& positions, unsigned lowerPos, u
     }
 }
 
-EntryOptions optionsFromFlags(PdfTextExtractFlags flags)
+EntryOptions optionsFromFlags(PdfTextExtractFlags flags, const PdfTextSearchPattern* pattern)
 {
+    // The matching flags of a compiled pattern take precedence
+    if (pattern != nullptr)
+        flags = (flags & ~PdfTextSearchPattern::MatchingFlags) | pattern->GetFlags();
+
     EntryOptions ret;
     ret.IgnoreCase = (flags & PdfTextExtractFlags::IgnoreCase) != PdfTextExtractFlags::None;
     ret.MatchWholeWord = (flags & PdfTextExtractFlags::MatchWholeWord) != PdfTextExtractFlags::None;
@@ -1420,14 +1357,8 @@ EntryOptions optionsFromFlags(PdfTextExtractFlags flags)
     ret.RawCoordinates = (flags & PdfTextExtractFlags::RawCoordinates) != PdfTextExtractFlags::None;
     ret.ExtractSubstring = (flags & PdfTextExtractFlags::ExtractSubstring) != PdfTextExtractFlags::None;
 
-    if (ret.RegexPattern)
-    {
-        if (ret.MatchWholeWord)
-            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::NotImplemented, "RegexPattern is incompatible with MatchWholeWord flag");
-
-        if (ret.ExtractSubstring)
-            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::NotImplemented, "RegexPattern is currently unsupported with ExtractSubstring");
-    }
+    if (ret.RegexPattern && ret.MatchWholeWord)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::NotImplemented, "RegexPattern is incompatible with MatchWholeWord flag");
 
     return ret;
 }
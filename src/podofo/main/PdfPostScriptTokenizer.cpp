@@ -95,6 +95,116 @@ bool PdfPostScriptTokenizer::TryReadNext(InputStreamDevice& device, PdfPostScrip
     return true;
 }
 
+bool PdfPostScriptTokenizer::TryReadNextOperand(InputStreamDevice& device, PdfPostScriptTokenType& psTokenType,
+    string_view& keyword, PdfOperandView& operand, charbuff& buffer, PdfVariant& variant)
+{
+    PdfTokenType tokenType;
+    string_view token;
+    keyword = { };
+    operand = { };
+    bool gotToken = PdfTokenizer::TryReadNextToken(device, token, tokenType);
+    if (!gotToken)
+    {
+        psTokenType = PdfPostScriptTokenType::Unknown;
+        return false;
+    }
+
+    // Assume we read an operand unless we discover otherwise later
+    psTokenType = PdfPostScriptTokenType::Variant;
+    size_t offset = buffer.size();
+    switch (tokenType)
+    {
+        case PdfTokenType::BraceLeft:
+            psTokenType = PdfPostScriptTokenType::ProcedureEnter;
+            return true;
+        case PdfTokenType::BraceRight:
+            psTokenType = PdfPostScriptTokenType::ProcedureExit;
+            return true;
+        case PdfTokenType::SquareBracketLeft:
+            psTokenType = PdfPostScriptTokenType::ArrayEnter;
+            return true;
+        case PdfTokenType::SquareBracketRight:
+            psTokenType = PdfPostScriptTokenType::ArrayExit;
+            return true;
+        case PdfTokenType::ParenthesisLeft:
+            this->ReadStringTo(device, buffer);
+            operand.Type = PdfOperandType::String;
+            operand.Data = string_view(buffer.data() + offset, buffer.size() - offset);
+            return true;
+        case PdfTokenType::AngleBracketLeft:
+            this->ReadHexStringTo(device, buffer);
+            operand.Type = PdfOperandType::HexString;
+            operand.Data = string_view(buffer.data() + offset, buffer.size() - offset);
+            return true;
+        case PdfTokenType::Slash:
+            this->ReadNameTo(device, buffer);
+            operand.Type = PdfOperandType::Name;
+            operand.Data = string_view(buffer.data() + offset, buffer.size() - offset);
+            return true;
+        case PdfTokenType::DoubleAngleBracketsLeft:
+            this->ReadDictionary(device, variant, { });
+            operand.Type = PdfOperandType::Dictionary;
+            operand.Variant = &variant;
+            return true;
+        default:
+            // Continue evaluating data type
+            break;
+    }
+
+    switch (DetermineDataType(device, token, tokenType, variant))
+    {
+        case PdfLiteralDataType::Null:
+            operand.Type = PdfOperandType::Null;
+            break;
+        case PdfLiteralDataType::Bool:
+            operand.Type = PdfOperandType::Bool;
+            operand.Bool = variant.GetBool();
+            break;
+        case PdfLiteralDataType::Number:
+            operand.Type = PdfOperandType::Number;
+            operand.Number = variant.GetNumber();
+            break;
+        case PdfLiteralDataType::Real:
+            operand.Type = PdfOperandType::Real;
+            operand.Real = variant.GetReal();
+            break;
+        case PdfLiteralDataType::Reference:
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InternalLogic, "Unsupported reference datatype at this context");
+        default:
+            // Assume we have a keyword
+            keyword = token;
+            psTokenType = PdfPostScriptTokenType::Keyword;
+            break;
+    }
+
+    return true;
+}
+
+double PdfOperandView::GetReal() const
+{
+    double ret;
+    if (!TryGetReal(ret))
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidDataType, "The operand is not a number");
+
+    return ret;
+}
+
+bool PdfOperandView::TryGetReal(double& value) const
+{
+    switch (Type)
+    {
+        case PdfOperandType::Number:
+            value = (double)Number;
+            return true;
+        case PdfOperandType::Real:
+            value = Real;
+            return true;
+        default:
+            value = 0;
+            return false;
+    }
+}
+
 PdfTokenizerOptions getPostScriptOptions(PdfPostScriptLanguageLevel level)
 {
     PdfTokenizerOptions tokenizerOpts;
@@ -22,6 +22,48 @@ enum class PdfPostScriptTokenType
     Variant, ///< The token is a PDF variant. A variant is usually a parameter to a keyword
     ProcedureEnter, ///< Procedure enter delimiter
     ProcedureExit, ///< Procedure enter delimiter
+    ArrayEnter, ///< Array enter delimiter. Returned only by TryReadNextOperand()
+    ArrayExit, ///< Array exit delimiter. Returned only by TryReadNextOperand()
+};
+
+/** Type of a lightweight operand view
+ */
+enum class PdfOperandType
+{
+    Unknown = 0,
+    Null,
+    Bool,
+    Number,
+    Real,
+    String,     ///< Literal string, the data is unescaped
+    HexString,  ///< Hexadecimal string, the data is decoded
+    Name,       ///< Name, the data is unescaped
+    Array,
+    Dictionary, ///< Dictionary, available only as a full PdfVariant
+};
+
+/** A lightweight view of a PostScript operand that doesn't own
+ * its data. Numbers are decoded in place, while strings and
+ * names are views in a buffer owned by the reader
+ */
+struct PODOFO_API PdfOperandView final
+{
+    PdfOperandType Type = PdfOperandType::Unknown;
+    union
+    {
+        bool Bool;
+        int64_t Number = 0;
+        double Real;
+    };
+    std::string_view Data;                  ///< Data of String, HexString and Name operands
+    const PdfOperandView* Items = nullptr;  ///< Items of Array operands
+    unsigned ItemCount = 0;
+    const PdfVariant* Variant = nullptr;    ///< Dictionary operands
+
+    /** Get the value of a Number or Real operand as a real
+     */
+    double GetReal() const;
+    bool TryGetReal(double& value) const;
 };
 
 /** This class is a parser for general PostScript content in PDF documents.
@@ -36,6 +78,18 @@ public:
     bool TryReadNext(InputStreamDevice& device, PdfPostScriptTokenType& tokenType, std::string_view& keyword, PdfVariant& variant);
     void ReadNextVariant(InputStreamDevice& device, PdfVariant& variant);
     bool TryReadNextVariant(InputStreamDevice& device, PdfVariant& variant);
+
+    /** Read the next token without creating PdfVariant instances
+     * for numbers, strings and names, that are returned as a lightweight
+     * PdfOperandView with Variant token type. Arrays are not read as a whole
+     * but ArrayEnter/ArrayExit token types are returned instead
+     * \param buffer decoded data of strings and names is appended to this
+     *        buffer and operand.Data points into it, so it's invalidated if
+     *        the buffer is reallocated
+     * \param variant storage for dictionaries operands and temporary values
+     */
+    bool TryReadNextOperand(InputStreamDevice& device, PdfPostScriptTokenType& tokenType,
+        std::string_view& keyword, PdfOperandView& operand, charbuff& buffer, PdfVariant& variant);
 };
 
 };
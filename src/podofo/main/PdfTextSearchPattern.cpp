@@ -0,0 +1,200 @@
+/**
+ * SPDX-FileCopyrightText: (C) 2022 Francesco Pretto <ceztko@gmail.com>
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ * SPDX-License-Identifier: MPL-2.0
+ */
+
+#include <podofo/private/PdfDeclarationsPrivate.h>
+#include "PdfTextSearchPattern.h"
+
+#include <regex>
+
+#include <utf8cpp/utf8.h>
+
+using namespace std;
+using namespace PoDoFo;
+
+static size_t find(const string_view& str, const string_view& pattern, bool ignoreCase, size_t offset);
+static bool areEqual(const string_view& str, const string_view& pattern, bool ignoreCase);
+static bool isWordBoundaryMatch(const string_view& str, size_t pos, size_t length);
+static char foldCase(char ch);
+
+struct PdfTextSearchPattern::Matcher
+{
+    string Pattern;
+    // The pattern with folded case, when matching ignoring case
+    string FoldedPattern;
+    unique_ptr<regex> Regex;
+};
+
+PdfTextSearchPattern::PdfTextSearchPattern(const string_view& pattern, PdfTextExtractFlags flags) :
+    m_flags(flags & MatchingFlags),
+    m_matcher(new Matcher())
+{
+    if (!utls::IsValidUtf8String(pattern))
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidDataType, "The pattern is not a valid UTF-8 string");
+
+    m_matcher->Pattern = pattern;
+    bool ignoreCase = (m_flags & PdfTextExtractFlags::IgnoreCase) != PdfTextExtractFlags::None;
+    if ((m_flags & PdfTextExtractFlags::RegexPattern) != PdfTextExtractFlags::None)
+    {
+        if ((m_flags & PdfTextExtractFlags::MatchWholeWord) != PdfTextExtractFlags::None)
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::NotImplemented, "RegexPattern is incompatible with MatchWholeWord flag");
+
+        auto regexFlags = regex_constants::ECMAScript | regex_constants::optimize;
+        if (ignoreCase)
+            regexFlags |= regex_constants::icase;
+
+        m_matcher->Regex.reset(new regex(m_matcher->Pattern, regexFlags));
+    }
+    else if (ignoreCase)
+    {
+        m_matcher->FoldedPattern.resize(pattern.size());
+        for (size_t i = 0; i < pattern.size(); i++)
+            m_matcher->FoldedPattern[i] = foldCase(pattern[i]);
+    }
+    else
+    {
+        m_matcher->FoldedPattern = m_matcher->Pattern;
+    }
+}
+
+PdfTextSearchPattern::~PdfTextSearchPattern() { }
+
+bool PdfTextSearchPattern::TryFind(const string_view& str, size_t& pos) const
+{
+    size_t length;
+    return TryFind(str, pos, length);
+}
+
+bool PdfTextSearchPattern::TryFind(const string_view& str, size_t& pos, size_t& length) const
+{
+    if (m_matcher->Regex != nullptr)
+    {
+        // NOTE: regex_search returns true when a sub-part of the string
+        // matches the regex
+        cmatch match;
+        if (!std::regex_search(str.data(), str.data() + str.size(), match, *m_matcher->Regex))
+        {
+            pos = string_view::npos;
+            length = 0;
+            return false;
+        }
+
+        pos = (size_t)match.position(0);
+        length = (size_t)match.length(0);
+        return true;
+    }
+
+    auto& pattern = m_matcher->FoldedPattern;
+    bool ignoreCase = (m_flags & PdfTextExtractFlags::IgnoreCase) != PdfTextExtractFlags::None;
+    pos = ::find(str, pattern, ignoreCase, 0);
+    if ((m_flags & PdfTextExtractFlags::MatchWholeWord) != PdfTextExtractFlags::None)
+    {
+        // Skip occurrences that are not delimited by word separators
+        while (pos != string_view::npos && !isWordBoundaryMatch(str, pos, pattern.size()))
+            pos = ::find(str, pattern, ignoreCase, pos + 1);
+    }
+
+    if (pos == string_view::npos)
+    {
+        length = 0;
+        return false;
+    }
+
+    length = pattern.size();
+    return true;
+}
+
+bool PdfTextSearchPattern::IsMatch(const string_view& str) const
+{
+    if (m_matcher->Regex == nullptr
+        && (m_flags & PdfTextExtractFlags::MatchWholeWord) != PdfTextExtractFlags::None)
+    {
+        return areEqual(str, m_matcher->FoldedPattern,
+            (m_flags & PdfTextExtractFlags::IgnoreCase) != PdfTextExtractFlags::None);
+    }
+
+    size_t pos;
+    return TryFind(str, pos);
+}
+
+bool PdfTextSearchPattern::IsEmpty() const
+{
+    return m_matcher->Pattern.empty();
+}
+
+const string& PdfTextSearchPattern::GetPattern() const
+{
+    return m_matcher->Pattern;
+}
+
+// NOTE: The pattern is expected to be already folded
+size_t find(const string_view& str, const string_view& pattern, bool ignoreCase, size_t offset)
+{
+    if (!ignoreCase)
+        return str.find(pattern, offset);
+
+    if (pattern.empty())
+        return offset <= str.size() ? offset : string_view::npos;
+
+    if (pattern.size() > str.size())
+        return string_view::npos;
+
+    size_t last = str.size() - pattern.size();
+    char first = pattern[0];
+    for (size_t i = offset; i <= last; i++)
+    {
+        if (foldCase(str[i]) != first)
+            continue;
+
+        if (areEqual(str.substr(i + 1, pattern.size() - 1), pattern.substr(1), true))
+            return i;
+    }
+
+    return string_view::npos;
+}
+
+bool areEqual(const string_view& str, const string_view& pattern, bool ignoreCase)
+{
+    if (!ignoreCase)
+        return str == pattern;
+
+    if (str.size() != pattern.size())
+        return false;
+
+    for (size_t i = 0; i < str.size(); i++)
+    {
+        if (foldCase(str[i]) != pattern[i])
+            return false;
+    }
+
+    return true;
+}
+
+bool isWordBoundaryMatch(const string_view& str, size_t pos, size_t length)
+{
+    if (pos != 0)
+    {
+        auto it = str.begin() + pos;
+        char32_t cp = utf8::unchecked::prior(it);
+        if (!utls::IsStringDelimiter(cp))
+            return false;
+    }
+
+    if (pos + length != str.size())
+    {
+        auto it = str.begin() + pos + length;
+        char32_t cp = utf8::unchecked::next(it);
+        if (!utls::IsStringDelimiter(cp))
+            return false;
+    }
+
+    return true;
+}
+
+char foldCase(char ch)
+{
+    // NOTE: Consistent with utls::ToLower() with the "C" locale
+    return ch >= 'A' && ch <= 'Z' ? (char)(ch - 'A' + 'a') : ch;
+}
@@ -0,0 +1,77 @@
+/**
+ * SPDX-FileCopyrightText: (C) 2022 Francesco Pretto <ceztko@gmail.com>
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ * SPDX-License-Identifier: MPL-2.0
+ */
+
+#ifndef PDF_TEXT_SEARCH_PATTERN_H
+#define PDF_TEXT_SEARCH_PATTERN_H
+
+#include "PdfDeclarations.h"
+
+namespace PoDoFo {
+
+/** A text search pattern, compiled once and reusable across pages
+ * and documents. Matching is thread safe
+ * \remarks Case folding is performed on ASCII characters only
+ * \see PdfTextExtractParams
+ */
+class PODOFO_API PdfTextSearchPattern final
+{
+public:
+    /**
+     * \param flags the matching flags. Only PdfTextExtractFlags::IgnoreCase,
+     *        PdfTextExtractFlags::MatchWholeWord and PdfTextExtractFlags::RegexPattern
+     *        are relevant, the others are ignored
+     */
+    PdfTextSearchPattern(const std::string_view& pattern,
+        PdfTextExtractFlags flags = PdfTextExtractFlags::None);
+
+    ~PdfTextSearchPattern();
+
+public:
+    /** Search the pattern in the given string. With
+     * PdfTextExtractFlags::MatchWholeWord the match must be
+     * delimited by word separators
+     * \param pos the position of the first match
+     */
+    bool TryFind(const std::string_view& str, size_t& pos) const;
+
+    /** Search the pattern in the given string
+     * \param pos the position of the first match
+     * \param length the length of the matched substring, which
+     *        may differ from the pattern length with PdfTextExtractFlags::RegexPattern
+     */
+    bool TryFind(const std::string_view& str, size_t& pos, size_t& length) const;
+
+    /** Determine if the string matches the pattern. With
+     * PdfTextExtractFlags::MatchWholeWord the string must
+     * equal the pattern, otherwise it must contain it
+     */
+    bool IsMatch(const std::string_view& str) const;
+
+    bool IsEmpty() const;
+
+    const std::string& GetPattern() const;
+
+    PdfTextExtractFlags GetFlags() const { return m_flags; }
+
+public:
+    static constexpr PdfTextExtractFlags MatchingFlags = PdfTextExtractFlags::IgnoreCase
+        | PdfTextExtractFlags::MatchWholeWord | PdfTextExtractFlags::RegexPattern;
+
+private:
+    PdfTextSearchPattern(const PdfTextSearchPattern&) = delete;
+    PdfTextSearchPattern& operator=(const PdfTextSearchPattern&) = delete;
+
+private:
+    struct Matcher;
+
+private:
+    PdfTextExtractFlags m_flags;
+    std::unique_ptr<Matcher> m_matcher;
+};
+
+}
+
+#endif // PDF_TEXT_SEARCH_PATTERN_H
@@ -20,6 +20,7 @@ using namespace std;
 using namespace PoDoFo;
 
 static char getEscapedCharacter(char ch);
+static void readString(InputStreamDevice& device, charbuff& buffer);
 static void readHexString(InputStreamDevice& device, charbuff& buffer);
 static bool isOctalChar(char ch);
 
@@ -499,105 +500,8 @@ void PdfTokenizer::ReadArray(InputStreamDevice& device, PdfVariant& variant, con
 
 void PdfTokenizer::ReadString(InputStreamDevice& device, PdfVariant& variant, const PdfStatefulEncrypt* encrypt)
 {
-    char ch;
-    bool escape = false;
-    bool octEscape = false;
-    int octCharCount = 0;
-    char octValue = 0;
-    int balanceCount = 0; // Balanced parenthesis do not have to be escaped in strings
-
     m_charBuffer.clear();
-    while (device.Read(ch))
-    {
-        if (escape)
-        {
-            // Handle escape sequences
-            if (octEscape)
-            {
-                // Handle octal escape sequences
-                octCharCount++;
-
-                if (!isOctalChar(ch))
-                {
-                    if (ch == ')')
-                    {
-                        // Handle end of string while reading octal code
-                        // NOTE: The octal value is added outside of the loop
-                        break;
-                    }
-
-                    // No octal character anymore,
-                    // so the octal sequence must be ended
-                    // and the character has to be treated as normal character!
-                    m_charBuffer.push_back(octValue);
-
-                    if (ch != '\\')
-                    {
-                        m_charBuffer.push_back(ch);
-                        escape = false;
-                    }
-
-                    octEscape = false;
-                    octCharCount = 0;
-                    octValue = 0;
-                    continue;
-                }
-
-                octValue <<= 3;
-                octValue |= ((ch - '0') & 0x07);
-
-                if (octCharCount == 3)
-                {
-                    m_charBuffer.push_back(octValue);
-                    escape = false;
-                    octEscape = false;
-                    octCharCount = 0;
-                    octValue = 0;
-                }
-            }
-            else if (isOctalChar(ch))
-            {
-                // The last character we have read was a '\\',
-                // so we check now for a digit to find stuff like \005
-                octValue = (ch - '0') & 0x07;
-                octEscape = true;
-                octCharCount = 1;
-            }
-            else
-            {
-                // Ignore end of line characters when reading escaped sequences
-                if (ch != '\n' && ch != '\r')
-                {
-                    // Handle plain escape sequences
-                    char escapedCh = getEscapedCharacter(ch);
-                    if (escapedCh != '\0')
-                        m_charBuffer.push_back(escapedCh);
-                }
-
-                escape = false;
-            }
-        }
-        else
-        {
-            // Handle raw characters
-            if (balanceCount == 0 && ch == ')')
-                break;
-
-            if (ch == '(')
-                balanceCount++;
-            else if (ch == ')')
-                balanceCount--;
-
-            escape = ch == '\\';
-            if (!escape)
-                m_charBuffer.push_back(static_cast<char>(ch));
-        }
-    }
-
-    // In case the string ends with a octal escape sequence
-    if (octEscape)
-        m_charBuffer.push_back(octValue);
-
+    readString(device, m_charBuffer);
     if (m_charBuffer.size() != 0)
     {
         if (encrypt != nullptr)
@@ -626,6 +530,42 @@ void PdfTokenizer::ReadHexString(InputStreamDevice& device, PdfVariant& variant,
 }
 
 void PdfTokenizer::ReadName(InputStreamDevice& device, PdfVariant& variant)
+{
+    string_view name;
+    if (tryReadEscapedName(device, name))
+        variant = PdfName::FromEscaped(name);
+    else
+        variant = PdfName();
+}
+
+void PdfTokenizer::ReadStringTo(InputStreamDevice& device, charbuff& buffer)
+{
+    readString(device, buffer);
+}
+
+void PdfTokenizer::ReadHexStringTo(InputStreamDevice& device, charbuff& buffer)
+{
+    readHexString(device, m_charBuffer);
+    unsigned char hi;
+    unsigned char low;
+    for (size_t i = 0; i < m_charBuffer.size(); i += 2)
+    {
+        // NOTE: readHexString() pads to an even length
+        // and it stores only valid hex digits
+        (void)utls::TryGetHexValue(m_charBuffer[i], hi);
+        (void)utls::TryGetHexValue(m_charBuffer[i + 1], low);
+        buffer.push_back((char)((hi << 4) | low));
+    }
+}
+
+void PdfTokenizer::ReadNameTo(InputStreamDevice& device, charbuff& buffer)
+{
+    string_view name;
+    if (tryReadEscapedName(device, name))
+        utls::UnescapeNameTo(buffer, name);
+}
+
+bool PdfTokenizer::tryReadEscapedName(InputStreamDevice& device, string_view& name)
 {
     // Do special checking for empty names
     // as tryReadNextToken will ignore white spaces
@@ -637,25 +577,24 @@ void PdfTokenizer::ReadName(InputStreamDevice& device, PdfVariant& variant)
     {
         // We have an empty PdfName
         // NOTE: Delimiters are handled correctly by tryReadNextToken
-        variant = PdfName();
-        return;
+        return false;
     }
 
     PdfTokenType tokenType;
-    string_view token;
-    bool gotToken = this->TryReadNextToken(device, token, tokenType);
+    bool gotToken = this->TryReadNextToken(device, name, tokenType);
     if (!gotToken || tokenType != PdfTokenType::Literal)
     {
         // We got an empty name which is legal according to the PDF specification
         // Some weird PDFs even use them.
-        variant = PdfName();
 
         // Enqueue the token again
         if (gotToken)
-            EnqueueToken(token, tokenType);
+            EnqueueToken(name, tokenType);
+
+        return false;
     }
-    else
-        variant = PdfName::FromEscaped(token);
+
+    return true;
 }
 
 void PdfTokenizer::EnqueueToken(const string_view& token, PdfTokenType tokenType)
@@ -779,6 +718,108 @@ char getEscapedCharacter(char ch)
     }
 }
 
+// Read the string appending the unescaped characters to the buffer
+void readString(InputStreamDevice& device, charbuff& buffer)
+{
+    char ch;
+    bool escape = false;
+    bool octEscape = false;
+    int octCharCount = 0;
+    char octValue = 0;
+    int balanceCount = 0; // Balanced parenthesis do not have to be escaped in strings
+
+    while (device.Read(ch))
+    {
+        if (escape)
+        {
+            // Handle escape sequences
+            if (octEscape)
+            {
+                // Handle octal escape sequences
+                octCharCount++;
+
+                if (!isOctalChar(ch))
+                {
+                    if (ch == ')')
+                    {
+                        // Handle end of string while reading octal code
+                        // NOTE: The octal value is added outside of the loop
+                        break;
+                    }
+
+                    // No octal character anymore,
+                    // so the octal sequence must be ended
+                    // and the character has to be treated as normal character!
+                    buffer.push_back(octValue);
+
+                    if (ch != '\\')
+                    {
+                        buffer.push_back(ch);
+                        escape = false;
+                    }
+
+                    octEscape = false;
+                    octCharCount = 0;
+                    octValue = 0;
+                    continue;
+                }
+
+                octValue <<= 3;
+                octValue |= ((ch - '0') & 0x07);
+
+                if (octCharCount == 3)
+                {
+                    buffer.push_back(octValue);
+                    escape = false;
+                    octEscape = false;
+                    octCharCount = 0;
+                    octValue = 0;
+                }
+            }
+            else if (isOctalChar(ch))
+            {
+                // The last character we have read was a '\\',
+                // so we check now for a digit to find stuff like \005
+                octValue = (ch - '0') & 0x07;
+                octEscape = true;
+                octCharCount = 1;
+            }
+            else
+            {
+                // Ignore end of line characters when reading escaped sequences
+                if (ch != '\n' && ch != '\r')
+                {
+                    // Handle plain escape sequences
+                    char escapedCh = getEscapedCharacter(ch);
+                    if (escapedCh != '\0')
+                        buffer.push_back(escapedCh);
+                }
+
+                escape = false;
+            }
+        }
+        else
+        {
+            // Handle raw characters
+            if (balanceCount == 0 && ch == ')')
+                break;
+
+            if (ch == '(')
+                balanceCount++;
+            else if (ch == ')')
+                balanceCount--;
+
+            escape = ch == '\\';
+            if (!escape)
+                buffer.push_back(static_cast<char>(ch));
+        }
+    }
+
+    // In case the string ends with a octal escape sequence
+    if (octEscape)
+        buffer.push_back(octValue);
+}
+
 void readHexString(InputStreamDevice& device, charbuff& buffer)
 {
     buffer.clear();
@@ -228,6 +228,21 @@ protected:
      */
     void ReadName(InputStreamDevice& device, PdfVariant& variant);
 
+    /** Read a string from the input device appending
+     *  the unescaped characters to the given buffer
+     */
+    void ReadStringTo(InputStreamDevice& device, charbuff& buffer);
+
+    /** Read a hex string from the input device appending
+     *  the decoded bytes to the given buffer
+     */
+    void ReadHexStringTo(InputStreamDevice& device, charbuff& buffer);
+
+    /** Read a name from the input device appending
+     *  the unescaped name to the given buffer
+     */
+    void ReadNameTo(InputStreamDevice& device, charbuff& buffer);
+
     /** Determine the possible datatype of a token.
      *  Numbers, reals, bools or nullptr values are parsed directly by this function
      *  and saved to a variant.
@@ -237,6 +252,8 @@ protected:
     PdfLiteralDataType DetermineDataType(InputStreamDevice& device, const std::string_view& token, PdfTokenType tokenType, PdfVariant& variant);
 
 private:
+    bool tryReadEscapedName(InputStreamDevice& device, std::string_view& name);
+
     bool tryReadDataType(InputStreamDevice& device, PdfLiteralDataType dataType, PdfVariant& variant, const PdfStatefulEncrypt* encrypt);
 
 private:
@@ -37,6 +37,8 @@
 #include "main/PdfColorSpaceFilter.h"
 #include "main/PdfColor.h"
 #include "main/PdfContentStreamReader.h"
+#include "main/PdfContentStreamCache.h"
+#include "main/PdfTextSearchPattern.h"
 #include "main/PdfPostScriptTokenizer.h"
 #include "main/PdfData.h"
 #include "main/PdfDataProvider.h"
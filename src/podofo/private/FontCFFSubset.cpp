@@ -0,0 +1,1012 @@
+/**
+ * SPDX-FileCopyrightText: (C) 2024 Francesco Pretto <ceztko@gmail.com>
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ * SPDX-License-Identifier: MPL-2.0
+ */
+
+// The format is described in Adobe Technical Note #5176 "The Compact
+// Font Format Specification" and #5177 "The Type 2 Charstring Format"
+
+#include "PdfDeclarationsPrivate.h"
+#include "FontCFFSubset.h"
+
+#include <podofo/private/FreetypePrivate.h>
+#include FT_TRUETYPE_TAGS_H
+
+using namespace std;
+using namespace PoDoFo;
+
+// DICT operators. Two byte operators have
+// the escape byte 12 in the high byte
+static constexpr unsigned OP_UNIQUE_ID = 13;
+static constexpr unsigned OP_XUID = 14;
+static constexpr unsigned OP_CHARSET = 15;
+static constexpr unsigned OP_ENCODING = 16;
+static constexpr unsigned OP_CHARSTRINGS = 17;
+static constexpr unsigned OP_PRIVATE = 18;
+static constexpr unsigned OP_SUBRS = 19;
+static constexpr unsigned OP_CHARSTRING_TYPE = 12 << 8 | 6;
+static constexpr unsigned OP_ROS = 12 << 8 | 30;
+static constexpr unsigned OP_CID_COUNT = 12 << 8 | 34;
+static constexpr unsigned OP_FD_ARRAY = 12 << 8 | 36;
+static constexpr unsigned OP_FD_SELECT = 12 << 8 | 37;
+
+// Predefined charsets and encodings
+static constexpr unsigned CHARSET_ISO_ADOBE = 0;
+static constexpr unsigned CHARSET_EXPERT_SUBSET = 2;
+static constexpr unsigned ISO_ADOBE_LAST_SID = 228;
+static constexpr unsigned ENCODING_EXPERT = 1;
+
+// Type 2 charstrings have a subroutine nesting limit of 10
+static constexpr unsigned MAX_SUBRS_NESTING = 10;
+
+// Type 2 charstring "endchar" operator, used for empty glyphs
+static constexpr string_view EMPTY_CHARSTRING = "\x0E";
+
+// CFF Standard Encoding, mapping codes to standard strings SIDs.
+// Used to resolve the base and accent glyphs of "seac" like endchar
+static const uint8_t s_StandardEncoding[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+    17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+    33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+    49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64,
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80,
+    81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110,
+    0, 111, 112, 113, 114, 0, 115, 116, 117, 118, 119, 120, 121, 122, 0, 123,
+    0, 124, 125, 126, 127, 128, 129, 130, 131, 0, 132, 133, 0, 134, 135, 136,
+    137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 138, 0, 139, 0, 0, 0, 0, 140, 141, 142, 143, 0, 0, 0, 0,
+    0, 144, 0, 0, 0, 145, 0, 0, 146, 147, 148, 149, 0, 0, 0, 0,
+};
+
+static unsigned getSubrBias(size_t subrCount);
+static void writeCard8(string& output, unsigned value);
+static void writeCard16(string& output, unsigned value);
+static void writeIndex(string& output, const cspan<string_view>& items);
+
+FontCFFSubset::FontCFFSubset(const string_view& data) :
+    m_data(data),
+    m_headerSize(0),
+    m_isCIDKeyed(false),
+    m_charStringType(2)
+{
+}
+
+void FontCFFSubset::BuildFont(string& output, const PdfFontMetrics& metrics,
+    const GIDList& gidList)
+{
+    FontCFFSubset subset(getCFFData(metrics));
+    subset.BuildFont(output, gidList, false);
+}
+
+void FontCFFSubset::BuildFontRetainGIDs(string& output, const PdfFontMetrics& metrics,
+    const GIDList& gidList)
+{
+    FontCFFSubset subset(getCFFData(metrics));
+    subset.BuildFont(output, gidList, true);
+}
+
+void FontCFFSubset::BuildFont(string& output, const GIDList& gidList, bool retainGIDs)
+{
+    Init();
+
+    vector<unsigned> gids;
+    vector<bool> usedGIDs;
+    LoadGIDs(gids, usedGIDs, gidList);
+
+    unsigned glyphCount = (unsigned)m_charStringsIndex.Items.size();
+    if (retainGIDs)
+    {
+        gids.resize(glyphCount);
+        for (unsigned gid = 0; gid < glyphCount; gid++)
+            gids[gid] = gid;
+    }
+
+    vector<string_view> charStringItems;
+    charStringItems.reserve(gids.size());
+    for (unsigned gid : gids)
+        charStringItems.push_back(usedGIDs[gid] ? m_charStringsIndex.Items[gid] : EMPTY_CHARSTRING);
+
+    string charStrings;
+    writeIndex(charStrings, charStringItems);
+
+    Dict topDict = m_topDict;
+    removeOperator(topDict, OP_UNIQUE_ID);
+    removeOperator(topDict, OP_XUID);
+
+    // Rebuild the charset, unless it's a predefined
+    // one and the glyph order is retained
+    string charset;
+    auto charsetEntry = findOperator(m_topDict, OP_CHARSET);
+    if (!retainGIDs || (charsetEntry != nullptr && (unsigned)charsetEntry->Values[0] > CHARSET_EXPERT_SUBSET))
+    {
+        writeCard8(charset, 0);
+        for (unsigned i = 1; i < gids.size(); i++)
+        {
+            if (m_isCIDKeyed && !retainGIDs)
+            {
+                // Identity charset: the new GIDs are also the CIDs
+                writeCard16(charset, i);
+            }
+            else
+            {
+                writeCard16(charset, m_charset[gids[i]]);
+            }
+        }
+    }
+
+    // The encoding is not used by CID-keyed fonts and by CIDFonts
+    // in general. If the glyph order is retained, copy it
+    string encoding;
+    if (retainGIDs)
+        encoding = m_encoding;
+    else
+        removeOperator(topDict, OP_ENCODING);
+
+    string fdSelect;
+    if (m_isCIDKeyed)
+    {
+        writeCard8(fdSelect, 0);
+        for (unsigned gid : gids)
+            writeCard8(fdSelect, m_fdSelect[gid]);
+
+        if (!retainGIDs)
+            setOffsetOperands(topDict, OP_CID_COUNT, { (unsigned)gids.size() });
+    }
+
+    // Write the private DICTs with the local subroutines
+    // immediately following them
+    vector<string> privates(m_fontDicts.size());
+    vector<unsigned> privateSizes(m_fontDicts.size());
+    for (unsigned i = 0; i < m_fontDicts.size(); i++)
+    {
+        auto& fontDict = m_fontDicts[i];
+        if (!fontDict.HasPrivate)
+            continue;
+
+        Dict privateDict = fontDict.Private;
+        auto& privateData = privates[i];
+        if (fontDict.LocalSubrs.Length != 0)
+        {
+            // The DICT size doesn't depend on the offset values
+            setOffsetOperands(privateDict, OP_SUBRS, { 0 });
+            writeDict(privateData, privateDict);
+            setOffsetOperands(privateDict, OP_SUBRS, { (unsigned)privateData.size() });
+            privateData.clear();
+        }
+
+        writeDict(privateData, privateDict);
+        privateSizes[i] = (unsigned)privateData.size();
+        privateData.append(GetData(fontDict.LocalSubrs.Offset, fontDict.LocalSubrs.Length));
+    }
+
+    vector<unsigned> privateOffsets(m_fontDicts.size());
+    unsigned fdArrayOffset = 0;
+    auto updateOffsets = [&](unsigned offset)
+    {
+        if (charset.size() != 0)
+        {
+            setOffsetOperands(topDict, OP_CHARSET, { offset });
+            offset += (unsigned)charset.size();
+        }
+
+        if (encoding.size() != 0)
+        {
+            setOffsetOperands(topDict, OP_ENCODING, { offset });
+            offset += (unsigned)encoding.size();
+        }
+
+        if (fdSelect.size() != 0)
+        {
+            setOffsetOperands(topDict, OP_FD_SELECT, { offset });
+            offset += (unsigned)fdSelect.size();
+        }
+
+        for (unsigned i = 0; i < privates.size(); i++)
+        {
+            privateOffsets[i] = offset;
+            offset += (unsigned)privates[i].size();
+        }
+
+        setOffsetOperands(topDict, OP_CHARSTRINGS, { offset });
+        offset += (unsigned)charStrings.size();
+
+        if (m_isCIDKeyed)
+        {
+            fdArrayOffset = offset;
+            setOffsetOperands(topDict, OP_FD_ARRAY, { offset });
+        }
+        else if (m_fontDicts[0].HasPrivate)
+        {
+            setOffsetOperands(topDict, OP_PRIVATE, { privateSizes[0], privateOffsets[0] });
+        }
+    };
+
+    // Compute the top DICT INDEX size first, since it
+    // doesn't depend on the actual offset values
+    updateOffsets(0);
+    string topDictData;
+    writeDict(topDictData, topDict);
+    string topDictIndex;
+    string_view topDictItem = topDictData;
+    writeIndex(topDictIndex, { &topDictItem, 1 });
+
+    updateOffsets(m_headerSize + m_nameIndex.Length + (unsigned)topDictIndex.size()
+        + m_stringIndex.Length + m_globalSubrsIndex.Length);
+    topDictData.clear();
+    writeDict(topDictData, topDict);
+    topDictIndex.clear();
+    topDictItem = topDictData;
+    writeIndex(topDictIndex, { &topDictItem, 1 });
+
+    string fdArray;
+    if (m_isCIDKeyed)
+    {
+        vector<string> fontDictsData(m_fontDicts.size());
+        vector<string_view> fontDictItems(m_fontDicts.size());
+        for (unsigned i = 0; i < m_fontDicts.size(); i++)
+        {
+            Dict fontDict = m_fontDicts[i].Font;
+            if (m_fontDicts[i].HasPrivate)
+                setOffsetOperands(fontDict, OP_PRIVATE, { privateSizes[i], privateOffsets[i] });
+
+            writeDict(fontDictsData[i], fontDict);
+            fontDictItems[i] = fontDictsData[i];
+        }
+
+        writeIndex(fdArray, fontDictItems);
+    }
+
+    output.clear();
+    output.append(GetData(0, m_headerSize));
+    output.append(GetData(m_nameIndex.Offset, m_nameIndex.Length));
+    output.append(topDictIndex);
+    output.append(GetData(m_stringIndex.Offset, m_stringIndex.Length));
+    output.append(GetData(m_globalSubrsIndex.Offset, m_globalSubrsIndex.Length));
+    output.append(charset);
+    output.append(encoding);
+    output.append(fdSelect);
+    for (auto& privateData : privates)
+        output.append(privateData);
+    output.append(charStrings);
+    PODOFO_ASSERT(!m_isCIDKeyed || output.size() == fdArrayOffset);
+    output.append(fdArray);
+}
+
+void FontCFFSubset::Init()
+{
+    if (m_data.size() < 4)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Invalid CFF header");
+
+    if (ReadCard8(0) != 1)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnsupportedFontFormat, "Only CFF version 1 fonts are supported");
+
+    m_headerSize = ReadCard8(2);
+    m_nameIndex = ReadIndex(m_headerSize);
+    m_topDictIndex = ReadIndex(m_nameIndex.Offset + m_nameIndex.Length);
+    if (m_topDictIndex.Items.size() != 1)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnsupportedFontFormat, "CFF font sets are not supported");
+
+    m_stringIndex = ReadIndex(m_topDictIndex.Offset + m_topDictIndex.Length);
+    m_globalSubrsIndex = ReadIndex(m_stringIndex.Offset + m_stringIndex.Length);
+    m_topDict = ReadDict(m_topDictIndex.Items[0]);
+
+    auto entry = findOperator(m_topDict, OP_CHARSTRINGS);
+    if (entry == nullptr)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Missing CFF CharStrings");
+
+    m_charStringsIndex = ReadIndex((unsigned)entry->Values[0]);
+    if (m_charStringsIndex.Items.size() == 0)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Empty CFF CharStrings");
+
+    entry = findOperator(m_topDict, OP_CHARSTRING_TYPE);
+    if (entry != nullptr)
+        m_charStringType = (unsigned)entry->Values[0];
+
+    entry = findOperator(m_topDict, OP_CHARSET);
+    ReadCharset(entry == nullptr ? CHARSET_ISO_ADOBE : (unsigned)entry->Values[0]);
+
+    m_isCIDKeyed = findOperator(m_topDict, OP_ROS) != nullptr;
+    if (m_isCIDKeyed)
+    {
+        entry = findOperator(m_topDict, OP_FD_ARRAY);
+        if (entry == nullptr)
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Missing CFF FDArray");
+
+        auto fdArray = ReadIndex((unsigned)entry->Values[0]);
+        m_fontDicts.resize(fdArray.Items.size());
+        for (unsigned i = 0; i < fdArray.Items.size(); i++)
+        {
+            auto& fontDict = m_fontDicts[i];
+            fontDict.Font = ReadDict(fdArray.Items[i]);
+            auto privateEntry = findOperator(fontDict.Font, OP_PRIVATE);
+            if (privateEntry != nullptr)
+                ReadFontDict(fontDict, *privateEntry);
+        }
+
+        entry = findOperator(m_topDict, OP_FD_SELECT);
+        if (entry == nullptr)
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Missing CFF FDSelect");
+
+        ReadFDSelect((unsigned)entry->Values[0]);
+    }
+    else
+    {
+        entry = findOperator(m_topDict, OP_ENCODING);
+        if (entry != nullptr && (unsigned)entry->Values[0] > ENCODING_EXPERT)
+            ReadEncoding((unsigned)entry->Values[0]);
+
+        // Name-keyed fonts have a single private DICT
+        // referenced by the top DICT
+        m_fontDicts.resize(1);
+        entry = findOperator(m_topDict, OP_PRIVATE);
+        if (entry != nullptr)
+            ReadFontDict(m_fontDicts[0], *entry);
+    }
+}
+
+void FontCFFSubset::LoadGIDs(vector<unsigned>& gids, vector<bool>& usedGIDs, const GIDList& gidList)
+{
+    unsigned glyphCount = (unsigned)m_charStringsIndex.Items.size();
+    usedGIDs.resize(glyphCount);
+
+    // For any fonts, assume that glyph 0 is needed
+    gids.push_back(0);
+    usedGIDs[0] = true;
+    for (unsigned gid : gidList)
+    {
+        if (gid >= glyphCount)
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InternalLogic, "GID out of range");
+
+        if (usedGIDs[gid])
+            continue;
+
+        gids.push_back(gid);
+        usedGIDs[gid] = true;
+    }
+
+    // Type 2 charstrings can't reference other glyphs, except
+    // for the deprecated "seac" like form of endchar, that
+    // composes a standard encoded base and accent glyphs
+    if (m_isCIDKeyed || m_charStringType != 2)
+        return;
+
+    auto& localSubrs = m_fontDicts[0].LocalSubrs;
+    unsigned gid;
+    for (unsigned i = 0; i < gids.size(); i++)
+    {
+        CharStringContext ctx;
+        ScanCharString(ctx, m_charStringsIndex.Items[gids[i]], localSubrs);
+        if (!ctx.HasSeac)
+            continue;
+
+        for (unsigned code : { ctx.BaseCode, ctx.AccentCode })
+        {
+            if (TryGetGIDFromStandardCode(code, gid) && !usedGIDs[gid])
+            {
+                gids.push_back(gid);
+                usedGIDs[gid] = true;
+            }
+        }
+    }
+}
+
+// Partially interpret a Type 2 charstring, just
+// enough to find the operands of a final endchar
+void FontCFFSubset::ScanCharString(CharStringContext& ctx, const string_view& charString,
+    const Index& localSubrs)
+{
+    auto& stack = ctx.Stack;
+    size_t i = 0;
+    while (i < charString.size())
+    {
+        unsigned b0 = (uint8_t)charString[i];
+        if (b0 == 28)
+        {
+            if (i + 3 > charString.size())
+            {
+                ctx.Ended = true;
+                return;
+            }
+
+            stack.push_back((int16_t)((uint8_t)charString[i + 1] << 8 | (uint8_t)charString[i + 2]));
+            i += 3;
+            continue;
+        }
+        else if (b0 >= 32 && b0 <= 246)
+        {
+            stack.push_back((int)b0 - 139);
+            i++;
+            continue;
+        }
+        else if (b0 >= 247 && b0 <= 254)
+        {
+            if (i + 2 > charString.size())
+            {
+                ctx.Ended = true;
+                return;
+            }
+
+            unsigned b1 = (uint8_t)charString[i + 1];
+            if (b0 <= 250)
+                stack.push_back(((int)b0 - 247) * 256 + (int)b1 + 108);
+            else
+                stack.push_back(-((int)b0 - 251) * 256 - (int)b1 - 108);
+            i += 2;
+            continue;
+        }
+        else if (b0 == 255)
+        {
+            // 16.16 fixed point number, keep the integer part
+            if (i + 5 > charString.size())
+            {
+                ctx.Ended = true;
+                return;
+            }
+
+            uint32_t value;
+            utls::ReadUInt32BE(charString.data() + i + 1, value);
+            stack.push_back((int32_t)value >> 16);
+            i += 5;
+            continue;
+        }
+
+        i++;
+        switch (b0)
+        {
+            case 1:     // hstem
+            case 3:     // vstem
+            case 18:    // hstemhm
+            case 23:    // vstemhm
+            {
+                ctx.StemCount += (unsigned)stack.size() / 2;
+                stack.clear();
+                break;
+            }
+            case 19:    // hintmask
+            case 20:    // cntrmask
+            {
+                // Operands before a mask are implicit vstem hints
+                ctx.StemCount += (unsigned)stack.size() / 2;
+                stack.clear();
+                i += (ctx.StemCount + 7) / 8;
+                break;
+            }
+            case 10:    // callsubr
+            case 29:    // callgsubr
+            {
+                auto& subrs = b0 == 10 ? localSubrs : m_globalSubrsIndex;
+                if (stack.size() == 0 || ctx.Depth == MAX_SUBRS_NESTING)
+                {
+                    ctx.Ended = true;
+                    return;
+                }
+
+                int index = stack.back() + (int)getSubrBias(subrs.Items.size());
+                stack.pop_back();
+                if (index < 0 || index >= (int)subrs.Items.size())
+                {
+                    ctx.Ended = true;
+                    return;
+                }
+
+                ctx.Depth++;
+                ScanCharString(ctx, subrs.Items[index], localSubrs);
+                ctx.Depth--;
+                if (ctx.Ended)
+                    return;
+
+                break;
+            }
+            case 11:    // return
+            {
+                return;
+            }
+            case 14:    // endchar
+            {
+                if (stack.size() >= 4)
+                {
+                    ctx.HasSeac = true;
+                    ctx.BaseCode = (unsigned)stack[stack.size() - 2] & 0xFF;
+                    ctx.AccentCode = (unsigned)stack[stack.size() - 1] & 0xFF;
+                }
+
+                ctx.Ended = true;
+                return;
+            }
+            case 12:    // escape
+            {
+                i++;
+                stack.clear();
+                break;
+            }
+            default:
+            {
+                stack.clear();
+                break;
+            }
+        }
+    }
+}
+
+bool FontCFFSubset::TryGetGIDFromStandardCode(unsigned code, unsigned& gid) const
+{
+    unsigned sid = s_StandardEncoding[code];
+    if (sid != 0)
+    {
+        for (unsigned i = 1; i < m_charset.size(); i++)
+        {
+            if (m_charset[i] == sid)
+            {
+                gid = i;
+                return true;
+            }
+        }
+    }
+
+    gid = 0;
+    return false;
+}
+
+void FontCFFSubset::ReadCharset(unsigned offset)
+{
+    unsigned glyphCount = (unsigned)m_charStringsIndex.Items.size();
+    m_charset.resize(glyphCount);
+    if (offset == CHARSET_ISO_ADOBE)
+    {
+        // The predefined ISOAdobe charset maps GIDs to equal SIDs
+        if (glyphCount > ISO_ADOBE_LAST_SID + 1)
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Too many glyphs for the ISOAdobe charset");
+
+        for (unsigned gid = 1; gid < glyphCount; gid++)
+            m_charset[gid] = (uint16_t)gid;
+
+        return;
+    }
+    else if (offset <= CHARSET_EXPERT_SUBSET)
+    {
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnsupportedFontFormat, "Predefined Expert charsets are not supported");
+    }
+
+    unsigned format = ReadCard8(offset);
+    offset++;
+    switch (format)
+    {
+        case 0:
+        {
+            for (unsigned gid = 1; gid < glyphCount; gid++)
+            {
+                m_charset[gid] = (uint16_t)ReadCard16(offset);
+                offset += 2;
+            }
+            break;
+        }
+        case 1:
+        case 2:
+        {
+            unsigned gid = 1;
+            while (gid < glyphCount)
+            {
+                unsigned first = ReadCard16(offset);
+                unsigned left;
+                if (format == 1)
+                {
+                    left = ReadCard8(offset + 2);
+                    offset += 3;
+                }
+                else
+                {
+                    left = ReadCard16(offset + 2);
+                    offset += 4;
+                }
+
+                for (unsigned i = 0; i <= left && gid < glyphCount; i++)
+                    m_charset[gid++] = (uint16_t)(first + i);
+            }
+            break;
+        }
+        default:
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Invalid CFF charset format");
+    }
+}
+
+void FontCFFSubset::ReadFDSelect(unsigned offset)
+{
+    unsigned glyphCount = (unsigned)m_charStringsIndex.Items.size();
+    m_fdSelect.resize(glyphCount);
+    unsigned format = ReadCard8(offset);
+    offset++;
+    switch (format)
+    {
+        case 0:
+        {
+            for (unsigned gid = 0; gid < glyphCount; gid++)
+                m_fdSelect[gid] = (uint8_t)ReadCard8(offset + gid);
+            break;
+        }
+        case 3:
+        {
+            unsigned rangeCount = ReadCard16(offset);
+            offset += 2;
+            for (unsigned i = 0; i < rangeCount; i++)
+            {
+                unsigned first = ReadCard16(offset);
+                uint8_t fd = (uint8_t)ReadCard8(offset + 2);
+                // The next range first GID, or the sentinel
+                unsigned last = std::min(ReadCard16(offset + 3), glyphCount);
+                for (unsigned gid = first; gid < last; gid++)
+                    m_fdSelect[gid] = fd;
+
+                offset += 3;
+            }
+            break;
+        }
+        default:
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Invalid CFF FDSelect format");
+    }
+
+    for (unsigned gid = 0; gid < glyphCount; gid++)
+    {
+        if (m_fdSelect[gid] >= m_fontDicts.size())
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Invalid CFF FDSelect font DICT index");
+    }
+}
+
+void FontCFFSubset::ReadEncoding(unsigned offset)
+{
+    unsigned format = ReadCard8(offset);
+    unsigned length;
+    switch (format & 0x7F)
+    {
+        case 0:
+            length = 2 + ReadCard8(offset + 1);
+            break;
+        case 1:
+            length = 2 + ReadCard8(offset + 1) * 2;
+            break;
+        default:
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Invalid CFF encoding format");
+    }
+
+    // The high bit signals the presence of supplements
+    if ((format & 0x80) != 0)
+        length += 1 + ReadCard8(offset + length) * 3;
+
+    m_encoding = GetData(offset, length);
+}
+
+void FontCFFSubset::ReadFontDict(FontDict& fontDict, const DictEntry& privateEntry)
+{
+    if (privateEntry.Values.size() != 2)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Invalid CFF Private operands");
+
+    unsigned size = (unsigned)privateEntry.Values[0];
+    unsigned offset = (unsigned)privateEntry.Values[1];
+    fontDict.Private = ReadDict(GetData(offset, size));
+    fontDict.HasPrivate = true;
+
+    // The local subroutines offset is relative to the private DICT
+    auto entry = findOperator(fontDict.Private, OP_SUBRS);
+    if (entry != nullptr)
+        fontDict.LocalSubrs = ReadIndex(offset + (unsigned)entry->Values[0]);
+}
+
+FontCFFSubset::Index FontCFFSubset::ReadIndex(unsigned offset) const
+{
+    Index ret;
+    ret.Offset = offset;
+    unsigned count = ReadCard16(offset);
+    if (count == 0)
+    {
+        ret.Length = 2;
+        return ret;
+    }
+
+    unsigned offSize = ReadCard8(offset + 2);
+    if (offSize == 0 || offSize > 4)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Invalid CFF INDEX offset size");
+
+    // Offsets are relative to the byte preceding the data
+    unsigned offsetsStart = offset + 3;
+    unsigned dataStart = offsetsStart + (count + 1) * offSize - 1;
+    ret.Items.reserve(count);
+    unsigned itemStart = ReadOffset(offsetsStart, offSize);
+    for (unsigned i = 1; i <= count; i++)
+    {
+        unsigned itemEnd = ReadOffset(offsetsStart + i * offSize, offSize);
+        if (itemEnd < itemStart)
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Invalid CFF INDEX offsets");
+
+        ret.Items.push_back(GetData(dataStart + itemStart, itemEnd - itemStart));
+        itemStart = itemEnd;
+    }
+
+    ret.Length = dataStart + itemStart - offset;
+    return ret;
+}
+
+FontCFFSubset::Dict FontCFFSubset::ReadDict(const string_view& data) const
+{
+    Dict ret;
+    DictEntry entry;
+    size_t operandsStart = 0;
+    size_t i = 0;
+    auto checkSize = [&](size_t size) {
+        if (i + size > data.size())
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Invalid CFF DICT data");
+    };
+
+    while (i < data.size())
+    {
+        unsigned b0 = (uint8_t)data[i];
+        if (b0 <= 21)
+        {
+            size_t operatorStart = i;
+            if (b0 == 12)
+            {
+                checkSize(2);
+                entry.Operator = 12 << 8 | (uint8_t)data[i + 1];
+                i += 2;
+            }
+            else
+            {
+                entry.Operator = b0;
+                i++;
+            }
+
+            entry.Operands = data.substr(operandsStart, operatorStart - operandsStart);
+            ret.push_back(std::move(entry));
+            entry = { };
+            operandsStart = i;
+        }
+        else if (b0 == 28)
+        {
+            checkSize(3);
+            entry.Values.push_back((int16_t)((uint8_t)data[i + 1] << 8 | (uint8_t)data[i + 2]));
+            i += 3;
+        }
+        else if (b0 == 29)
+        {
+            checkSize(5);
+            uint32_t value;
+            utls::ReadUInt32BE(data.data() + i + 1, value);
+            entry.Values.push_back((int32_t)value);
+            i += 5;
+        }
+        else if (b0 == 30)
+        {
+            // Real number, made of nibbles terminated by 0xF.
+            // Reals are never offsets, just skip them
+            i++;
+            while (true)
+            {
+                checkSize(1);
+                uint8_t nibbles = (uint8_t)data[i];
+                i++;
+                if ((nibbles & 0x0F) == 0x0F || (nibbles & 0xF0) == 0xF0)
+                    break;
+            }
+            entry.Values.push_back(0);
+        }
+        else if (b0 >= 32 && b0 <= 246)
+        {
+            entry.Values.push_back((int)b0 - 139);
+            i++;
+        }
+        else if (b0 >= 247 && b0 <= 254)
+        {
+            checkSize(2);
+            unsigned b1 = (uint8_t)data[i + 1];
+            if (b0 <= 250)
+                entry.Values.push_back(((int)b0 - 247) * 256 + (int)b1 + 108);
+            else
+                entry.Values.push_back(-((int)b0 - 251) * 256 - (int)b1 - 108);
+            i += 2;
+        }
+        else
+        {
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Invalid CFF DICT operand");
+        }
+    }
+
+    return ret;
+}
+
+string_view FontCFFSubset::GetData(unsigned offset, unsigned length) const
+{
+    if ((size_t)offset + length > m_data.size())
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "CFF data out of bounds");
+
+    return m_data.substr(offset, length);
+}
+
+unsigned FontCFFSubset::ReadCard8(unsigned offset) const
+{
+    return (uint8_t)GetData(offset, 1)[0];
+}
+
+unsigned FontCFFSubset::ReadCard16(unsigned offset) const
+{
+    uint16_t ret;
+    utls::ReadUInt16BE(GetData(offset, 2).data(), ret);
+    return ret;
+}
+
+unsigned FontCFFSubset::ReadOffset(unsigned offset, unsigned offSize) const
+{
+    auto data = GetData(offset, offSize);
+    unsigned ret = 0;
+    for (unsigned i = 0; i < offSize; i++)
+        ret = ret << 8 | (uint8_t)data[i];
+
+    return ret;
+}
+
+string_view FontCFFSubset::getCFFData(const PdfFontMetrics& metrics)
+{
+    if (metrics.GetFontFileType() != PdfFontFileType::Type1CCF)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "The font to be subsetted is not a CFF font");
+
+    auto fontData = metrics.GetOrLoadFontFileData();
+    string_view data(fontData.data(), fontData.size());
+    if (data.size() < 12)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Invalid CFF font data");
+
+    uint32_t tag;
+    utls::ReadUInt32BE(data.data(), tag);
+    if (tag != TTAG_OTTO)
+        return data;
+
+    // OpenType font with CFF outlines: look for the "CFF " table
+    uint16_t tableCount;
+    utls::ReadUInt16BE(data.data() + 4, tableCount);
+    for (unsigned i = 0; i < tableCount; i++)
+    {
+        size_t recordOffset = 12 + (size_t)i * 16;
+        if (recordOffset + 16 > data.size())
+            break;
+
+        uint32_t offset;
+        uint32_t length;
+        utls::ReadUInt32BE(data.data() + recordOffset, tag);
+        utls::ReadUInt32BE(data.data() + recordOffset + 8, offset);
+        utls::ReadUInt32BE(data.data() + recordOffset + 12, length);
+        if (tag != TTAG_CFF)
+            continue;
+
+        if ((size_t)offset + length > data.size())
+            break;
+
+        return data.substr(offset, length);
+    }
+
+    PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Missing OpenType CFF table");
+}
+
+void FontCFFSubset::writeDict(string& output, const Dict& dict)
+{
+    for (auto& entry : dict)
+    {
+        output.append(entry.Operands);
+        if (entry.Operator > 0xFF)
+            writeCard8(output, 12);
+
+        writeCard8(output, entry.Operator & 0xFF);
+    }
+}
+
+// Set the operands with the fixed size 5 bytes integer encoding,
+// so the DICT size doesn't depend on the actual values
+void FontCFFSubset::setOffsetOperands(Dict& dict, unsigned op, const initializer_list<unsigned>& values)
+{
+    DictEntry* entry = const_cast<DictEntry*>(findOperator(dict, op));
+    if (entry == nullptr)
+    {
+        dict.push_back({ });
+        entry = &dict.back();
+        entry->Operator = op;
+    }
+
+    entry->Operands.clear();
+    entry->Values.clear();
+    for (unsigned value : values)
+    {
+        writeCard8(entry->Operands, 29);
+        writeCard16(entry->Operands, value >> 16);
+        writeCard16(entry->Operands, value & 0xFFFF);
+        entry->Values.push_back((int)value);
+    }
+}
+
+void FontCFFSubset::removeOperator(Dict& dict, unsigned op)
+{
+    for (auto it = dict.begin(); it != dict.end(); it++)
+    {
+        if (it->Operator == op)
+        {
+            dict.erase(it);
+            return;
+        }
+    }
+}
+
+const FontCFFSubset::DictEntry* FontCFFSubset::findOperator(const Dict& dict, unsigned op)
+{
+    for (auto& entry : dict)
+    {
+        if (entry.Operator == op)
+        {
+            if (entry.Values.size() == 0)
+                PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Missing CFF DICT operands");
+
+            return &entry;
+        }
+    }
+
+    return nullptr;
+}
+
+unsigned getSubrBias(size_t subrCount)
+{
+    if (subrCount < 1240)
+        return 107;
+    else if (subrCount < 33900)
+        return 1131;
+    else
+        return 32768;
+}
+
+void writeCard8(string& output, unsigned value)
+{
+    output.push_back((char)(value & 0xFF));
+}
+
+void writeCard16(string& output, unsigned value)
+{
+    output.push_back((char)((value >> 8) & 0xFF));
+    output.push_back((char)(value & 0xFF));
+}
+
+void writeIndex(string& output, const cspan<string_view>& items)
+{
+    writeCard16(output, (unsigned)items.size());
+    if (items.size() == 0)
+        return;
+
+    size_t dataSize = 0;
+    for (auto& item : items)
+        dataSize += item.size();
+
+    // Offsets are 1 based
+    unsigned offSize;
+    if (dataSize + 1 <= 0xFF)
+        offSize = 1;
+    else if (dataSize + 1 <= 0xFFFF)
+        offSize = 2;
+    else if (dataSize + 1 <= 0xFFFFFF)
+        offSize = 3;
+    else
+        offSize = 4;
+
+    writeCard8(output, offSize);
+    size_t offset = 1;
+    auto writeOffset = [&](size_t value) {
+        for (unsigned i = offSize; i > 0; i--)
+            output.push_back((char)((value >> ((i - 1) * 8)) & 0xFF));
+    };
+
+    writeOffset(offset);
+    for (auto& item : items)
+    {
+        offset += item.size();
+        writeOffset(offset);
+    }
+
+    for (auto& item : items)
+        output.append(item);
+}
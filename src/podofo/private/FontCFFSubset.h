@@ -0,0 +1,131 @@
+/**
+ * SPDX-FileCopyrightText: (C) 2024 Francesco Pretto <ceztko@gmail.com>
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ * SPDX-License-Identifier: MPL-2.0
+ */
+
+#ifndef PDF_FONT_CFF_SUBSET_H
+#define PDF_FONT_CFF_SUBSET_H
+
+#include <podofo/main/PdfFontMetrics.h>
+
+namespace PoDoFo {
+
+using GIDList = cspan<unsigned>;
+
+/**
+ * This class is able to build a new CFF font with only
+ * certain glyphs from an existing CFF font. Name-keyed,
+ * CID-keyed and OpenType wrapped CFF fonts are supported.
+ * The output is always a bare CFF font program
+ */
+class FontCFFSubset final
+{
+private:
+    FontCFFSubset(const std::string_view& data);
+
+public:
+    /**
+     * Generate a subsetted font where glyph 0 is .notdef and the other
+     * glyphs are renumbered following the order of the given list.
+     * The charset of CID-keyed fonts is rebuilt so the CIDs equal the
+     * new GIDs, as expected by a CIDFontType0 using the subset CIDs
+     *
+     * \param output write the font to this buffer
+     * \param metrics font metrics object for this font
+     * \param gidList a list of gids to load
+     */
+    static void BuildFont(std::string& output, const PdfFontMetrics& metrics,
+        const GIDList& gidList);
+
+    /**
+     * Generate a subsetted font retaining the original glyph order,
+     * charset and encoding, where the unused glyphs are replaced by
+     * empty ones. Suitable for simple fonts, that address the glyphs
+     * by name or with the font builtin encoding
+     */
+    static void BuildFontRetainGIDs(std::string& output, const PdfFontMetrics& metrics,
+        const GIDList& gidList);
+
+private:
+    FontCFFSubset(const FontCFFSubset& rhs) = delete;
+    FontCFFSubset& operator=(const FontCFFSubset& rhs) = delete;
+
+    struct DictEntry
+    {
+        unsigned Operator = 0;
+        std::string Operands;
+        std::vector<int> Values;
+    };
+
+    using Dict = std::vector<DictEntry>;
+
+    struct Index
+    {
+        unsigned Offset = 0;
+        unsigned Length = 0;
+        std::vector<std::string_view> Items;
+    };
+
+    struct FontDict
+    {
+        Dict Font;
+        Dict Private;
+        bool HasPrivate = false;
+        Index LocalSubrs;
+    };
+
+    struct CharStringContext
+    {
+        std::vector<int> Stack;
+        unsigned StemCount = 0;
+        unsigned Depth = 0;
+        bool Ended = false;
+        bool HasSeac = false;
+        unsigned BaseCode = 0;
+        unsigned AccentCode = 0;
+    };
+
+    static std::string_view getCFFData(const PdfFontMetrics& metrics);
+    static void writeDict(std::string& output, const Dict& dict);
+    static void setOffsetOperands(Dict& dict, unsigned op, const std::initializer_list<unsigned>& values);
+    static void removeOperator(Dict& dict, unsigned op);
+    static const DictEntry* findOperator(const Dict& dict, unsigned op);
+
+    void BuildFont(std::string& output, const GIDList& gidList, bool retainGIDs);
+    void Init();
+    void LoadGIDs(std::vector<unsigned>& gids, std::vector<bool>& usedGIDs, const GIDList& gidList);
+    void ScanCharString(CharStringContext& ctx, const std::string_view& charString,
+        const Index& localSubrs);
+    bool TryGetGIDFromStandardCode(unsigned code, unsigned& gid) const;
+    void ReadCharset(unsigned offset);
+    void ReadFDSelect(unsigned offset);
+    void ReadEncoding(unsigned offset);
+    void ReadFontDict(FontDict& fontDict, const DictEntry& privateEntry);
+    Index ReadIndex(unsigned offset) const;
+    Dict ReadDict(const std::string_view& data) const;
+    std::string_view GetData(unsigned offset, unsigned length) const;
+    unsigned ReadCard8(unsigned offset) const;
+    unsigned ReadCard16(unsigned offset) const;
+    unsigned ReadOffset(unsigned offset, unsigned offSize) const;
+
+private:
+    std::string_view m_data;
+    unsigned m_headerSize;
+    bool m_isCIDKeyed;
+    unsigned m_charStringType;
+    Index m_nameIndex;
+    Index m_topDictIndex;
+    Index m_stringIndex;
+    Index m_globalSubrsIndex;
+    Index m_charStringsIndex;
+    Dict m_topDict;
+    std::vector<FontDict> m_fontDicts;
+    std::vector<uint16_t> m_charset;    // GID to SID (name-keyed) or CID (CID-keyed)
+    std::vector<uint8_t> m_fdSelect;
+    std::string_view m_encoding;        // Raw custom encoding, if present
+};
+
+};
+
+#endif // PDF_FONT_CFF_SUBSET_H
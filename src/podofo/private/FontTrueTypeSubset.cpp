@@ -11,13 +11,12 @@
 #include "FontTrueTypeSubset.h"
 
 #include <algorithm>
+#include <mutex>
 
 #include <podofo/private/FreetypePrivate.h>
 #include FT_TRUETYPE_TABLES_H
 #include FT_TRUETYPE_TAGS_H
 
-#include <podofo/auxiliary/StreamDevice.h>
-
 using namespace std;
 using namespace PoDoFo;
 
@@ -38,25 +37,24 @@ ENABLE_BITMASK_OPERATORS(ReqTable);
 
 static constexpr unsigned LENGTH_HEADER12 = 12;
 static constexpr unsigned LENGTH_OFFSETTABLE16 = 16;
+static constexpr unsigned LENGTH_LONGHORMETRIC = 4;
+static constexpr unsigned NO_GID = numeric_limits<unsigned>::max();
 
-//Get the number of bytes to pad the ul, because of 4-byte-alignment.
-static uint32_t GetTableCheksum(const char* buf, uint32_t size);
-
-static bool TryAdvanceCompoundOffset(unsigned& offset, unsigned flags);
+static uint32_t getTableChecksum(const char* buf, size_t size);
+static bool tryAdvanceCompoundOffset(unsigned& offset, unsigned flags);
+static void writeUInt16BE(string& buffer, uint16_t value);
+static void writeUInt32BE(string& buffer, uint32_t value);
 
-FontTrueTypeSubset::FontTrueTypeSubset(InputStreamDevice& device) :
-    m_device(&device),
-    m_isLongLoca(false),
-    m_glyphCount(0),
-    m_HMetricsCount(0),
-    m_HMetricsCountNew(0)
+FontTrueTypeSubset::FontTrueTypeSubset(const bufferview& data, const shared_ptr<const FontInfo>& info) :
+    m_data(data),
+    m_info(info)
 {
 }
 
-void FontTrueTypeSubset::BuildFont(std::string& output, const PdfFontMetrics& metrics,
-    const GIDList& gidList)
+void FontTrueTypeSubset::BuildFont(string& output, const PdfFontMetricsConstPtr& metrics,
+    const GIDList& gidList, bool minimalTables)
 {
-    switch (metrics.GetFontFileType())
+    switch (metrics->GetFontFileType())
     {
         case PdfFontFileType::TrueType:
         case PdfFontFileType::OpenType:
@@ -65,83 +63,77 @@ void FontTrueTypeSubset::BuildFont(std::string& output, const PdfFontMetrics& me
             PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "The font to be subsetted is not a TrueType font");
     }
 
-    SpanStreamDevice input(metrics.GetOrLoadFontFileData());
-    FontTrueTypeSubset subset(input);
-    subset.BuildFont(output, gidList);
+    auto data = metrics->GetOrLoadFontFileData();
+    FontTrueTypeSubset subset(data, getFontInfo(metrics, data));
+    subset.BuildFont(output, gidList, minimalTables);
 }
 
-void FontTrueTypeSubset::BuildFont(string& buffer, const GIDList& gidList)
+void FontTrueTypeSubset::BuildFont(string& buffer, const GIDList& gidList, bool minimalTables)
 {
-    Init();
-
-    GlyphContext context;
-    context.GlyfTableOffset = GetTableOffset(TTAG_glyf);
-    context.LocaTableOffset = GetTableOffset(TTAG_loca);
-    LoadGlyphs(context, gidList);
-    WriteTables(buffer);
+    LoadGlyphs(gidList);
+    WriteTables(buffer, minimalTables);
 }
 
-void FontTrueTypeSubset::Init()
+shared_ptr<const FontTrueTypeSubset::FontInfo> FontTrueTypeSubset::getFontInfo(
+    const PdfFontMetricsConstPtr& metrics, const bufferview& data)
 {
-    InitTables();
-    GetNumberOfGlyphs();
-    SeeIfLongLocaOrNot();
-}
+    struct CacheEntry
+    {
+        weak_ptr<const PdfFontMetrics> Metrics;
+        shared_ptr<const FontInfo> Info;
+    };
+
+    // The parsed table directories are cached process wide, so fonts
+    // shared across documents are parsed only once. The metrics are
+    // weakly referenced to detect recycled addresses
+    static mutex s_mutex;
+    static unordered_map<const PdfFontMetrics*, CacheEntry> s_cache;
 
-unsigned FontTrueTypeSubset::GetTableOffset(unsigned tag)
-{
-    for (auto& table : m_tables)
     {
-        if (table.Tag == tag)
-            return table.Offset;
+        unique_lock<mutex> lock(s_mutex);
+        auto found = s_cache.find(metrics.get());
+        if (found != s_cache.end() && found->second.Metrics.lock() == metrics)
+            return found->second.Info;
     }
-    PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InternalLogic, "table missing");
-}
 
-void FontTrueTypeSubset::GetNumberOfGlyphs()
-{
-    unsigned offset = GetTableOffset(TTAG_maxp);
-
-    m_device->Seek(offset + sizeof(uint32_t) * 1);
-    utls::ReadUInt16BE(*m_device, m_glyphCount);
+    shared_ptr<const FontInfo> info = readFontInfo(data);
 
-    offset = GetTableOffset(TTAG_hhea);
+    unique_lock<mutex> lock(s_mutex);
+    // Prune the entries of the metrics that are gone
+    for (auto it = s_cache.begin(); it != s_cache.end(); )
+    {
+        if (it->second.Metrics.expired())
+            it = s_cache.erase(it);
+        else
+            it++;
+    }
 
-    m_device->Seek(offset + sizeof(uint16_t) * 17);
-    utls::ReadUInt16BE(*m_device, m_HMetricsCount);
+    s_cache[metrics.get()] = { metrics, info };
+    return info;
 }
 
-void FontTrueTypeSubset::InitTables()
+shared_ptr<FontTrueTypeSubset::FontInfo> FontTrueTypeSubset::readFontInfo(const bufferview& data)
 {
-    uint16_t tableCount;
-    m_device->Seek(sizeof(uint32_t) * 1);
-    utls::ReadUInt16BE(*m_device, tableCount);
+    FontTrueTypeSubset reader(data, nullptr);
+    auto info = std::make_shared<FontInfo>();
+    uint16_t tableCount = reader.ReadUInt16(sizeof(uint32_t) * 1);
 
     ReqTable tableMask = ReqTable::none;
     TrueTypeTable tbl;
-
-    for (unsigned short i = 0; i < tableCount; i++)
+    for (unsigned i = 0; i < tableCount; i++)
     {
-        // Name of each table:
-        m_device->Seek(LENGTH_HEADER12 + LENGTH_OFFSETTABLE16 * i);
-        utls::ReadUInt32BE(*m_device, tbl.Tag);
-
-        // Checksum of each table:
-        m_device->Seek(LENGTH_HEADER12 + LENGTH_OFFSETTABLE16 * i + sizeof(uint32_t) * 1);
-        utls::ReadUInt32BE(*m_device, tbl.Checksum);
-
-        // Offset of each table:
-        m_device->Seek(LENGTH_HEADER12 + LENGTH_OFFSETTABLE16 * i + sizeof(uint32_t) * 2);
-        utls::ReadUInt32BE(*m_device, tbl.Offset);
-
-        // Length of each table:
-        m_device->Seek(LENGTH_HEADER12 + LENGTH_OFFSETTABLE16 * i + sizeof(uint32_t) * 3);
-        utls::ReadUInt32BE(*m_device, tbl.Length);
+        unsigned entryOffset = LENGTH_HEADER12 + LENGTH_OFFSETTABLE16 * i;
+        tbl.Tag = reader.ReadUInt32(entryOffset);
+        tbl.Checksum = reader.ReadUInt32(entryOffset + sizeof(uint32_t) * 1);
+        tbl.Offset = reader.ReadUInt32(entryOffset + sizeof(uint32_t) * 2);
+        tbl.Length = reader.ReadUInt32(entryOffset + sizeof(uint32_t) * 3);
 
         // PDF 32000-1:2008 9.9 Embedded Font Programs
         // "These TrueType tables shall always be present if present in the original TrueType font program:
         // 'head', 'hhea', 'loca', 'maxp', 'cvt','prep', 'glyf', 'hmtx' and 'fpgm'. [..]  If used with a
         // CIDFont dictionary, the 'cmap' table is not needed and shall not be present
+        // NOTE: PdfFontCreateFlags::SubsetMinimalTables deliberately drops 'cvt ',
+        // 'fpgm' and 'prep', producing subsets not conforming to this requirement
 
         bool skipTable = false;
         switch (tbl.Tag)
@@ -186,204 +178,186 @@ void FontTrueTypeSubset::InitTables()
                 skipTable = true;
                 break;
         }
-        if (!skipTable)
-            m_tables.push_back(tbl);
+
+        if (skipTable)
+            continue;
+
+        // Validate the table boundaries once, so the tables
+        // can be accessed freely later
+        (void)reader.GetData(tbl.Offset, tbl.Length);
+        info->Tables.push_back(tbl);
     }
 
-    if ((tableMask & ReqTable::all) == ReqTable::none)
+    if ((tableMask & ReqTable::all) != ReqTable::all)
         PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnsupportedFontFormat, "Required TrueType table missing");
+
+    info->GlyphCount = reader.ReadUInt16(getTableOffset(*info, TTAG_maxp) + sizeof(uint32_t) * 1);
+    info->HMetricsCount = reader.ReadUInt16(getTableOffset(*info, TTAG_hhea) + sizeof(uint16_t) * 17);
+    info->IsLongLoca = reader.ReadUInt16(getTableOffset(*info, TTAG_head) + 50) != 0; // 1 for long
+    info->GlyfTableOffset = getTableOffset(*info, TTAG_glyf);
+    info->LocaTableOffset = getTableOffset(*info, TTAG_loca);
+    info->HmtxTableOffset = getTableOffset(*info, TTAG_hmtx);
+    if (info->HMetricsCount == 0 || info->HMetricsCount > info->GlyphCount)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Invalid number of horizontal metrics");
+
+    return info;
 }
 
-void FontTrueTypeSubset::SeeIfLongLocaOrNot()
+const FontTrueTypeSubset::TrueTypeTable* FontTrueTypeSubset::findTable(const FontInfo& info, uint32_t tag)
 {
-    unsigned headOffset = GetTableOffset(TTAG_head);
-    uint16_t isLong;
-    m_device->Seek(headOffset + 50);
-    utls::ReadUInt16BE(*m_device, isLong);
-    m_isLongLoca = (isLong == 0 ? false : true);  // 1 for long
+    for (auto& table : info.Tables)
+    {
+        if (table.Tag == tag)
+            return &table;
+    }
+
+    return nullptr;
 }
 
-void FontTrueTypeSubset::LoadGlyphs(GlyphContext& ctx, const GIDList& gidList)
+unsigned FontTrueTypeSubset::getTableOffset(const FontInfo& info, uint32_t tag)
 {
-    // For any fonts, assume that glyph 0 is needed.
-    LoadGID(ctx, 0);
-    for (unsigned gid : gidList)
-        LoadGID(ctx, gid);
+    auto table = findTable(info, tag);
+    if (table == nullptr)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InternalLogic, "table missing");
 
-    // Map original GIDs to a new index as they will appear in the subset
-    map<unsigned, unsigned> glyphIndexMap;
-    glyphIndexMap.insert({ 0, 0 });
-    m_orderedGIDs.push_back(0);
+    return table->Offset;
+}
+
+void FontTrueTypeSubset::LoadGlyphs(const GIDList& gidList)
+{
+    // Map original GIDs to a new index as they will appear
+    // in the subset. For any fonts, assume that glyph 0 is needed
+    m_glyphIndexMap.assign(m_info->GlyphCount, NO_GID);
+    PushGID(0);
     for (unsigned gid : gidList)
-    {
-        glyphIndexMap.insert({ gid, (unsigned)glyphIndexMap.size() });
-        m_orderedGIDs.push_back(gid);
-    }
+        PushGID(gid);
 
-    for (auto& pair : m_glyphDatas)
+    // Resolve the compound glyphs closure in a single pass: the
+    // components not yet seen are appended to the ordered GIDs
+    // and will be loaded later in the same loop
+    m_glyphDatas.reserve(m_orderedGIDs.size());
+    for (unsigned i = 0; i < m_orderedGIDs.size(); i++)
     {
-        auto& glyphData = pair.second;
-        if (!glyphData.IsCompound)
-            continue;
+        GlyphData glyphData;
+        LoadGID(glyphData, m_orderedGIDs[i]);
+        for (auto& component : glyphData.CompoundComponents)
+            PushGID(component.GlyphIndex);
 
-        GlyphCompoundData cmpData;
-        unsigned offset = 0;
-        while (true)
-        {
-            unsigned componentGlyphIdOffset = glyphData.GlyphAdvOffset + offset;
-            ReadGlyphCompoundData(cmpData, componentGlyphIdOffset);
-            // Try remap the GID
-            auto inserted = glyphIndexMap.insert({ cmpData.GlyphIndex, (unsigned)glyphIndexMap.size() });
-            if (inserted.second)
-            {
-                // If insertion occurred, insert it to the original GIDs ordered list
-                m_orderedGIDs.push_back(cmpData.GlyphIndex);
-            }
-
-            // Insert the compound component using the actual assigned GID
-            glyphData.CompoundComponents.push_back(
-                { (unsigned)(componentGlyphIdOffset + sizeof(uint16_t)) - glyphData.GlyphOffset, inserted.first->second });
-            if (!TryAdvanceCompoundOffset(offset, cmpData.Flags))
-                break;
-        }
+        m_glyphDatas.push_back(std::move(glyphData));
     }
 }
 
-void FontTrueTypeSubset::LoadGID(GlyphContext& ctx, unsigned gid)
+void FontTrueTypeSubset::PushGID(unsigned gid)
 {
-    if (gid >= m_glyphCount)
+    if (gid >= m_info->GlyphCount)
         PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InternalLogic, "GID out of range");
 
-    if (m_glyphDatas.find(gid) != m_glyphDatas.end())
+    if (m_glyphIndexMap[gid] != NO_GID)
         return;
 
-    // Try to advance new count of HMetrics
-    if (gid < m_HMetricsCount)
-        m_HMetricsCountNew++;
+    m_glyphIndexMap[gid] = (unsigned)m_orderedGIDs.size();
+    m_orderedGIDs.push_back(gid);
+}
 
-    // https://docs.microsoft.com/en-us/typography/opentype/spec/loca
-    auto& glyphData = m_glyphDatas[gid] = { };
-    if (m_isLongLoca)
+// https://docs.microsoft.com/en-us/typography/opentype/spec/loca
+// https://docs.microsoft.com/en-us/typography/opentype/spec/glyf
+void FontTrueTypeSubset::LoadGID(GlyphData& glyphData, unsigned gid)
+{
+    unsigned offset1;
+    unsigned offset2;
+    if (m_info->IsLongLoca)
     {
-        uint32_t offset1;
-        uint32_t offset2;
-        m_device->Seek(ctx.LocaTableOffset + sizeof(uint32_t) * gid);
-        utls::ReadUInt32BE(*m_device, offset1);
-
-        m_device->Seek(ctx.LocaTableOffset + sizeof(uint32_t) * (gid + 1));
-        utls::ReadUInt32BE(*m_device, offset2);
-
-        glyphData.GlyphLength = offset2 - offset1;
-        glyphData.GlyphOffset = ctx.GlyfTableOffset + offset1;
+        offset1 = ReadUInt32(m_info->LocaTableOffset + sizeof(uint32_t) * gid);
+        offset2 = ReadUInt32(m_info->LocaTableOffset + sizeof(uint32_t) * (gid + 1));
     }
     else
     {
-        uint16_t offset1;
-        uint16_t offset2;
-
-        m_device->Seek(ctx.LocaTableOffset + sizeof(uint16_t) * gid);
-        utls::ReadUInt16BE(*m_device, offset1);
-        unsigned uoffset1 = (unsigned)offset1 << 1u; // Handle the possible overflow
-
-        m_device->Seek(ctx.LocaTableOffset + sizeof(uint16_t) * (gid + 1));
-        utls::ReadUInt16BE(*m_device, offset2);
-        unsigned uoffset2 = (unsigned)offset2 << 1u; // Handle the possible overflow
-
-        glyphData.GlyphLength = uoffset2 - uoffset1;
-        glyphData.GlyphOffset = ctx.GlyfTableOffset + uoffset1;
+        // Handle the possible overflow
+        offset1 = (unsigned)ReadUInt16(m_info->LocaTableOffset + sizeof(uint16_t) * gid) << 1u;
+        offset2 = (unsigned)ReadUInt16(m_info->LocaTableOffset + sizeof(uint16_t) * (gid + 1)) << 1u;
     }
 
-    glyphData.GlyphAdvOffset = glyphData.GlyphOffset + 5 * sizeof(uint16_t);
+    if (offset2 < offset1)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Invalid glyph location");
+
+    glyphData.GlyphOffset = m_info->GlyfTableOffset + offset1;
+    glyphData.GlyphLength = offset2 - offset1;
 
     // NOTE: Some fonts may truncate countour section,
     // skip reading on EOF in that case
-    m_device->Seek(glyphData.GlyphOffset);
-    if (!m_device->Eof())
+    if (glyphData.GlyphLength < sizeof(int16_t)
+        || glyphData.GlyphOffset + sizeof(int16_t) > m_data.size())
     {
-        utls::ReadInt16BE(*m_device, ctx.ContourCount);
-        if (ctx.ContourCount < 0)
-        {
-            glyphData.IsCompound = true;
-            LoadCompound(ctx, glyphData);
-        }
+        glyphData.GlyphLength = 0;
+        return;
     }
-}
 
-void FontTrueTypeSubset::LoadCompound(GlyphContext& ctx, const GlyphData& data)
-{
-    GlyphCompoundData cmpData;
-    unsigned offset = 0;
+    auto glyph = GetData(glyphData.GlyphOffset, glyphData.GlyphLength);
+    int16_t contourCount = (int16_t)ReadUInt16(glyphData.GlyphOffset);
+    if (contourCount >= 0)
+        return;
+
+    glyphData.IsCompound = true;
+
+    // The components follow the number of contours and the bounding box
+    unsigned offset = 5 * sizeof(uint16_t);
     while (true)
     {
-        ReadGlyphCompoundData(cmpData, data.GlyphAdvOffset + offset);
-        LoadGID(ctx, cmpData.GlyphIndex);
-        if (!TryAdvanceCompoundOffset(offset, cmpData.Flags))
+        if (offset + 2 * sizeof(uint16_t) > glyph.size())
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Invalid compound glyph");
+
+        unsigned flags = ReadUInt16(glyphData.GlyphOffset + offset);
+        unsigned componentGid = ReadUInt16(glyphData.GlyphOffset + offset + sizeof(uint16_t));
+        glyphData.CompoundComponents.push_back({ offset + (unsigned)sizeof(uint16_t), componentGid });
+        if (!tryAdvanceCompoundOffset(offset, flags))
             break;
     }
 }
 
-// Ref: https://docs.microsoft.com/en-us/typography/opentype/spec/glyf
-void FontTrueTypeSubset::WriteGlyphTable(OutputStream& output)
+void FontTrueTypeSubset::WriteGlyphTable(string& buffer)
 {
-    for (unsigned gid : m_orderedGIDs)
+    for (auto& glyphData : m_glyphDatas)
     {
-        auto& glyphData = m_glyphDatas[gid];
         if (glyphData.GlyphLength == 0)
             continue;
 
-        if (glyphData.IsCompound)
-        {
-            // Fix the compound glyph data to remap original GIDs indices
-            // as they will appear in the subset
-
-            m_tmpBuffer.resize(glyphData.GlyphLength);
-            m_device->Seek(glyphData.GlyphOffset);
-            m_device->Read(m_tmpBuffer.data(), glyphData.GlyphLength);
-            for (auto& component : glyphData.CompoundComponents)
-                utls::WriteUInt16BE(m_tmpBuffer.data() + component.Offset, (uint16_t)component.GlyphIndex);
-            output.Write(m_tmpBuffer);
-        }
-        else
+        size_t glyphOffset = buffer.size();
+        buffer.append(GetData(glyphData.GlyphOffset, glyphData.GlyphLength));
+
+        // Fix the compound glyph data to remap original GIDs indices
+        // as they will appear in the subset
+        for (auto& component : glyphData.CompoundComponents)
         {
-            // The simple glyph data doesn't need to be fixed
-            CopyData(output, glyphData.GlyphOffset, glyphData.GlyphLength);
+            utls::WriteUInt16BE(buffer.data() + glyphOffset + component.Offset,
+                (uint16_t)m_glyphIndexMap[component.GlyphIndex]);
         }
     }
 }
 
 // The 'hmtx' table contains the horizontal metrics for each glyph in the font
 // https://docs.microsoft.com/en-us/typography/opentype/spec/hmtx
-void FontTrueTypeSubset::WriteHmtxTable(OutputStream& output)
+void FontTrueTypeSubset::WriteHmtxTable(string& buffer)
 {
-    struct LongHorMetrics
-    {
-        uint16_t AdvanceWidth;
-        int16_t LeftSideBearing;
-    };
-
-    unsigned hmtxTableOffset = GetTableOffset(TTAG_hmtx);
-    unsigned leftSideBearingsOffset = hmtxTableOffset + m_HMetricsCount * sizeof(LongHorMetrics);
-    vector<int16_t> leftSideBearings;
+    // Write full horizontal metrics for all the glyphs, so the
+    // order of the glyphs in the subset is not constrained.
+    // Glyphs past the long metrics share the last advance width
+    unsigned hmtxTableOffset = m_info->HmtxTableOffset;
+    unsigned leftSideBearingsOffset = hmtxTableOffset + m_info->HMetricsCount * LENGTH_LONGHORMETRIC;
+    uint16_t lastAdvanceWidth = ReadUInt16(leftSideBearingsOffset - LENGTH_LONGHORMETRIC);
     for (unsigned gid : m_orderedGIDs)
     {
-        if (gid < m_HMetricsCount)
+        if (gid < m_info->HMetricsCount)
         {
             // The full horizontal metrics exists, just copy it
-            CopyData(output, hmtxTableOffset + gid * sizeof(LongHorMetrics), sizeof(LongHorMetrics));
+            buffer.append(GetData(hmtxTableOffset + gid * LENGTH_LONGHORMETRIC, LENGTH_LONGHORMETRIC));
         }
         else
         {
-            // The full horizontal metrics doesn't exists, just copy the left side bearibgs
-            m_device->Seek(leftSideBearingsOffset + sizeof(int16_t) * (gid - m_HMetricsCount));
-            int16_t leftSideBearing;
-            utls::ReadInt16BE(*m_device, leftSideBearing);
-            leftSideBearings.push_back(leftSideBearing);
+            writeUInt16BE(buffer, lastAdvanceWidth);
+            writeUInt16BE(buffer, ReadUInt16(leftSideBearingsOffset
+                + (unsigned)sizeof(int16_t) * (gid - m_info->HMetricsCount)));
         }
     }
-
-    // Write left side bearings
-    for (unsigned i = 0; i < leftSideBearings.size(); i++)
-        utls::WriteInt16BE(output, leftSideBearings[i]);
 }
 
 // "The 'loca' table stores the offsets to the locations
@@ -393,126 +367,156 @@ void FontTrueTypeSubset::WriteHmtxTable(OutputStream& output)
 // entry after the offset that points to the last valid
 // index. This index points to the end of the glyph data"
 // Ref: https://docs.microsoft.com/en-us/typography/opentype/spec/loca
-void FontTrueTypeSubset::WriteLocaTable(OutputStream& output)
+void FontTrueTypeSubset::WriteLocaTable(string& buffer)
 {
     uint32_t glyphAddress = 0;
-    if (m_isLongLoca)
+    if (m_info->IsLongLoca)
     {
-        for (unsigned gid : m_orderedGIDs)
+        for (auto& glyphData : m_glyphDatas)
         {
-            auto& glyphData = m_glyphDatas[gid];
-            utls::WriteUInt32BE(output, glyphAddress);
+            writeUInt32BE(buffer, glyphAddress);
             glyphAddress += glyphData.GlyphLength;
         }
 
         // Last "extra" entry
-        utls::WriteUInt32BE(output, glyphAddress);
+        writeUInt32BE(buffer, glyphAddress);
     }
     else
     {
-        for (unsigned gid : m_orderedGIDs)
+        for (auto& glyphData : m_glyphDatas)
         {
-            auto& glyphData = m_glyphDatas[gid];
-            utls::WriteUInt16BE(output, static_cast<uint16_t>(glyphAddress >> 1));
+            writeUInt16BE(buffer, static_cast<uint16_t>(glyphAddress >> 1));
             glyphAddress += glyphData.GlyphLength;
         }
 
         // Last "extra" entry
-        utls::WriteUInt16BE(output, static_cast<uint16_t>(glyphAddress >> 1));
+        writeUInt16BE(buffer, static_cast<uint16_t>(glyphAddress >> 1));
     }
 }
 
-void FontTrueTypeSubset::WriteTables(string& buffer)
+void FontTrueTypeSubset::WriteTables(string& buffer, bool minimalTables)
 {
-    StringStreamDevice output(buffer);
+    vector<const TrueTypeTable*> tables;
+    for (auto& table : m_info->Tables)
+    {
+        switch (table.Tag)
+        {
+            case TTAG_cvt:
+            case TTAG_fpgm:
+            case TTAG_prep:
+            case TTAG_post:
+                // The hinting programs and the glyph names
+                // are not needed to render the glyphs
+                if (minimalTables)
+                    continue;
+                break;
+            default:
+                break;
+        }
 
-    uint16_t entrySelector = (uint16_t)std::ceil(std::log2(m_tables.size()));
-    uint16_t searchRange = (uint16_t)std::pow(2, entrySelector);
-    uint16_t rangeShift = (16 * (uint16_t)m_tables.size()) - searchRange;
+        tables.push_back(&table);
+    }
+
+    // Estimate the output size to limit reallocations
+    size_t estimatedSize = LENGTH_HEADER12 + LENGTH_OFFSETTABLE16 * tables.size()
+        + m_glyphDatas.size() * (LENGTH_LONGHORMETRIC + sizeof(uint32_t));
+    for (auto& glyphData : m_glyphDatas)
+        estimatedSize += glyphData.GlyphLength;
+    for (auto table : tables)
+    {
+        if (table->Tag != TTAG_glyf && table->Tag != TTAG_loca && table->Tag != TTAG_hmtx)
+            estimatedSize += table->Length + 3;
+    }
+    buffer.reserve(buffer.size() + estimatedSize);
+
+    uint16_t entrySelector = 0;
+    while ((2u << entrySelector) <= tables.size())
+        entrySelector++;
+    uint16_t searchRange = (uint16_t)((1u << entrySelector) * 16);
+    uint16_t rangeShift = (uint16_t)(16 * tables.size() - searchRange);
 
     // Write the font directory table
     // https://docs.microsoft.com/en-us/typography/opentype/spec/otff#tabledirectory
-    utls::WriteUInt32BE(output, 0x00010000);     // Scaler type, 0x00010000 is True type font
-    utls::WriteUInt16BE(output, (uint16_t)m_tables.size());
-    utls::WriteUInt16BE(output, searchRange);
-    utls::WriteUInt16BE(output, entrySelector);
-    utls::WriteUInt16BE(output, rangeShift);
+    size_t fontOffset = buffer.size();
+    writeUInt32BE(buffer, 0x00010000);     // Scaler type, 0x00010000 is True type font
+    writeUInt16BE(buffer, (uint16_t)tables.size());
+    writeUInt16BE(buffer, searchRange);
+    writeUInt16BE(buffer, entrySelector);
+    writeUInt16BE(buffer, rangeShift);
 
-    size_t directoryTableOffset = output.GetPosition();
+    size_t directoryTableOffset = buffer.size();
 
     // Prepare table offsets
-    for (unsigned i = 0; i < m_tables.size(); i++)
+    for (auto table : tables)
     {
-        auto& table = m_tables[i];
-        utls::WriteUInt32BE(output, table.Tag);
+        writeUInt32BE(buffer, table->Tag);
         // Write empty placeholders
-        utls::WriteUInt32BE(output, 0); // Table checksum
-        utls::WriteUInt32BE(output, 0); // Table offset
-        utls::WriteUInt32BE(output, 0); // Table length (actual length not padded length)
+        writeUInt32BE(buffer, 0); // Table checksum
+        writeUInt32BE(buffer, 0); // Table offset
+        writeUInt32BE(buffer, 0); // Table length (actual length not padded length)
     }
 
     nullable<size_t> headOffset;
     size_t tableOffset;
-    for (unsigned i1 = 0; i1 < m_tables.size(); i1++)
+    for (unsigned i = 0; i < tables.size(); i++)
     {
-        auto& table = m_tables[i1];
-        tableOffset = output.GetPosition();
+        auto& table = *tables[i];
+        tableOffset = buffer.size();
         switch (table.Tag)
         {
             case TTAG_head:
                 headOffset = tableOffset;
-                CopyData(output, table.Offset, table.Length);
+                buffer.append(GetData(table.Offset, table.Length));
                 // Set the checkSumAdjustment to 0
-                utls::WriteUInt32BE(buffer.data() + tableOffset + 4, 0);
+                utls::WriteUInt32BE(buffer.data() + tableOffset + 8, 0);
                 break;
             case TTAG_maxp:
                 // https://docs.microsoft.com/en-us/typography/opentype/spec/maxp
-                CopyData(output, table.Offset, table.Length);
+                buffer.append(GetData(table.Offset, table.Length));
                 // Write the number of glyphs in the font
                 utls::WriteUInt16BE(buffer.data() + tableOffset + 4, (uint16_t)m_glyphDatas.size());
                 break;
             case TTAG_hhea:
                 // https://docs.microsoft.com/en-us/typography/opentype/spec/hhea
-                CopyData(output, table.Offset, table.Length);
+                buffer.append(GetData(table.Offset, table.Length));
                 // Write numOfLongHorMetrics, see also 'hmtx' table
-                utls::WriteUInt16BE(buffer.data() + tableOffset + 34, m_HMetricsCountNew);
+                utls::WriteUInt16BE(buffer.data() + tableOffset + 34, (uint16_t)m_glyphDatas.size());
                 break;
             case TTAG_post:
                 // https://docs.microsoft.com/en-us/typography/opentype/spec/post
-                CopyData(output, table.Offset, table.Length);
+                buffer.append(GetData(table.Offset, table.Length));
                 // Enforce 'post' Format 3, written as a Fixed 16.16 number
                 utls::WriteUInt32BE(buffer.data() + tableOffset, 0x00030000);
                 // Clear Type42/Type1 font information
                 memset(buffer.data() + tableOffset + 16, 0, 16);
                 break;
             case TTAG_glyf:
-                WriteGlyphTable(output);
+                WriteGlyphTable(buffer);
                 break;
             case TTAG_loca:
-                WriteLocaTable(output);
+                WriteLocaTable(buffer);
                 break;
             case TTAG_hmtx:
-                WriteHmtxTable(output);
+                WriteHmtxTable(buffer);
                 break;
             case TTAG_cvt:
             case TTAG_fpgm:
             case TTAG_prep:
-                CopyData(output, table.Offset, table.Length);
+                buffer.append(GetData(table.Offset, table.Length));
                 break;
             default:
                 PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidEnumValue, "Unsupported table at this context");
         }
 
         // Align the table length to 4 bytes and pad remaining space with zeroes
-        size_t tableLength = output.GetPosition() - tableOffset;
+        size_t tableLength = buffer.size() - tableOffset;
         size_t tableLengthPadded = (tableLength + 3) & ~3;
-        for (size_t i2 = tableLength; i2 < tableLengthPadded; i2++)
-            output.Write('\0');
+        buffer.append(tableLengthPadded - tableLength, '\0');
 
         // Write dynamic font directory table entries
-        size_t currDirTableOffset = directoryTableOffset + i1 * LENGTH_OFFSETTABLE16;
-        utls::WriteUInt32BE(buffer.data() + currDirTableOffset + 4, GetTableCheksum(buffer.data() + tableOffset, (uint32_t)tableLength));
-        utls::WriteUInt32BE(buffer.data() + currDirTableOffset + 8, (uint32_t)tableOffset);
+        size_t currDirTableOffset = directoryTableOffset + i * LENGTH_OFFSETTABLE16;
+        utls::WriteUInt32BE(buffer.data() + currDirTableOffset + 4, getTableChecksum(buffer.data() + tableOffset, tableLengthPadded));
+        utls::WriteUInt32BE(buffer.data() + currDirTableOffset + 8, (uint32_t)(tableOffset - fontOffset));
         utls::WriteUInt32BE(buffer.data() + currDirTableOffset + 12, (uint32_t)tableLength);
     }
 
@@ -522,23 +526,33 @@ void FontTrueTypeSubset::WriteTables(string& buffer)
 
     // As explained in the "Table Directory"
     // https://docs.microsoft.com/en-us/typography/opentype/spec/otff#tabledirectory
-    uint32_t fontChecksum = 0xB1B0AFBA - GetTableCheksum(buffer.data(), (uint32_t)output.GetPosition());
-    utls::WriteUInt32BE(buffer.data() + *headOffset + 4, fontChecksum);
+    uint32_t fontChecksum = 0xB1B0AFBA - getTableChecksum(buffer.data() + fontOffset, buffer.size() - fontOffset);
+    utls::WriteUInt32BE(buffer.data() + *headOffset + 8, fontChecksum);
+}
+
+string_view FontTrueTypeSubset::GetData(unsigned offset, unsigned length) const
+{
+    if ((size_t)offset + length > m_data.size())
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::InvalidFontData, "Font data out of range");
+
+    return string_view(m_data.data() + offset, length);
+}
+
+uint16_t FontTrueTypeSubset::ReadUInt16(unsigned offset) const
+{
+    uint16_t ret;
+    utls::ReadUInt16BE(GetData(offset, sizeof(uint16_t)).data(), ret);
+    return ret;
 }
 
-void FontTrueTypeSubset::ReadGlyphCompoundData(GlyphCompoundData& data, unsigned offset)
+uint32_t FontTrueTypeSubset::ReadUInt32(unsigned offset) const
 {
-    uint16_t temp;
-    m_device->Seek(offset);
-    utls::ReadUInt16BE(*m_device, temp);
-    data.Flags = temp;
-
-    m_device->Seek(offset + sizeof(uint16_t));
-    utls::ReadUInt16BE(*m_device, temp);
-    data.GlyphIndex = temp;
+    uint32_t ret;
+    utls::ReadUInt32BE(GetData(offset, sizeof(uint32_t)).data(), ret);
+    return ret;
 }
 
-bool TryAdvanceCompoundOffset(unsigned& offset, unsigned flags)
+bool tryAdvanceCompoundOffset(unsigned& offset, unsigned flags)
 {
     constexpr unsigned ARG_1_AND_2_ARE_WORDS = 0x01;
     constexpr unsigned WE_HAVE_A_SCALE = 0x08;
@@ -560,22 +574,33 @@ bool TryAdvanceCompoundOffset(unsigned& offset, unsigned flags)
     return true;
 }
 
-void FontTrueTypeSubset::CopyData(OutputStream& output, unsigned offset, unsigned size)
+uint32_t getTableChecksum(const char* buf, size_t size)
 {
-    m_device->Seek(offset);
-    m_tmpBuffer.resize(size);
-    m_device->Read(m_tmpBuffer.data(), size);
-    output.Write(m_tmpBuffer);
-}
-
-uint32_t GetTableCheksum(const char* buf, uint32_t size)
-{
-    // As explained in the "Table Directory"
+    // As explained in the "Table Directory", the checksum is the
+    // sum of the big endian 32 bit words, the data being padded
     // https://docs.microsoft.com/en-us/typography/opentype/spec/otff#tabledirectory
+    PODOFO_ASSERT(size % 4 == 0);
     uint32_t sum = 0;
-    uint32_t nLongs = (size + 3) / 4;
-    while (nLongs-- > 0)
-        sum += *buf++;
+    uint32_t value;
+    for (size_t i = 0; i < size; i += 4)
+    {
+        utls::ReadUInt32BE(buf + i, value);
+        sum += value;
+    }
 
     return sum;
 }
+
+void writeUInt16BE(string& buffer, uint16_t value)
+{
+    char buf[2];
+    utls::WriteUInt16BE(buf, value);
+    buffer.append(buf, 2);
+}
+
+void writeUInt32BE(string& buffer, uint32_t value)
+{
+    char buf[4];
+    utls::WriteUInt32BE(buf, value);
+    buffer.append(buf, 4);
+}
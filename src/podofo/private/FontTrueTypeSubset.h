@@ -11,9 +11,6 @@
 
 namespace PoDoFo {
 
-class InputStreamDevice;
-class OutputStream;
-
 /**
  * Internal enum specifying the type of a fontfile.
  */
@@ -30,12 +27,16 @@ using GIDList = cspan<unsigned>;
 /**
  * This class is able to build a new TTF font with only
  * certain glyphs from an existing font.
- *
+ * The font file is accessed in memory and the parsed table
+ * directory is cached per font metrics, so it's shared by
+ * all the documents subsetting the same font
  */
 class FontTrueTypeSubset final
 {
 private:
-    FontTrueTypeSubset(InputStreamDevice& device);
+    struct FontInfo;
+
+    FontTrueTypeSubset(const bufferview& data, const std::shared_ptr<const FontInfo>& info);
 
 public:
     /**
@@ -46,25 +47,16 @@ public:
      * \param output write the font to this buffer
      * \param metrics font metrics object for this font
      * \param gidList a list of gids to load
+     * \param minimalTables write only the tables needed to render
+     *        the glyphs, skipping the hinting programs and 'post'
      */
-    static void BuildFont(std::string& output, const PdfFontMetrics& metrics,
-        const GIDList& gidList);
+    static void BuildFont(std::string& output, const PdfFontMetricsConstPtr& metrics,
+        const GIDList& gidList, bool minimalTables = false);
 
 private:
     FontTrueTypeSubset(const FontTrueTypeSubset& rhs) = delete;
     FontTrueTypeSubset& operator=(const FontTrueTypeSubset& rhs) = delete;
 
-    void BuildFont(std::string& buffer, const GIDList& gidList);
-
-    void Init();
-    unsigned GetTableOffset(unsigned tag);
-    void GetNumberOfGlyphs();
-    void SeeIfLongLocaOrNot();
-    void InitTables();
-
-    void CopyData(OutputStream& output, unsigned offset, unsigned size);
-
-private:
     /** Information of TrueType tables.
      */
     struct TrueTypeTable
@@ -75,62 +67,59 @@ private:
         uint32_t Offset = 0;
     };
 
-    struct GlyphCompoundComponentData
-    {
-        unsigned Offset;
-        unsigned GlyphIndex;
-    };
-
-    /** GlyphData contains the glyph address relative
-     *  to the beginning of the "glyf" table.
+    /** Parsed table directory of a font file
      */
-    struct GlyphData
+    struct FontInfo
     {
-        bool IsCompound;
-        unsigned GlyphOffset;       // Offset of common "glyph" data
-        unsigned GlyphLength;
-        unsigned GlyphAdvOffset;    // Offset of uncommon simple/compound "glyph" data
-        std::vector<GlyphCompoundComponentData> CompoundComponents;
+        std::vector<TrueTypeTable> Tables;
+        bool IsLongLoca = false;
+        uint16_t GlyphCount = 0;
+        uint16_t HMetricsCount = 0;
+        unsigned GlyfTableOffset = 0;
+        unsigned LocaTableOffset = 0;
+        unsigned HmtxTableOffset = 0;
     };
 
-    // A CID indexed glyph map
-    using GlyphDatas = std::map<unsigned, GlyphData>;
-
-    struct GlyphContext
+    struct GlyphCompoundComponentData
     {
-        unsigned GlyfTableOffset = 0;
-        unsigned LocaTableOffset = 0;
-        // Used internally during recursive load
-        int16_t ContourCount = 0;
+        unsigned Offset;        // Offset of the component glyph index, relative to the glyph
+        unsigned GlyphIndex;    // Original GID of the component
     };
 
-    struct GlyphCompoundData
+    /** GlyphData contains the glyph address in the font file
+     */
+    struct GlyphData
     {
-        unsigned Flags;
-        unsigned GlyphIndex;
+        bool IsCompound = false;
+        unsigned GlyphOffset = 0;
+        unsigned GlyphLength = 0;
+        std::vector<GlyphCompoundComponentData> CompoundComponents;
     };
 
-    void LoadGlyphs(GlyphContext& ctx, const GIDList& gidList);
-    void LoadGID(GlyphContext& ctx, unsigned gid);
-    void LoadCompound(GlyphContext& ctx, const GlyphData& data);
-    void WriteGlyphTable(OutputStream& output);
-    void WriteHmtxTable(OutputStream& output);
-    void WriteLocaTable(OutputStream& output);
-    void WriteTables(std::string& buffer);
-    void ReadGlyphCompoundData(GlyphCompoundData& data, unsigned offset);
+    static std::shared_ptr<const FontInfo> getFontInfo(const PdfFontMetricsConstPtr& metrics,
+        const bufferview& data);
+    static std::shared_ptr<FontInfo> readFontInfo(const bufferview& data);
+    static const TrueTypeTable* findTable(const FontInfo& info, uint32_t tag);
+    static unsigned getTableOffset(const FontInfo& info, uint32_t tag);
+
+    void BuildFont(std::string& buffer, const GIDList& gidList, bool minimalTables);
+    void LoadGlyphs(const GIDList& gidList);
+    void LoadGID(GlyphData& glyphData, unsigned gid);
+    void PushGID(unsigned gid);
+    void WriteGlyphTable(std::string& buffer);
+    void WriteHmtxTable(std::string& buffer);
+    void WriteLocaTable(std::string& buffer);
+    void WriteTables(std::string& buffer, bool minimalTables);
+    std::string_view GetData(unsigned offset, unsigned length) const;
+    uint16_t ReadUInt16(unsigned offset) const;
+    uint32_t ReadUInt32(unsigned offset) const;
 
 private:
-    InputStreamDevice* m_device;
-
-    bool m_isLongLoca;
-    uint16_t m_glyphCount;
-    uint16_t m_HMetricsCount;
-    uint16_t m_HMetricsCountNew;
-
-    std::vector<TrueTypeTable> m_tables;
-    GlyphDatas m_glyphDatas;
-    std::vector<unsigned> m_orderedGIDs; // Ordered list of original GIDs as they will appear in the subset
-    charbuff m_tmpBuffer;
+    bufferview m_data;
+    std::shared_ptr<const FontInfo> m_info;
+    std::vector<GlyphData> m_glyphDatas;    // Glyph datas, indexed by the GIDs in the subset
+    std::vector<unsigned> m_orderedGIDs;    // Ordered list of original GIDs as they will appear in the subset
+    std::vector<unsigned> m_glyphIndexMap;  // Map original GIDs to the GIDs in the subset
 };
 
 };
@@ -7,9 +7,54 @@
 #include "PdfDeclarationsPrivate.h"
 #include "ImageUtils.h"
 
+#include <podofo/main/PdfCommon.h>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define PODOFO_IMAGE_SSSE3
+#include <tmmintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define SSSE3_TARGET
+#else
+#define SSSE3_TARGET __attribute__((target("ssse3")))
+#endif
+#elif (defined(__aarch64__) || defined(_M_ARM64)) && defined(PODOFO_IS_LITTLE_ENDIAN)
+#define PODOFO_IMAGE_NEON
+#include <arm_neon.h>
+#endif
+
 using namespace std;
 using namespace PoDoFo;
 
+namespace
+{
+    // A scan line conversion of 8 bit samples expressed as a byte
+    // shuffle of a block of pixels, with the alpha channel either
+    // merged from a separate line or set to opaque
+    struct ShuffleKernel
+    {
+        unsigned SrcBpp;
+        unsigned DstBpp;
+        unsigned BlockPixels;
+        unsigned char ColorMask[16];
+        unsigned char AlphaMask[16];
+        unsigned char OpaqueMask[16];
+    };
+
+    // Contributions of the source samples to the destination
+    // samples along one of the resampling axes
+    struct ResampleAxis
+    {
+        vector<unsigned> Starts;     // First source index, for every destination index
+        vector<unsigned> Offsets;    // Offset of the first weight, for every destination index plus one
+        vector<uint16_t> Weights;    // Weights of every destination index summing to ResampleOne
+    };
+
+    // Precision of the resampling weights
+    constexpr unsigned ResampleShift = 12;
+    constexpr unsigned ResampleOne = 1u << ResampleShift;
+}
+
 #ifdef PODOFO_IS_LITTLE_ENDIAN
 #define FETCH_BIT(bytes, idx) ((bytes[idx / 8] >> (7 - (idx % 8))) & 1)
 #else // PODOFO_IS_BIG_ENDIAN
@@ -27,38 +72,81 @@ static void fetchScanLineGrayScale(unsigned char* dstScanLine, PdfPixelFormat fo
 static void fetchScanLineGrayScale(unsigned char* dstScanLine, PdfPixelFormat format,
     const unsigned char* srcScanLine, unsigned width,
     const unsigned char* srcAphaLine);
-static void fetchScanLineBW(unsigned char* dstScanLine, PdfPixelFormat format,
-    const unsigned char* srcScanLine, unsigned width);
-static void fetchScanLineBW(unsigned char* dstScanLine, PdfPixelFormat format,
-    const unsigned char* srcScanLine, unsigned width,
-    const unsigned char* srcAphaLine);
+static void unpackScanLineBW(unsigned char* dstScanLine, const unsigned char* srcScanLine, unsigned width);
+static void fetchScanLineSimd(unsigned char*& dstScanLine, PdfPixelFormat format,
+    const unsigned char*& srcScanLine, unsigned srcBpp, unsigned& width);
+static void fetchScanLineSimd(unsigned char*& dstScanLine, PdfPixelFormat format,
+    const unsigned char*& srcScanLine, unsigned srcBpp, unsigned& width,
+    const unsigned char*& srcAphaLine);
+static unsigned shuffleScanLine(unsigned char* dstScanLine, const unsigned char* srcScanLine,
+    const unsigned char* srcAphaLine, unsigned width, const ShuffleKernel& kernel);
+static bool tryGetShuffleKernel(PdfPixelFormat format, unsigned srcBpp, bool hasAlpha, ShuffleKernel& kernel);
+static bool isSimdEnabled();
+static void computeResampleAxis(ResampleAxis& axis, unsigned srcSize, unsigned dstSize);
+static void accumulateRow(uint32_t* acc, const unsigned char* src, size_t count, uint32_t weight);
 
 static charbuff initScanLine(PdfPixelFormat format, unsigned width, int scanLineSizeHint);
+static void readScanLine(InputStream& stream, charbuff& scanLine);
+static void readAlphaLine(InputStream& stream, charbuff& alphaLine);
 
 void utls::FetchImage(OutputStream& stream, PdfPixelFormat format, int scanLineSize,
-    const unsigned char* imageData, unsigned width, unsigned heigth, unsigned bitsPerComponent,
-    const PdfColorSpaceFilter& map, const charbuff& smaskData)
+    InputStream& imageStream, unsigned width, unsigned heigth, unsigned bitsPerComponent,
+    const PdfColorSpaceFilter& map, InputStream* smaskStream)
 {
-    // TODO: Add support for non-trivial /BitsPerComponent. This could be done
+    charbuff scanLine = initScanLine(format, width, scanLineSize);
+    charbuff alphaLine;
+    if (smaskStream != nullptr)
+        alphaLine.resize(width);
+
+    if (bitsPerComponent == 1 && map.IsRawEncoded()
+        && map.GetPixelFormat() == PdfColorSpacePixelFormat::Grayscale)
+    {
+        // Bilevel images: the 1 bit samples are first expanded
+        // to a grayscale line, as for CCITT images
+        charbuff srcScanLine((width + 7) / 8);
+        charbuff grayScanLine(width);
+        for (unsigned i = 0; i < heigth; i++)
+        {
+            readScanLine(imageStream, srcScanLine);
+            unpackScanLineBW((unsigned char*)grayScanLine.data(), (const unsigned char*)srcScanLine.data(), width);
+            if (smaskStream == nullptr)
+            {
+                fetchScanLineGrayScale((unsigned char*)scanLine.data(),
+                    format, (const unsigned char*)grayScanLine.data(), width);
+            }
+            else
+            {
+                readAlphaLine(*smaskStream, alphaLine);
+                fetchScanLineGrayScale((unsigned char*)scanLine.data(),
+                    format, (const unsigned char*)grayScanLine.data(), width,
+                    (const unsigned char*)alphaLine.data());
+            }
+            stream.Write(scanLine.data(), scanLine.size());
+        }
+
+        return;
+    }
+
+    // TODO: Add support for other non-trivial /BitsPerComponent. This could be done
     // by keeping existing optimized fecthScanLine* methods and add other overloads
     // that take bitsPerComponent as an argument
     if (bitsPerComponent != 8)
         PODOFO_RAISE_ERROR_INFO(PdfErrorCode::NotImplemented, "Unsupported /BitsPerComponent");
 
-    charbuff scanLine = initScanLine(format, width, scanLineSize);
     if (map.IsRawEncoded())
     {
         switch (map.GetPixelFormat())
         {
             case PdfColorSpacePixelFormat::Grayscale:
             {
-                unsigned srcScanLineSize = width;
-                if (smaskData.size() == 0)
+                charbuff srcScanLine(width);
+                if (smaskStream == nullptr)
                 {
                     for (unsigned i = 0; i < heigth; i++)
                     {
+                        readScanLine(imageStream, srcScanLine);
                         fetchScanLineGrayScale((unsigned char*)scanLine.data(),
-                            format, imageData + i * srcScanLineSize, width);
+                            format, (const unsigned char*)srcScanLine.data(), width);
                         stream.Write(scanLine.data(), scanLine.size());
                     }
                 }
@@ -66,9 +154,11 @@ void utls::FetchImage(OutputStream& stream, PdfPixelFormat format, int scanLineS
                 {
                     for (unsigned i = 0; i < heigth; i++)
                     {
+                        readScanLine(imageStream, srcScanLine);
+                        readAlphaLine(*smaskStream, alphaLine);
                         fetchScanLineGrayScale((unsigned char*)scanLine.data(),
-                            format, imageData + i * srcScanLineSize, width,
-                            (const unsigned char*)smaskData.data() + i * width);
+                            format, (const unsigned char*)srcScanLine.data(), width,
+                            (const unsigned char*)alphaLine.data());
                         stream.Write(scanLine.data(), scanLine.size());
                     }
                 }
@@ -76,13 +166,14 @@ void utls::FetchImage(OutputStream& stream, PdfPixelFormat format, int scanLineS
             }
             case PdfColorSpacePixelFormat::RGB:
             {
-                unsigned srcScanLineSize = width * 3;
-                if (smaskData.size() == 0)
+                charbuff srcScanLine((size_t)width * 3);
+                if (smaskStream == nullptr)
                 {
                     for (unsigned i = 0; i < heigth; i++)
                     {
+                        readScanLine(imageStream, srcScanLine);
                         fetchScanLineRGB<3>((unsigned char*)scanLine.data(),
-                            format, imageData + i * srcScanLineSize, width);
+                            format, (const unsigned char*)srcScanLine.data(), width);
                         stream.Write(scanLine.data(), scanLine.size());
                     }
                 }
@@ -90,9 +181,11 @@ void utls::FetchImage(OutputStream& stream, PdfPixelFormat format, int scanLineS
                 {
                     for (unsigned i = 0; i < heigth; i++)
                     {
+                        readScanLine(imageStream, srcScanLine);
+                        readAlphaLine(*smaskStream, alphaLine);
                         fetchScanLineRGB<3>((unsigned char*)scanLine.data(),
-                            format, imageData + i * srcScanLineSize, width,
-                            (const unsigned char*)smaskData.data() + i * width);
+                            format, (const unsigned char*)srcScanLine.data(), width,
+                            (const unsigned char*)alphaLine.data());
                         stream.Write(scanLine.data(), scanLine.size());
                     }
                 }
@@ -105,17 +198,18 @@ void utls::FetchImage(OutputStream& stream, PdfPixelFormat format, int scanLineS
     else
     {
         charbuff midwaySourceScanLine(map.GetScanLineSize(width, bitsPerComponent));
-        unsigned srcScanLineSize = map.GetSourceScanLineSize(width, bitsPerComponent);
+        charbuff srcScanLine(map.GetSourceScanLineSize(width, bitsPerComponent));
         switch (map.GetPixelFormat())
         {
             case PdfColorSpacePixelFormat::Grayscale:
             {
-                if (smaskData.size() == 0)
+                if (smaskStream == nullptr)
                 {
                     for (unsigned i = 0; i < heigth; i++)
                     {
+                        readScanLine(imageStream, srcScanLine);
                         map.FetchScanLine((unsigned char*)midwaySourceScanLine.data(),
-                            imageData + i * srcScanLineSize, width, bitsPerComponent);
+                            (const unsigned char*)srcScanLine.data(), width, bitsPerComponent);
                         fetchScanLineGrayScale((unsigned char*)scanLine.data(),
                             format, (const unsigned char*)midwaySourceScanLine.data(), width);
                         stream.Write(scanLine.data(), scanLine.size());
@@ -125,11 +219,13 @@ void utls::FetchImage(OutputStream& stream, PdfPixelFormat format, int scanLineS
                 {
                     for (unsigned i = 0; i < heigth; i++)
                     {
+                        readScanLine(imageStream, srcScanLine);
+                        readAlphaLine(*smaskStream, alphaLine);
                         map.FetchScanLine((unsigned char*)midwaySourceScanLine.data(),
-                            imageData + i * srcScanLineSize, width, bitsPerComponent);
+                            (const unsigned char*)srcScanLine.data(), width, bitsPerComponent);
                         fetchScanLineGrayScale((unsigned char*)scanLine.data(),
                             format, (unsigned char*)midwaySourceScanLine.data(), width,
-                            (const unsigned char*)smaskData.data() + i * width);
+                            (const unsigned char*)alphaLine.data());
                         stream.Write(scanLine.data(), scanLine.size());
                     }
                 }
@@ -137,12 +233,13 @@ void utls::FetchImage(OutputStream& stream, PdfPixelFormat format, int scanLineS
             }
             case PdfColorSpacePixelFormat::RGB:
             {
-                if (smaskData.size() == 0)
+                if (smaskStream == nullptr)
                 {
                     for (unsigned i = 0; i < heigth; i++)
                     {
+                        readScanLine(imageStream, srcScanLine);
                         map.FetchScanLine((unsigned char*)midwaySourceScanLine.data(),
-                            imageData + i * srcScanLineSize, width, bitsPerComponent);
+                            (const unsigned char*)srcScanLine.data(), width, bitsPerComponent);
                         fetchScanLineRGB<3>((unsigned char*)scanLine.data(),
                             format, (const unsigned char*)midwaySourceScanLine.data(), width);
                         stream.Write(scanLine.data(), scanLine.size());
@@ -152,11 +249,13 @@ void utls::FetchImage(OutputStream& stream, PdfPixelFormat format, int scanLineS
                 {
                     for (unsigned i = 0; i < heigth; i++)
                     {
+                        readScanLine(imageStream, srcScanLine);
+                        readAlphaLine(*smaskStream, alphaLine);
                         map.FetchScanLine((unsigned char*)midwaySourceScanLine.data(),
-                            imageData + i * srcScanLineSize, width, bitsPerComponent);
+                            (const unsigned char*)srcScanLine.data(), width, bitsPerComponent);
                         fetchScanLineRGB<3>((unsigned char*)scanLine.data(),
                             format, (unsigned char*)midwaySourceScanLine.data(), width,
-                            (const unsigned char*)smaskData.data() + i * width);
+                            (const unsigned char*)alphaLine.data());
                         stream.Write(scanLine.data(), scanLine.size());
                     }
                 }
@@ -169,17 +268,23 @@ void utls::FetchImage(OutputStream& stream, PdfPixelFormat format, int scanLineS
 }
 
 void utls::FetchImageCCITT(OutputStream& stream, PdfPixelFormat format, int scanLineSize,
-    fxcodec::ScanlineDecoder& decoder, unsigned width, unsigned heigth, const charbuff& smaskData)
+    fxcodec::ScanlineDecoder& decoder, unsigned width, unsigned heigth, InputStream* smaskStream)
 {
     charbuff scanLine = initScanLine(format, width, scanLineSize);
+    charbuff alphaLine;
+    if (smaskStream != nullptr)
+        alphaLine.resize(width);
 
-    if (smaskData.size() == 0)
+    // The 1 bit samples are first expanded to a grayscale line
+    charbuff grayScanLine(width);
+    if (smaskStream == nullptr)
     {
         for (unsigned i = 0; i < heigth; i++)
         {
             auto scanLineBW = decoder.GetScanline(i);
-            fetchScanLineBW((unsigned char*)scanLine.data(),
-                format, (const unsigned char*)scanLineBW.data(), width);
+            unpackScanLineBW((unsigned char*)grayScanLine.data(), scanLineBW.data(), width);
+            fetchScanLineGrayScale((unsigned char*)scanLine.data(),
+                format, (const unsigned char*)grayScanLine.data(), width);
             stream.Write(scanLine.data(), scanLine.size());
         }
     }
@@ -187,10 +292,12 @@ void utls::FetchImageCCITT(OutputStream& stream, PdfPixelFormat format, int scan
     {
         for (unsigned i = 0; i < heigth; i++)
         {
+            readAlphaLine(*smaskStream, alphaLine);
             auto scanLineBW = decoder.GetScanline(i);
-            fetchScanLineBW((unsigned char*)scanLine.data(),
-                format, scanLineBW.data(), width,
-                (const unsigned char*)smaskData.data() + i * width);
+            unpackScanLineBW((unsigned char*)grayScanLine.data(), scanLineBW.data(), width);
+            fetchScanLineGrayScale((unsigned char*)scanLine.data(),
+                format, (const unsigned char*)grayScanLine.data(), width,
+                (const unsigned char*)alphaLine.data());
             stream.Write(scanLine.data(), scanLine.size());
         }
     }
@@ -199,10 +306,13 @@ void utls::FetchImageCCITT(OutputStream& stream, PdfPixelFormat format, int scan
 #ifdef PODOFO_HAVE_JPEG_LIB
 
 void utls::FetchImageJPEG(OutputStream& stream, PdfPixelFormat format, int scanLineSize,
-    jpeg_decompress_struct* ctx, unsigned width, unsigned heigth, const charbuff& smaskData)
+    jpeg_decompress_struct* ctx, unsigned width, unsigned heigth, InputStream* smaskStream)
 {
     (void)heigth;
     charbuff scanLine = initScanLine(format, width, scanLineSize);
+    charbuff alphaLine;
+    if (smaskStream != nullptr)
+        alphaLine.resize(ctx->output_width);
 
     unsigned rowBytes = (unsigned)(ctx->output_width * ctx->output_components);
 
@@ -213,7 +323,7 @@ void utls::FetchImageJPEG(OutputStream& stream, PdfPixelFormat format, int scanL
     {
         case JCS_RGB:
         {
-            if (smaskData.size() == 0)
+            if (smaskStream == nullptr)
             {
                 for (unsigned i = 0; i < ctx->output_height; i++)
                 {
@@ -227,10 +337,10 @@ void utls::FetchImageJPEG(OutputStream& stream, PdfPixelFormat format, int scanL
             {
                 for (unsigned i = 0; i < ctx->output_height; i++)
                 {
+                    readAlphaLine(*smaskStream, alphaLine);
                     jpeg_read_scanlines(ctx, jScanLine, 1);
                     fetchScanLineRGB<3>((unsigned char*)scanLine.data(), format,
-                        jScanLine[0], ctx->output_width, (const unsigned char*)smaskData.data()
-                        + i * ctx->output_width);
+                        jScanLine[0], ctx->output_width, (const unsigned char*)alphaLine.data());
                     stream.Write(scanLine.data(), scanLine.size());
                 }
             }
@@ -238,7 +348,7 @@ void utls::FetchImageJPEG(OutputStream& stream, PdfPixelFormat format, int scanL
         }
         case JCS_GRAYSCALE:
         {
-            if (smaskData.size() == 0)
+            if (smaskStream == nullptr)
             {
                 for (unsigned i = 0; i < ctx->output_height; i++)
                 {
@@ -252,10 +362,10 @@ void utls::FetchImageJPEG(OutputStream& stream, PdfPixelFormat format, int scanL
             {
                 for (unsigned i = 0; i < ctx->output_height; i++)
                 {
+                    readAlphaLine(*smaskStream, alphaLine);
                     jpeg_read_scanlines(ctx, jScanLine, 1);
                     fetchScanLineGrayScale((unsigned char*)scanLine.data(), format,
-                        jScanLine[0], ctx->output_width, (const unsigned char*)smaskData.data()
-                        + i * ctx->output_width);
+                        jScanLine[0], ctx->output_width, (const unsigned char*)alphaLine.data());
                     stream.Write(scanLine.data(), scanLine.size());
                 }
             }
@@ -263,7 +373,7 @@ void utls::FetchImageJPEG(OutputStream& stream, PdfPixelFormat format, int scanL
         }
         case JCS_CMYK:
         {
-            if (smaskData.size() == 0)
+            if (smaskStream == nullptr)
             {
                 for (unsigned i = 0; i < ctx->output_height; i++)
                 {
@@ -278,11 +388,11 @@ void utls::FetchImageJPEG(OutputStream& stream, PdfPixelFormat format, int scanL
             {
                 for (unsigned i = 0; i < ctx->output_height; i++)
                 {
+                    readAlphaLine(*smaskStream, alphaLine);
                     jpeg_read_scanlines(ctx, jScanLine, 1);
                     ConvertScanlineCYMKToRGB(ctx, jScanLine[0]);
                     fetchScanLineRGB<4>((unsigned char*)scanLine.data(), format,
-                        jScanLine[0], ctx->output_width, (const unsigned char*)smaskData.data()
-                        + i * ctx->output_width);
+                        jScanLine[0], ctx->output_width, (const unsigned char*)alphaLine.data());
                     stream.Write(scanLine.data(), scanLine.size());
                 }
             }
@@ -299,6 +409,7 @@ template <int bpp>
 void fetchScanLineRGB(unsigned char* dstScanLine, PdfPixelFormat format,
     const unsigned char* srcScanLine, unsigned width)
 {
+    fetchScanLineSimd(dstScanLine, format, srcScanLine, bpp, width);
     switch (format)
     {
         case PdfPixelFormat::RGB24:
@@ -374,6 +485,7 @@ template <int bpp>
 void fetchScanLineRGB(unsigned char* dstScanLine, PdfPixelFormat format,
     const unsigned char* srcScanLine, unsigned width, const unsigned char* srcAphaLine)
 {
+    fetchScanLineSimd(dstScanLine, format, srcScanLine, bpp, width, srcAphaLine);
     switch (format)
     {
         // TODO: Handle alpha?
@@ -450,6 +562,7 @@ void fetchScanLineRGB(unsigned char* dstScanLine, PdfPixelFormat format,
 void fetchScanLineGrayScale(unsigned char* dstScanLine, PdfPixelFormat format,
     const unsigned char* srcScanLine, unsigned width)
 {
+    fetchScanLineSimd(dstScanLine, format, srcScanLine, 1, width);
     switch (format)
     {
         case PdfPixelFormat::Grayscale:
@@ -504,6 +617,7 @@ void fetchScanLineGrayScale(unsigned char* dstScanLine, PdfPixelFormat format,
 void fetchScanLineGrayScale(unsigned char* dstScanLine, PdfPixelFormat format,
     const unsigned char* srcScanLine, unsigned width, const unsigned char* srcAphaLine)
 {
+    fetchScanLineSimd(dstScanLine, format, srcScanLine, 1, width, srcAphaLine);
     switch (format)
     {
         // TODO: Handle alpha?
@@ -557,154 +671,463 @@ void fetchScanLineGrayScale(unsigned char* dstScanLine, PdfPixelFormat format,
     }
 }
 
-void fetchScanLineBW(unsigned char* dstScanLine, PdfPixelFormat format,
-    const unsigned char* srcScanLine, unsigned width)
+charbuff initScanLine(PdfPixelFormat format, unsigned width, int scanLineSizeHint)
 {
+    unsigned defaultScanLineSize;
     switch (format)
     {
         case PdfPixelFormat::Grayscale:
         {
-            for (unsigned i = 0; i < width; i++)
-                dstScanLine[i] = (unsigned char)(FETCH_BIT(srcScanLine, i) * 255);
+            defaultScanLineSize = 4 * ((width + 3) / 4);;
             break;
         }
         case PdfPixelFormat::RGB24:
         case PdfPixelFormat::BGR24:
         {
-            for (unsigned i = 0; i < width; i++)
-            {
-                unsigned char value = (unsigned char)(FETCH_BIT(srcScanLine, i) * 255);
-                dstScanLine[i * 3 + 0] = value;
-                dstScanLine[i * 3 + 1] = value;
-                dstScanLine[i * 3 + 2] = value;
-            }
+            defaultScanLineSize = 4 * ((3 * width + 3) / 4);
             break;
         }
         case PdfPixelFormat::RGBA:
         case PdfPixelFormat::BGRA:
+        case PdfPixelFormat::ARGB:
+        case PdfPixelFormat::ABGR:
         {
-            for (unsigned i = 0; i < width; i++)
-            {
-                unsigned char value = (unsigned char)(FETCH_BIT(srcScanLine, i) * 255);
-                dstScanLine[i * 4 + 0] = value;
-                dstScanLine[i * 4 + 1] = value;
-                dstScanLine[i * 4 + 2] = value;
-                dstScanLine[i * 4 + 3] = 255;
-            }
+            defaultScanLineSize = 4 * width;
             break;
         }
-        case PdfPixelFormat::ARGB:
-        case PdfPixelFormat::ABGR:
+        default:
+            PODOFO_RAISE_ERROR(PdfErrorCode::InvalidEnumValue);
+    }
+
+    if (scanLineSizeHint < 0)
+    {
+        return charbuff(defaultScanLineSize);
+    }
+    else
+    {
+        if (scanLineSizeHint < (int)defaultScanLineSize)
+            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnsupportedImageFormat, "The buffer row size is too small");
+
+        return charbuff((size_t)scanLineSizeHint);
+    }
+}
+
+void readScanLine(InputStream& stream, charbuff& scanLine)
+{
+    bool eof;
+    if (stream.Read(scanLine.data(), scanLine.size(), eof) != scanLine.size())
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnsupportedImageFormat, "The source buffer size is too small");
+}
+
+void readAlphaLine(InputStream& stream, charbuff& alphaLine)
+{
+    // Consider the pixels with missing /SMask data as opaque
+    bool eof;
+    size_t read = stream.Read(alphaLine.data(), alphaLine.size(), eof);
+    if (read != alphaLine.size())
+        std::memset(alphaLine.data() + read, 255, alphaLine.size() - read);
+}
+
+void utls::ResampleImage(charbuff& dst, unsigned dstWidth, unsigned dstHeight,
+    const bufferview& src, unsigned srcWidth, unsigned srcHeight,
+    unsigned srcScanLineSize, unsigned components)
+{
+    if (dstWidth == 0 || dstHeight == 0 || dstWidth > srcWidth || dstHeight > srcHeight)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::ValueOutOfRange, "Invalid resampling size");
+
+    size_t rowSamples = (size_t)srcWidth * components;
+    if (srcScanLineSize < rowSamples || src.size() < (size_t)srcScanLineSize * (srcHeight - 1) + rowSamples)
+        PODOFO_RAISE_ERROR_INFO(PdfErrorCode::ValueOutOfRange, "The source buffer size is too small");
+
+    ResampleAxis xAxis;
+    ResampleAxis yAxis;
+    computeResampleAxis(xAxis, srcWidth, dstWidth);
+    computeResampleAxis(yAxis, srcHeight, dstHeight);
+
+    // Separable filter: the covered source rows are first accumulated,
+    // then the covered samples of the accumulated row are summed
+    dst.resize((size_t)dstWidth * dstHeight * components);
+    vector<uint32_t> acc(rowSamples);
+    auto dstSamples = (unsigned char*)dst.data();
+    for (unsigned y = 0; y < dstHeight; y++)
+    {
+        std::fill(acc.begin(), acc.end(), 0);
+        unsigned start = yAxis.Starts[y];
+        for (unsigned i = yAxis.Offsets[y]; i < yAxis.Offsets[y + 1]; i++, start++)
         {
-            for (unsigned i = 0; i < width; i++)
+            accumulateRow(acc.data(), (const unsigned char*)src.data() + (size_t)start * srcScanLineSize,
+                rowSamples, yAxis.Weights[i]);
+        }
+
+        for (unsigned x = 0; x < dstWidth; x++)
+        {
+            for (unsigned c = 0; c < components; c++)
             {
-                unsigned char value = (unsigned char)(FETCH_BIT(srcScanLine, i) * 255);
-                dstScanLine[i * 4 + 0] = 255;
-                dstScanLine[i * 4 + 1] = value;
-                dstScanLine[i * 4 + 2] = value;
-                dstScanLine[i * 4 + 3] = value;
+                uint64_t sum = 0;
+                const uint32_t* samples = acc.data() + (size_t)xAxis.Starts[x] * components + c;
+                for (unsigned i = xAxis.Offsets[x]; i < xAxis.Offsets[x + 1]; i++, samples += components)
+                    sum += (uint64_t)*samples * xAxis.Weights[i];
+
+                *dstSamples++ = (unsigned char)std::min<uint64_t>(
+                    (sum + (1u << (2 * ResampleShift - 1))) >> (2 * ResampleShift), 255);
             }
-            break;
         }
-        default:
-            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnsupportedImageFormat, "Unsupported pixel format");
     }
 }
 
-void fetchScanLineBW(unsigned char* dstScanLine, PdfPixelFormat format,
-    const unsigned char* srcScanLine, unsigned width,
-    const unsigned char* srcAphaLine)
+bool utls::IsImageSimdSupported()
+{
+#if defined(PODOFO_IMAGE_SSSE3)
+#if defined(__SSSE3__)
+    return true;
+#elif defined(_MSC_VER) && !defined(__clang__)
+    static bool s_supported = []() {
+        int info[4];
+        __cpuid(info, 1);
+        return (info[2] & (1 << 9)) != 0;
+    }();
+    return s_supported;
+#else
+    static bool s_supported = __builtin_cpu_supports("ssse3") != 0;
+    return s_supported;
+#endif
+#elif defined(PODOFO_IMAGE_NEON)
+    // NEON is mandatory on AArch64
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool isSimdEnabled()
+{
+    return PdfCommon::IsSimdEnabled() && utls::IsImageSimdSupported();
+}
+
+void fetchScanLineSimd(unsigned char*& dstScanLine, PdfPixelFormat format,
+    const unsigned char*& srcScanLine, unsigned srcBpp, unsigned& width)
 {
+    ShuffleKernel kernel;
+    if (!isSimdEnabled() || !tryGetShuffleKernel(format, srcBpp, false, kernel))
+        return;
+
+    // Let the scalar code convert the remaining pixels
+    unsigned count = shuffleScanLine(dstScanLine, srcScanLine, nullptr, width, kernel);
+    dstScanLine += count * kernel.DstBpp;
+    srcScanLine += count * srcBpp;
+    width -= count;
+}
+
+void fetchScanLineSimd(unsigned char*& dstScanLine, PdfPixelFormat format,
+    const unsigned char*& srcScanLine, unsigned srcBpp, unsigned& width,
+    const unsigned char*& srcAphaLine)
+{
+    ShuffleKernel kernel;
+    if (!isSimdEnabled() || !tryGetShuffleKernel(format, srcBpp, true, kernel))
+        return;
+
+    unsigned count = shuffleScanLine(dstScanLine, srcScanLine, srcAphaLine, width, kernel);
+    dstScanLine += count * kernel.DstBpp;
+    srcScanLine += count * srcBpp;
+    srcAphaLine += count;
+    width -= count;
+}
+
+bool tryGetShuffleKernel(PdfPixelFormat format, unsigned srcBpp, bool hasAlpha, ShuffleKernel& kernel)
+{
+    // Source channel for every destination byte, -1 is alpha
+    static constexpr int GrayscaleChannels[] = { 0 };
+    static constexpr int RGBChannels[] = { 0, 1, 2 };
+    static constexpr int BGRChannels[] = { 2, 1, 0 };
+    static constexpr int RGBAChannels[] = { 0, 1, 2, -1 };
+    static constexpr int BGRAChannels[] = { 2, 1, 0, -1 };
+    static constexpr int ARGBChannels[] = { -1, 0, 1, 2 };
+    static constexpr int ABGRChannels[] = { -1, 2, 1, 0 };
+
+    const int* channels;
+    unsigned dstBpp;
     switch (format)
     {
-        // TODO: Handle alpha?
         case PdfPixelFormat::Grayscale:
-        {
-            for (unsigned i = 0; i < width; i++)
-                dstScanLine[i] = (unsigned char)(FETCH_BIT(srcScanLine, i) * 255);
+            // Only gray to gray conversion is supported
+            if (srcBpp != 1)
+                return false;
+            channels = GrayscaleChannels;
+            dstBpp = 1;
             break;
-        }
-        // TODO: Handle alpha?
         case PdfPixelFormat::RGB24:
+            channels = RGBChannels;
+            dstBpp = 3;
+            break;
         case PdfPixelFormat::BGR24:
-        {
-            for (unsigned i = 0; i < width; i++)
-            {
-                unsigned char value = (unsigned char)(FETCH_BIT(srcScanLine, i) * 255);
-                dstScanLine[i * 3 + 0] = value;
-                dstScanLine[i * 3 + 1] = value;
-                dstScanLine[i * 3 + 2] = value;
-            }
+            channels = BGRChannels;
+            dstBpp = 3;
             break;
-        }
         case PdfPixelFormat::RGBA:
+            channels = RGBAChannels;
+            dstBpp = 4;
+            break;
         case PdfPixelFormat::BGRA:
-        {
-            for (unsigned i = 0; i < width; i++)
-            {
-                unsigned char value = (unsigned char)(FETCH_BIT(srcScanLine, i) * 255);
-                dstScanLine[i * 4 + 0] = value;
-                dstScanLine[i * 4 + 1] = value;
-                dstScanLine[i * 4 + 2] = value;
-                dstScanLine[i * 4 + 3] = srcAphaLine[i];
-            }
+            channels = BGRAChannels;
+            dstBpp = 4;
             break;
-        }
         case PdfPixelFormat::ARGB:
+            channels = ARGBChannels;
+            dstBpp = 4;
+            break;
         case PdfPixelFormat::ABGR:
-        {
-            for (unsigned i = 0; i < width; i++)
-            {
-                unsigned char value = (unsigned char)(FETCH_BIT(srcScanLine, i) * 255);
-                dstScanLine[i * 4 + 0] = srcAphaLine[i];
-                dstScanLine[i * 4 + 1] = value;
-                dstScanLine[i * 4 + 2] = value;
-                dstScanLine[i * 4 + 3] = value;
-            }
+            channels = ABGRChannels;
+            dstBpp = 4;
             break;
-        }
         default:
-            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnsupportedImageFormat, "Unsupported pixel format");
+            return false;
+    }
+
+    // NOTE: The alpha is read 4 bytes at time, that is the
+    // block size when the destination has an alpha channel
+    kernel.SrcBpp = srcBpp;
+    kernel.DstBpp = dstBpp;
+    kernel.BlockPixels = 16 / std::max(srcBpp, dstBpp);
+    std::memset(kernel.ColorMask, 0x80, 16);
+    std::memset(kernel.AlphaMask, 0x80, 16);
+    std::memset(kernel.OpaqueMask, 0, 16);
+    for (unsigned i = 0; i < kernel.BlockPixels; i++)
+    {
+        for (unsigned j = 0; j < dstBpp; j++)
+        {
+            unsigned index = i * dstBpp + j;
+            int channel = channels[j];
+            if (channel >= 0)
+                kernel.ColorMask[index] = (unsigned char)(i * srcBpp + (srcBpp == 1 ? 0 : (unsigned)channel));
+            else if (hasAlpha)
+                kernel.AlphaMask[index] = (unsigned char)i;
+            else
+                kernel.OpaqueMask[index] = 255;
+        }
     }
+
+    return true;
 }
 
-charbuff initScanLine(PdfPixelFormat format, unsigned width, int scanLineSizeHint)
+void computeResampleAxis(ResampleAxis& axis, unsigned srcSize, unsigned dstSize)
 {
-    unsigned defaultScanLineSize;
-    switch (format)
+    // Work in units of 1/dstSize source samples, so the bounds
+    // of the destination samples are integers. The weights are
+    // computed from the rounded cumulative coverage, so they
+    // always sum exactly to ResampleOne
+    axis.Starts.resize(dstSize);
+    axis.Offsets.resize(dstSize + 1);
+    axis.Weights.clear();
+    for (unsigned i = 0; i < dstSize; i++)
     {
-        case PdfPixelFormat::Grayscale:
+        uint64_t lo = (uint64_t)i * srcSize;
+        uint64_t hi = lo + srcSize;
+        unsigned first = (unsigned)(lo / dstSize);
+        unsigned last = (unsigned)((hi - 1) / dstSize);
+        axis.Starts[i] = first;
+        axis.Offsets[i] = (unsigned)axis.Weights.size();
+        uint64_t covered = 0;
+        unsigned prevWeight = 0;
+        for (unsigned j = first; j <= last; j++)
         {
-            defaultScanLineSize = 4 * ((width + 3) / 4);;
-            break;
+            covered += std::min(hi, (uint64_t)(j + 1) * dstSize) - std::max(lo, (uint64_t)j * dstSize);
+            unsigned weight = (unsigned)((covered * ResampleOne + srcSize / 2) / srcSize);
+            axis.Weights.push_back((uint16_t)(weight - prevWeight));
+            prevWeight = weight;
         }
-        case PdfPixelFormat::RGB24:
-        case PdfPixelFormat::BGR24:
+    }
+
+    axis.Offsets[dstSize] = (unsigned)axis.Weights.size();
+}
+
+#if defined(PODOFO_IMAGE_SSSE3)
+
+SSSE3_TARGET static size_t accumulateRowSSSE3(uint32_t* acc, const unsigned char* src,
+    size_t count, uint32_t weight)
+{
+    // Widen the samples to 16 bits and compute the 32 bits
+    // products from their low and high 16 bits halves
+    __m128i zero = _mm_setzero_si128();
+    __m128i w = _mm_set1_epi16((short)weight);
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i samples = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i halves[2] = { _mm_unpacklo_epi8(samples, zero), _mm_unpackhi_epi8(samples, zero) };
+        for (unsigned j = 0; j < 2; j++)
         {
-            defaultScanLineSize = 4 * ((3 * width + 3) / 4);
-            break;
+            __m128i lo = _mm_mullo_epi16(halves[j], w);
+            __m128i hi = _mm_mulhi_epu16(halves[j], w);
+            uint32_t* dst = acc + i + j * 8;
+            _mm_storeu_si128((__m128i*)dst, _mm_add_epi32(
+                _mm_loadu_si128((const __m128i*)dst), _mm_unpacklo_epi16(lo, hi)));
+            _mm_storeu_si128((__m128i*)(dst + 4), _mm_add_epi32(
+                _mm_loadu_si128((const __m128i*)(dst + 4)), _mm_unpackhi_epi16(lo, hi)));
         }
-        case PdfPixelFormat::RGBA:
-        case PdfPixelFormat::BGRA:
-        case PdfPixelFormat::ARGB:
-        case PdfPixelFormat::ABGR:
+    }
+
+    return i;
+}
+
+SSSE3_TARGET static unsigned shuffleScanLineSSSE3(unsigned char* dstScanLine, const unsigned char* srcScanLine,
+    const unsigned char* srcAphaLine, unsigned width, const ShuffleKernel& kernel)
+{
+    __m128i colorMask = _mm_loadu_si128((const __m128i*)kernel.ColorMask);
+    __m128i alphaMask = _mm_loadu_si128((const __m128i*)kernel.AlphaMask);
+    __m128i opaqueMask = _mm_loadu_si128((const __m128i*)kernel.OpaqueMask);
+
+    // Full 16 bytes vectors are loaded and stored, ensure they don't
+    // exceed neither the source nor the destination lines
+    unsigned blockWidth = (16 + std::min(kernel.SrcBpp, kernel.DstBpp) - 1) / std::min(kernel.SrcBpp, kernel.DstBpp);
+    unsigned i = 0;
+    for (; i + blockWidth <= width; i += kernel.BlockPixels)
+    {
+        __m128i pixels = _mm_loadu_si128((const __m128i*)(srcScanLine + i * kernel.SrcBpp));
+        pixels = _mm_or_si128(_mm_shuffle_epi8(pixels, colorMask), opaqueMask);
+        if (srcAphaLine != nullptr)
         {
-            defaultScanLineSize = 4 * width;
-            break;
+            int32_t alpha;
+            std::memcpy(&alpha, srcAphaLine + i, sizeof(alpha));
+            pixels = _mm_or_si128(pixels, _mm_shuffle_epi8(_mm_cvtsi32_si128(alpha), alphaMask));
         }
-        default:
-            PODOFO_RAISE_ERROR(PdfErrorCode::InvalidEnumValue);
+        _mm_storeu_si128((__m128i*)(dstScanLine + i * kernel.DstBpp), pixels);
     }
 
-    if (scanLineSizeHint < 0)
+    return i;
+}
+
+SSSE3_TARGET static unsigned unpackScanLineBWSSSE3(unsigned char* dstScanLine,
+    const unsigned char* srcScanLine, unsigned width)
+{
+    // Replicate every source byte 8 times and test each bit, MSB first
+    __m128i replicateMask = _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1);
+    __m128i bitMask = _mm_setr_epi8((char)128, 64, 32, 16, 8, 4, 2, 1, (char)128, 64, 32, 16, 8, 4, 2, 1);
+    unsigned i = 0;
+    for (; i + 16 <= width; i += 16)
     {
-        return charbuff(defaultScanLineSize);
+        uint16_t bytes;
+        std::memcpy(&bytes, srcScanLine + i / 8, sizeof(bytes));
+        __m128i pixels = _mm_shuffle_epi8(_mm_cvtsi32_si128(bytes), replicateMask);
+        pixels = _mm_cmpeq_epi8(_mm_and_si128(pixels, bitMask), bitMask);
+        _mm_storeu_si128((__m128i*)(dstScanLine + i), pixels);
     }
-    else
+
+    return i;
+}
+
+#elif defined(PODOFO_IMAGE_NEON)
+
+static size_t accumulateRowNEON(uint32_t* acc, const unsigned char* src,
+    size_t count, uint32_t weight)
+{
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16)
     {
-        if (scanLineSizeHint < (int)defaultScanLineSize)
-            PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnsupportedImageFormat, "The buffer row size is too small");
+        uint8x16_t samples = vld1q_u8(src + i);
+        uint16x8_t lo = vmovl_u8(vget_low_u8(samples));
+        uint16x8_t hi = vmovl_u8(vget_high_u8(samples));
+        vst1q_u32(acc + i, vmlal_n_u16(vld1q_u32(acc + i), vget_low_u16(lo), (uint16_t)weight));
+        vst1q_u32(acc + i + 4, vmlal_n_u16(vld1q_u32(acc + i + 4), vget_high_u16(lo), (uint16_t)weight));
+        vst1q_u32(acc + i + 8, vmlal_n_u16(vld1q_u32(acc + i + 8), vget_low_u16(hi), (uint16_t)weight));
+        vst1q_u32(acc + i + 12, vmlal_n_u16(vld1q_u32(acc + i + 12), vget_high_u16(hi), (uint16_t)weight));
+    }
 
-        return charbuff((size_t)scanLineSizeHint);
+    return i;
+}
+
+static unsigned shuffleScanLineNEON(unsigned char* dstScanLine, const unsigned char* srcScanLine,
+    const unsigned char* srcAphaLine, unsigned width, const ShuffleKernel& kernel)
+{
+    uint8x16_t colorMask = vld1q_u8(kernel.ColorMask);
+    uint8x16_t alphaMask = vld1q_u8(kernel.AlphaMask);
+    uint8x16_t opaqueMask = vld1q_u8(kernel.OpaqueMask);
+
+    // Full 16 bytes vectors are loaded and stored, ensure they don't
+    // exceed neither the source nor the destination lines
+    unsigned blockWidth = (16 + std::min(kernel.SrcBpp, kernel.DstBpp) - 1) / std::min(kernel.SrcBpp, kernel.DstBpp);
+    unsigned i = 0;
+    for (; i + blockWidth <= width; i += kernel.BlockPixels)
+    {
+        // NOTE: Out of range indices (0x80) produce zero, as with SSSE3
+        uint8x16_t pixels = vld1q_u8(srcScanLine + i * kernel.SrcBpp);
+        pixels = vorrq_u8(vqtbl1q_u8(pixels, colorMask), opaqueMask);
+        if (srcAphaLine != nullptr)
+        {
+            uint32_t alpha;
+            std::memcpy(&alpha, srcAphaLine + i, sizeof(alpha));
+            pixels = vorrq_u8(pixels, vqtbl1q_u8(vreinterpretq_u8_u32(vdupq_n_u32(alpha)), alphaMask));
+        }
+        vst1q_u8(dstScanLine + i * kernel.DstBpp, pixels);
     }
+
+    return i;
+}
+
+static unsigned unpackScanLineBWNEON(unsigned char* dstScanLine,
+    const unsigned char* srcScanLine, unsigned width)
+{
+    static const uint8_t BitMask[] = { 128, 64, 32, 16, 8, 4, 2, 1, 128, 64, 32, 16, 8, 4, 2, 1 };
+    uint8x16_t bitMask = vld1q_u8(BitMask);
+    unsigned i = 0;
+    for (; i + 16 <= width; i += 16)
+    {
+        uint8x16_t pixels = vcombine_u8(vdup_n_u8(srcScanLine[i / 8]), vdup_n_u8(srcScanLine[i / 8 + 1]));
+        vst1q_u8(dstScanLine + i, vtstq_u8(pixels, bitMask));
+    }
+
+    return i;
+}
+
+#endif
+
+unsigned shuffleScanLine(unsigned char* dstScanLine, const unsigned char* srcScanLine,
+    const unsigned char* srcAphaLine, unsigned width, const ShuffleKernel& kernel)
+{
+#if defined(PODOFO_IMAGE_SSSE3)
+    return shuffleScanLineSSSE3(dstScanLine, srcScanLine, srcAphaLine, width, kernel);
+#elif defined(PODOFO_IMAGE_NEON)
+    return shuffleScanLineNEON(dstScanLine, srcScanLine, srcAphaLine, width, kernel);
+#else
+    (void)dstScanLine;
+    (void)srcScanLine;
+    (void)srcAphaLine;
+    (void)width;
+    (void)kernel;
+    return 0;
+#endif
+}
+
+void unpackScanLineBW(unsigned char* dstScanLine, const unsigned char* srcScanLine, unsigned width)
+{
+    unsigned i = 0;
+    if (isSimdEnabled())
+    {
+#if defined(PODOFO_IMAGE_SSSE3)
+        i = unpackScanLineBWSSSE3(dstScanLine, srcScanLine, width);
+#elif defined(PODOFO_IMAGE_NEON)
+        i = unpackScanLineBWNEON(dstScanLine, srcScanLine, width);
+#endif
+    }
+
+    for (; i < width; i++)
+        dstScanLine[i] = (unsigned char)(FETCH_BIT(srcScanLine, i) * 255);
+}
+
+void accumulateRow(uint32_t* acc, const unsigned char* src, size_t count, uint32_t weight)
+{
+    if (weight == 0)
+        return;
+
+    size_t i = 0;
+    if (isSimdEnabled())
+    {
+#if defined(PODOFO_IMAGE_SSSE3)
+        i = accumulateRowSSSE3(acc, src, count, weight);
+#elif defined(PODOFO_IMAGE_NEON)
+        i = accumulateRowNEON(acc, src, count, weight);
+#endif
+    }
+
+    for (; i < count; i++)
+        acc[i] += src[i] * weight;
 }
@@ -7,6 +7,7 @@
 #ifndef IMAGE_UTILS_H
 #define IMAGE_UTILS_H
 
+#include <podofo/auxiliary/InputStream.h>
 #include <podofo/auxiliary/OutputStream.h>
 #include <podofo/main/PdfColorSpaceFilter.h>
 
@@ -19,20 +20,36 @@
 namespace utls
 {
     /** Fetch a RGB image and write it to the stream
+     * The source image data and the optional /SMask alpha data
+     * are read from the streams one scan line at time
      */
     void FetchImage(PoDoFo::OutputStream& stream, PoDoFo::PdfPixelFormat format, int scanLineSize,
-        const unsigned char* imageData, unsigned width, unsigned heigth, unsigned bitsPerComponent,
-        const PoDoFo::PdfColorSpaceFilter& filter, const PoDoFo::charbuff& smaskData);
+        PoDoFo::InputStream& imageStream, unsigned width, unsigned heigth, unsigned bitsPerComponent,
+        const PoDoFo::PdfColorSpaceFilter& filter, PoDoFo::InputStream* smaskStream);
 
     /** Fetch a Black and White image and write it to the stream
      */
     void FetchImageCCITT(PoDoFo::OutputStream& stream, PoDoFo::PdfPixelFormat format, int scanLineSize,
-        fxcodec::ScanlineDecoder& decoder, unsigned width, unsigned heigth, const PoDoFo::charbuff& smaskData);
+        fxcodec::ScanlineDecoder& decoder, unsigned width, unsigned heigth, PoDoFo::InputStream* smaskStream);
 
 #ifdef PODOFO_HAVE_JPEG_LIB
     void FetchImageJPEG(PoDoFo::OutputStream& stream, PoDoFo::PdfPixelFormat format, int scanLineSize,
-        jpeg_decompress_struct* ctx, unsigned width, unsigned heigth, const PoDoFo::charbuff& smaskData);
+        jpeg_decompress_struct* ctx, unsigned width, unsigned heigth, PoDoFo::InputStream* smaskStream);
 #endif // PODOFO_HAVE_JPEG_LIB
+
+    /** Downsample an image with 8 bit samples by averaging the
+     * source pixels covered by every destination pixel
+     * \param dst the destination buffer, receiving tightly packed rows
+     * \param components the number of samples per pixel
+     * \remarks The destination size must not exceed the source size
+     */
+    void ResampleImage(PoDoFo::charbuff& dst, unsigned dstWidth, unsigned dstHeight,
+        const PoDoFo::bufferview& src, unsigned srcWidth, unsigned srcHeight,
+        unsigned srcScanLineSize, unsigned components);
+
+    /** True if the CPU supports the vectorized scan line conversions
+     */
+    bool IsImageSimdSupported();
 }
 
 #endif // IMAGE_UTILS_H
@@ -283,3 +283,85 @@ void PoDoFo::jpeg_memory_src(j_decompress_ptr ctx, const JOCTET* buffer, size_t
     src->pub.next_input_byte = buffer;
     src->pub.bytes_in_buffer = bufsize;
 }
+
+/* Expanded data source object for stream input */
+struct stream_source_mgr
+{
+    struct jpeg_source_mgr pub; /* public fields */
+    InputStream* stream;
+    JOCTET* buffer;
+};
+
+using stream_src_ptr = stream_source_mgr*;
+
+/*
+ * Fill the input buffer with the next block read from the stream.
+ * On EOF supply a dummy EOI marker, as done by the memory source
+ */
+METHODDEF(boolean) fill_stream_input_buffer(j_decompress_ptr ctx)
+{
+    stream_src_ptr src = reinterpret_cast<stream_src_ptr>(ctx->src);
+    bool eof;
+    size_t read = src->stream->Read(reinterpret_cast<char*>(src->buffer), BLOCK_SIZE, eof);
+    if (read == 0)
+    {
+        WARNMS(ctx, JWRN_JPEG_EOF);
+
+        /* Create a fake EOI marker */
+        src->buffer[0] = static_cast<JOCTET>(0xFF);
+        src->buffer[1] = static_cast<JOCTET>(JPEG_EOI);
+        read = 2;
+    }
+
+    src->pub.next_input_byte = src->buffer;
+    src->pub.bytes_in_buffer = read;
+    return TRUE;
+}
+
+METHODDEF(void) skip_stream_input_data(j_decompress_ptr ctx, long num_bytes)
+{
+    stream_src_ptr src = reinterpret_cast<stream_src_ptr>(ctx->src);
+
+    if (num_bytes > 0)
+    {
+        while (num_bytes > static_cast<long>(src->pub.bytes_in_buffer))
+        {
+            num_bytes -= static_cast<long>(src->pub.bytes_in_buffer);
+            fill_stream_input_buffer(ctx);
+        }
+
+        src->pub.next_input_byte += static_cast<size_t>(num_bytes);
+        src->pub.bytes_in_buffer -= static_cast<size_t>(num_bytes);
+    }
+}
+
+/*
+ * Prepare for input from a stream, that is read incrementally
+ * in blocks while decompressing
+ */
+void PoDoFo::jpeg_stream_src(j_decompress_ptr ctx, InputStream& stream)
+{
+    stream_src_ptr src;
+    if (ctx->src == nullptr)
+    {
+        // first time for this JPEG object?
+        src = static_cast<stream_src_ptr>(
+            (*ctx->mem->alloc_small) (reinterpret_cast<j_common_ptr>(ctx), JPOOL_PERMANENT,
+                sizeof(stream_source_mgr)));
+        src->buffer = static_cast<JOCTET*>(
+            (*ctx->mem->alloc_small) (reinterpret_cast<j_common_ptr>(ctx), JPOOL_PERMANENT,
+                BLOCK_SIZE * sizeof(JOCTET)));
+        ctx->src = &src->pub;
+    }
+
+    src = reinterpret_cast<stream_src_ptr>(ctx->src);
+    src->pub.init_source = init_source;
+    src->pub.fill_input_buffer = fill_stream_input_buffer;
+    src->pub.skip_input_data = skip_stream_input_data;
+    src->pub.resync_to_restart = jpeg_resync_to_restart; /* use default method */
+    src->pub.term_source = term_source;
+    src->stream = &stream;
+
+    src->pub.next_input_byte = nullptr;
+    src->pub.bytes_in_buffer = 0;
+}
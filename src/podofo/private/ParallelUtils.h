@@ -0,0 +1,102 @@
+/**
+ * SPDX-FileCopyrightText: (C) 2022 Francesco Pretto <ceztko@gmail.com>
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ * SPDX-License-Identifier: MPL-2.0
+ */
+
+#ifndef PARALLEL_UTILS_H
+#define PARALLEL_UTILS_H
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// NOTE: The utilities are header only, so they
+// can be used also by the tools
+namespace utls
+{
+    /** Get the number of threads actually used to process
+     * the given number of items with RunParallel()
+     * \param threadCount the requested number of threads.
+     *        0 means the number of hardware threads
+     */
+    inline unsigned GetParallelThreadCount(unsigned count, unsigned threadCount)
+    {
+        if (threadCount == 0)
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+        return std::min(threadCount, count);
+    }
+
+    /** Call fn(index, workerIndex) for all the indices in [0, count)
+     * on a pool of workers, the current thread being one of them.
+     * The indices are fetched dynamically from a shared counter, so
+     * idle workers take over the remaining items. The first exception
+     * stops the workers and it's rethrown to the caller
+     * \param threadCount the requested number of threads.
+     *        0 means the number of hardware threads
+     * \remarks workerIndex is in [0, GetParallelThreadCount(count, threadCount))
+     */
+    template <typename Fn>
+    void RunParallel(unsigned count, unsigned threadCount, const Fn& fn)
+    {
+        threadCount = GetParallelThreadCount(count, threadCount);
+        if (threadCount == 0)
+            return;
+
+        std::mutex mutex;
+        std::atomic<unsigned> nextIndex(0);
+        std::atomic<bool> failed(false);
+        std::exception_ptr error;
+
+        auto worker = [&](unsigned workerIndex) {
+            try
+            {
+                while (!failed)
+                {
+                    unsigned index = nextIndex++;
+                    if (index >= count)
+                        break;
+
+                    fn(index, workerIndex);
+                }
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (error == nullptr)
+                    error = std::current_exception();
+
+                failed = true;
+            }
+        };
+
+        std::vector<std::thread> threads;
+        try
+        {
+            for (unsigned i = 1; i < threadCount; i++)
+                threads.emplace_back(worker, i);
+        }
+        catch (...)
+        {
+            failed = true;
+            for (auto& thread : threads)
+                thread.join();
+
+            throw;
+        }
+
+        // The current thread is a worker as well
+        worker(0);
+        for (auto& thread : threads)
+            thread.join();
+
+        if (error != nullptr)
+            std::rethrow_exception(error);
+    }
+}
+
+#endif // PARALLEL_UTILS_H
@@ -650,6 +650,30 @@ int utls::TypeNameToIndex(const char* type, const char** types, unsigned len, in
     return unknownValue;
 }
 
+void utls::UnescapeNameTo(string& dst, const string_view& view)
+{
+    size_t incount = 0;
+    const char* curr = view.data();
+    while (incount++ < view.length())
+    {
+        if (*curr == '#' && incount + 1 < view.length())
+        {
+            unsigned char hi = static_cast<unsigned char>(*(++curr));
+            incount++;
+            unsigned char low = static_cast<unsigned char>(*(++curr));
+            incount++;
+            hi -= (hi < 'A' ? '0' : 'A' - 10);
+            low -= (low < 'A' ? '0' : 'A' - 10);
+            unsigned char codepoint = (hi << 4) | (low & 0x0F);
+            dst.push_back((char)codepoint);
+        }
+        else
+            dst.push_back(*curr);
+
+        curr++;
+    }
+}
+
 bool utls::TryGetHexValue(char ch, unsigned char& value)
 {
     switch (ch)
@@ -999,6 +1023,13 @@ string utls::Trim(const string_view& str, char ch)
     return ret;
 }
 
+size_t utls::HashData(const bufferview& data)
+{
+    // NOTE: The standard library string hash is a fast
+    // MurmurHash class hash in common implementations
+    return std::hash<string_view>()(string_view(data.data(), data.size()));
+}
+
 void utls::ByteSwap(u16string& str)
 {
     for (unsigned i = 0; i < str.length(); i++)
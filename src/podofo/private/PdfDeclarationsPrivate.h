@@ -272,6 +272,9 @@ namespace utls
 
     bool TryGetHexValue(char ch, unsigned char& value);
 
+    // Append the unescaped PDF name to the supplied string
+    void UnescapeNameTo(std::string& dst, const std::string_view& view);
+
     // Write the char to the supplied buffer as hexadecimal code
     void WriteCharHexTo(char buf[2], char ch);
 
@@ -330,6 +333,11 @@ namespace utls
 
     std::string Trim(const std::string_view& str, char ch);
 
+    /** Fast non-cryptographic hash of the data, suitable
+     * to detect duplicated buffers
+     */
+    size_t HashData(const PoDoFo::bufferview& data);
+
     // https://stackoverflow.com/a/38140932/213871
     inline void hash_combine(std::size_t& seed)
     {
@@ -68,12 +68,14 @@ void PdfParserObject::ParseStream()
 
 void PdfParserObject::delayedLoad()
 {
+    // NOTE: Read the source device only with positional reads,
+    // without altering its shared position
+    InputStreamDeviceView device(*m_device, m_Offset);
     PdfTokenizer tokenizer;
-    m_device->Seek(m_Offset);
     if (!m_IsTrailer)
-        checkReference(tokenizer);
+        checkReference(device, tokenizer);
 
-    Parse(tokenizer);
+    Parse(device, tokenizer);
 }
 
 void PdfParserObject::delayedLoadStream()
@@ -105,16 +107,15 @@ bool PdfParserObject::removeStream()
     return hasStream;
 }
 
-PdfReference PdfParserObject::ReadReference(PdfTokenizer& tokenizer)
+PdfReference PdfParserObject::ReadReference(InputStreamDevice& device, PdfTokenizer& tokenizer)
 {
-    m_device->Seek(m_Offset);
-    return readReference(tokenizer);
+    return readReference(device, tokenizer);
 }
 
 // Only called via the demand loading mechanism
 // Be very careful to avoid recursive demand loads via PdfVariant
 // or PdfObject method calls here.
-void PdfParserObject::Parse(PdfTokenizer& tokenizer)
+void PdfParserObject::Parse(InputStreamDevice& device, PdfTokenizer& tokenizer)
 {
     unique_ptr<PdfStatefulEncrypt> encrypt;
     if (m_Encrypt != nullptr)
@@ -127,18 +128,18 @@ void PdfParserObject::Parse(PdfTokenizer& tokenizer)
 
     PdfTokenType tokenType;
     string_view token;
-    bool gotToken = tokenizer.TryReadNextToken(*m_device, token, tokenType);
+    bool gotToken = tokenizer.TryReadNextToken(device, token, tokenType);
     if (!gotToken)
         PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnexpectedEOF, "Expected variant");
 
     // Check if we have an empty object or data
     if (token != "endobj")
     {
-        tokenizer.ReadNextVariant(*m_device, token, tokenType, m_Variant, encrypt.get());
+        tokenizer.ReadNextVariant(device, token, tokenType, m_Variant, encrypt.get());
 
         if (!m_IsTrailer)
         {
-            gotToken = tokenizer.TryReadNextToken(*m_device, token);
+            gotToken = tokenizer.TryReadNextToken(device, token);
             if (!gotToken)
                 PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnexpectedEOF, "Expected 'endobj' or (if dict) 'stream', got EOF");
 
@@ -150,7 +151,7 @@ void PdfParserObject::Parse(PdfTokenizer& tokenizer)
             else if (m_Variant.IsDictionary() && token == "stream")
             {
                 m_HasStream = true;
-                m_StreamOffset = m_device->GetPosition(); // NOTE: whitespace after "stream" handle in stream parser!
+                m_StreamOffset = device.GetPosition(); // NOTE: whitespace after "stream" handle in stream parser!
             }
             else
             {
@@ -179,12 +180,12 @@ void PdfParserObject::parseStream()
     if (!lengthObj.TryGetNumber(size))
         PODOFO_RAISE_ERROR(PdfErrorCode::InvalidStreamLength);
 
-    m_device->Seek(m_StreamOffset);
+    InputStreamDeviceView device(*m_device, m_StreamOffset);
 
     size_t streamOffset;
     while (true)
     {
-        if (!m_device->Peek(ch))
+        if (!device.Peek(ch))
             PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnexpectedEOF, "Unexpected EOF when reading stream");
 
         switch (ch)
@@ -194,7 +195,7 @@ void PdfParserObject::parseStream()
             // but certain PDFs have additional whitespaces
             case ' ':
             case '\t':
-                (void)m_device->ReadChar();
+                (void)device.ReadChar();
                 break;
             // From PDF 32000:2008 7.3.8.1 General
             // "The keyword stream that follows the stream dictionary shall be
@@ -202,30 +203,30 @@ void PdfParserObject::parseStream()
             // RETURN and a LINE FEED or just a LINE FEED, and not by a CARRIAGE
             // RETURN alone"
             case '\r':
-                streamOffset = m_device->GetPosition();
-                (void)m_device->ReadChar();
-                if (!m_device->Peek(ch))
+                streamOffset = device.GetPosition();
+                (void)device.ReadChar();
+                if (!device.Peek(ch))
                     PODOFO_RAISE_ERROR_INFO(PdfErrorCode::UnexpectedEOF, "Unexpected EOF when reading stream");
 
                 if (ch == '\n')
                 {
-                    (void)m_device->ReadChar();
-                    streamOffset = m_device->GetPosition();
+                    (void)device.ReadChar();
+                    streamOffset = device.GetPosition();
                 }
                 goto ReadStream;
             case '\n':
-                (void)m_device->ReadChar();
-                streamOffset = m_device->GetPosition();
+                (void)device.ReadChar();
+                streamOffset = device.GetPosition();
                 goto ReadStream;
             // Assume malformed PDF with no whitespaces after the stream keyword
             default:
-                streamOffset = m_device->GetPosition();
+                streamOffset = device.GetPosition();
                 goto ReadStream;
         }
     }
 
 ReadStream:
-    m_device->Seek(streamOffset);	// reset it before reading!
+    device.Seek(streamOffset);	// reset it before reading!
 
     // Set stream raw data without marking the object dirty
     // NOTE: /Metadata objects may be unencrypted even if the
@@ -235,21 +236,20 @@ ReadStream:
         || !this->m_Variant.GetDictionaryUnsafe().TryFindKeyAs(PdfNames::Type, type)
         || *type != "Metadata"))
     {
-        auto input = m_Encrypt->GetEncrypt().CreateEncryptionInputStream(*m_device, static_cast<size_t>(size), m_Encrypt->GetContext(), GetIndirectReference());
+        auto input = m_Encrypt->GetEncrypt().CreateEncryptionInputStream(device, static_cast<size_t>(size), m_Encrypt->GetContext(), GetIndirectReference());
+        // NOTE: The encrypt session is kept, since the stream
+        // may be released and loaded again, see FreeObjectMemory()
         getOrCreateStream().InitData(*input, static_cast<ssize_t>(size), PdfFilterFactory::CreateFilterList(*this));
-        // Release the encrypt object after loading the stream.
-        // It's not needed for serialization here
-        m_Encrypt = nullptr;
     }
     else
     {
-        getOrCreateStream().InitData(*m_device, static_cast<ssize_t>(size), PdfFilterFactory::CreateFilterList(*this));
+        getOrCreateStream().InitData(device, static_cast<ssize_t>(size), PdfFilterFactory::CreateFilterList(*this));
     }
 }
 
-void PdfParserObject::checkReference(PdfTokenizer& tokenizer)
+void PdfParserObject::checkReference(InputStreamDevice& device, PdfTokenizer& tokenizer)
 {
-    auto reference = readReference(tokenizer);
+    auto reference = readReference(device, tokenizer);
     if (GetIndirectReference() != reference)
     {
         PoDoFo::LogMessage(PdfLogSeverity::Warning,
@@ -258,13 +258,13 @@ void PdfParserObject::checkReference(PdfTokenizer& tokenizer)
     }
 }
 
-PdfReference PdfParserObject::readReference(PdfTokenizer& tokenizer)
+PdfReference PdfParserObject::readReference(InputStreamDevice& device, PdfTokenizer& tokenizer)
 {
     PdfReference reference;
     try
     {
-        int64_t obj = tokenizer.ReadNextNumber(*m_device);
-        int64_t gen = tokenizer.ReadNextNumber(*m_device);
+        int64_t obj = tokenizer.ReadNextNumber(device);
+        int64_t gen = tokenizer.ReadNextNumber(device);
         reference = PdfReference(static_cast<uint32_t>(obj), static_cast<uint16_t>(gen));
 
     }
@@ -275,7 +275,7 @@ PdfReference PdfParserObject::readReference(PdfTokenizer& tokenizer)
     }
 
     string_view token;
-    if (!tokenizer.TryReadNextToken(*m_device, token) || token != "obj")
+    if (!tokenizer.TryReadNextToken(device, token) || token != "obj")
     {
         PODOFO_RAISE_ERROR_INFO(PdfErrorCode::NoObject, "Error while reading object {} {} R: Next token is not 'obj'",
             reference.ObjectNumber(), reference.GenerationNumber());
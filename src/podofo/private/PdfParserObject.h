@@ -83,8 +83,13 @@ public:
     inline void SetIsTrailer(bool isTrailer) { m_IsTrailer = isTrailer; }
 
 protected:
-    PdfReference ReadReference(PdfTokenizer& tokenizer);
-    void Parse(PdfTokenizer& tokenizer);
+    PdfReference ReadReference(InputStreamDevice& device, PdfTokenizer& tokenizer);
+    void Parse(InputStreamDevice& device, PdfTokenizer& tokenizer);
+
+    /** Get the source device of the object. Read it only
+     * with positional reads (eg. by means of InputStreamDeviceView)
+     */
+    inline InputStreamDevice& GetDevice() { return *m_device; }
 
     /** Returns if this object has a stream object appended.
      *  which has to be parsed.
@@ -108,9 +113,9 @@ private:
      */
     void parseStream();
 
-    PdfReference readReference(PdfTokenizer& tokenizer);
+    PdfReference readReference(InputStreamDevice& device, PdfTokenizer& tokenizer);
 
-    void checkReference(PdfTokenizer& tokenizer);
+    void checkReference(InputStreamDevice& device, PdfTokenizer& tokenizer);
 
 private:
     std::shared_ptr<PdfEncryptSession> m_Encrypt;
@@ -33,10 +33,11 @@ void PdfXRefStreamParserObject::delayedLoad()
 {
     // NOTE: Ignore the encryption in the XREF as the XREF stream must no be encrypted (see PDF Reference 3.4.7)
 
+    InputStreamDeviceView device(GetDevice(), (size_t)GetOffset());
     PdfTokenizer tokenizer;
-    auto reference = ReadReference(tokenizer);
+    auto reference = ReadReference(device, tokenizer);
     SetIndirectReference(reference);
-    PdfParserObject::Parse(tokenizer);
+    PdfParserObject::Parse(device, tokenizer);
 
     // Do some very basic error checking
     auto& dict = m_Variant.GetDictionary();
@@ -0,0 +1,227 @@
+/**
+ * SPDX-FileCopyrightText: (C) 2022 Francesco Pretto <ceztko@gmail.com>
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ * SPDX-License-Identifier: MPL-2.0
+ */
+
+#include <PdfTest.h>
+
+using namespace std;
+using namespace PoDoFo;
+
+TEST_CASE("TestOperatorLookup")
+{
+    PdfOperator op;
+    int operandCount;
+    string_view opstr;
+    for (unsigned i = (unsigned)PdfOperator::w; i <= (unsigned)PdfOperator::EX; i++)
+    {
+        REQUIRE(TryGetPdfOperatorName((PdfOperator)i, opstr));
+        REQUIRE(TryGetPdfOperator(opstr, op, operandCount));
+        REQUIRE(op == (PdfOperator)i);
+        REQUIRE(operandCount == GetOperandCount(op));
+    }
+
+    REQUIRE(GetPdfOperator("SCN") == PdfOperator::SCN);
+    REQUIRE(GetPdfOperator("\"") == PdfOperator::DoubleQuote);
+    REQUIRE(GetOperandCount(PdfOperator::cm) == 6);
+    REQUIRE(GetOperandCount(PdfOperator::scn) == -1);
+    REQUIRE(!TryGetPdfOperator("", op));
+    REQUIRE(!TryGetPdfOperator("SCNX", op));
+    REQUIRE(!TryGetPdfOperator("Tx", op));
+    REQUIRE(!TryGetPdfOperator("BMX", op));
+    REQUIRE(op == PdfOperator::Unknown);
+    REQUIRE(!TryGetPdfOperatorName(PdfOperator::Unknown, opstr));
+}
+
+TEST_CASE("TestContentStreamReader")
+{
+    auto device = std::make_shared<SpanStreamDevice>("q 1 0 0 1 10 20 cm /F1 12 Tf (Hello) Tj 0 0 m 1 2 3 foo Q");
+    PdfContentStreamReader reader(device);
+    PdfContent content;
+
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Operator == PdfOperator::q);
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Operator == PdfOperator::cm);
+    REQUIRE(content.Stack.GetSize() == 6);
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Operator == PdfOperator::Tf);
+    REQUIRE(content.Stack[1].GetName() == "F1");
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Operator == PdfOperator::Tj);
+    REQUIRE(content.Stack[0].GetString().GetString() == "Hello");
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Operator == PdfOperator::m);
+    REQUIRE(content.Warnings == PdfContentWarnings::None);
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Type == PdfContentType::UnexpectedKeyword);
+    REQUIRE(content.Keyword == "foo");
+    REQUIRE(content.Stack.GetSize() == 3);
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Operator == PdfOperator::Q);
+    REQUIRE(content.Stack.GetSize() == 0);
+    REQUIRE(!reader.TryReadNext(content));
+}
+
+TEST_CASE("TestContentStreamReaderViews")
+{
+    auto device = std::make_shared<SpanStreamDevice>(
+        "q 1 0 0 1 10 20.5 cm /F#231 12 Tf (Hel\\154o) Tj <48 69> Tj [(A) -250 [/N]] TJ "
+        "/P << /MCID 0 >> BDC 1 2 3 foo BI /W 1 /H 1 ID x EI Q");
+    PdfContentStreamReader reader(device);
+    PdfContentView content;
+
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Operator == PdfOperator::q);
+    REQUIRE(content.Operands.size() == 0);
+
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Operator == PdfOperator::cm);
+    REQUIRE(content.Operands.size() == 6);
+    REQUIRE(content.Operands[0].Type == PdfOperandType::Number);
+    REQUIRE(content.Operands[0].Number == 1);
+    REQUIRE(content.Operands[5].Type == PdfOperandType::Real);
+    REQUIRE(content.Operands[5].GetReal() == 20.5);
+
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Operator == PdfOperator::Tf);
+    REQUIRE(content.Operands[0].Type == PdfOperandType::Name);
+    REQUIRE(content.Operands[0].Data == "F#1");
+    REQUIRE(content.Operands[1].GetReal() == 12);
+
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Operator == PdfOperator::Tj);
+    REQUIRE(content.Operands[0].Type == PdfOperandType::String);
+    REQUIRE(content.Operands[0].Data == "Hello");
+
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Operator == PdfOperator::Tj);
+    REQUIRE(content.Operands[0].Type == PdfOperandType::HexString);
+    REQUIRE(content.Operands[0].Data == "Hi");
+
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Operator == PdfOperator::TJ);
+    REQUIRE(content.Operands.size() == 1);
+    auto& array = content.Operands[0];
+    REQUIRE(array.Type == PdfOperandType::Array);
+    REQUIRE(array.ItemCount == 3);
+    REQUIRE(array.Items[0].Data == "A");
+    REQUIRE(array.Items[1].Number == -250);
+    REQUIRE(array.Items[2].Type == PdfOperandType::Array);
+    REQUIRE(array.Items[2].ItemCount == 1);
+    REQUIRE(array.Items[2].Items[0].Data == "N");
+
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Operator == PdfOperator::BDC);
+    REQUIRE(content.Operands[1].Type == PdfOperandType::Dictionary);
+    REQUIRE(content.Operands[1].Variant->GetDictionary().MustFindKey("MCID").GetNumber() == 0);
+
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Type == PdfContentType::UnexpectedKeyword);
+    REQUIRE(content.Keyword == "foo");
+    REQUIRE(content.Operands.size() == 3);
+
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Type == PdfContentType::ImageDictionary);
+    REQUIRE(content.InlineImageDictionary.MustFindKey("W").GetNumber() == 1);
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Type == PdfContentType::ImageData);
+    REQUIRE(content.InlineImageData.size() == 2);
+
+    REQUIRE(reader.TryReadNext(content));
+    REQUIRE(content.Operator == PdfOperator::Q);
+    REQUIRE(content.Operands.size() == 0);
+    REQUIRE(!reader.TryReadNext(content));
+}
+
+TEST_CASE("TestContentStreamReaderConcatenated")
+{
+    PdfMemDocument doc;
+    auto& page = doc.GetPages().CreatePage(PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+    auto& contents = page.GetOrCreateContents();
+    contents.CreateStreamForAppending(PdfStreamAppendFlags::NoSaveRestorePrior).SetData("q 1 0 0 1");
+    contents.CreateStreamForAppending(PdfStreamAppendFlags::NoSaveRestorePrior).SetData("10 20 cm");
+    for (unsigned i = 0; i < 50; i++)
+        contents.CreateStreamForAppending(PdfStreamAppendFlags::NoSaveRestorePrior).SetData("0 0 m");
+    contents.CreateStreamForAppending(PdfStreamAppendFlags::NoSaveRestorePrior).SetData("Q");
+
+    auto readOperators = [&page](PdfContentReaderFlags flags) {
+        PdfContentReaderArgs args;
+        args.Flags = flags;
+        PdfContentStreamReader reader(page, args);
+        PdfContent content;
+        vector<PdfOperator> ret;
+        while (reader.TryReadNext(content))
+        {
+            REQUIRE(content.Type == PdfContentType::Operator);
+            REQUIRE(content.Warnings == PdfContentWarnings::None);
+            ret.push_back(content.Operator);
+        }
+        return ret;
+    };
+
+    auto operators = readOperators(PdfContentReaderFlags::None);
+    REQUIRE(operators.size() == 53);
+    REQUIRE(operators[0] == PdfOperator::q);
+    REQUIRE(operators[1] == PdfOperator::cm);
+    REQUIRE(operators[2] == PdfOperator::m);
+    REQUIRE(operators[52] == PdfOperator::Q);
+    REQUIRE(readOperators(PdfContentReaderFlags::ConcatenateContents) == operators);
+    REQUIRE(readOperators(PdfContentReaderFlags::ParallelDecodeContents) == operators);
+}
+
+TEST_CASE("TestContentStreamCache")
+{
+    PdfMemDocument doc;
+    auto form = doc.CreateXObjectForm(Rect(0, 0, 100, 100));
+    form->GetObject().GetOrCreateStream().SetData("q 1 0 0 1 5 5 cm BI /W 1 /H 1 ID x EI foo Q 7");
+
+    for (unsigned i = 0; i < 3; i++)
+    {
+        auto& page = doc.GetPages().CreatePage(PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+        page.GetOrCreateResources().AddResource(PdfResourceType::XObject, "X1", form->GetObject());
+        page.GetOrCreateContents().CreateStreamForAppending(PdfStreamAppendFlags::NoSaveRestorePrior)
+            .SetData("q /X1 Do Q");
+    }
+
+    auto readContents = [&doc](PdfContentStreamCache* cache) {
+        vector<pair<PdfContentType, PdfOperator>> ret;
+        PdfContentReaderArgs args;
+        args.Cache = cache;
+        for (unsigned i = 0; i < doc.GetPages().GetCount(); i++)
+        {
+            PdfContentStreamReader reader(doc.GetPages().GetPageAt(i), args);
+            PdfContent content;
+            while (reader.TryReadNext(content))
+            {
+                ret.push_back({ content.Type, content.Operator });
+                if (content.Type == PdfContentType::EndXObjectForm)
+                {
+                    REQUIRE(content.Warnings == PdfContentWarnings::SpuriousStackContent);
+                    REQUIRE(content.Stack.GetSize() == 1);
+                }
+                else if (content.Operator == PdfOperator::cm)
+                {
+                    REQUIRE(content.Stack[0].GetReal() == 5);
+                }
+            }
+        }
+
+        return ret;
+    };
+
+    auto expected = readContents(nullptr);
+    REQUIRE(expected.size() == 30);
+    REQUIRE(expected[1].first == PdfContentType::DoXObject);
+
+    PdfContentStreamCache cache;
+    REQUIRE(readContents(&cache) == expected);
+    REQUIRE(cache.GetCount() == 1);
+    REQUIRE(cache.GetSize() != 0);
+
+    // A cache too small will just not store the form
+    PdfContentStreamCache smallCache(16);
+    REQUIRE(readContents(&smallCache) == expected);
+    REQUIRE(smallCache.GetCount() == 0);
+}
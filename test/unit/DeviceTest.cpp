@@ -49,3 +49,64 @@ TEST_CASE("TestStreamedDocument")
     painter.DrawText("Hello World!", 56.69, page.GetRect().Height - 56.69);
     painter.FinishDrawing();
 }
+
+TEST_CASE("TestReadAt")
+{
+    string_view testString = "Hello World Buffer!";
+    char buffer[32];
+
+    SpanStreamDevice span(testString);
+    REQUIRE(span.ReadChar() == 'H');
+    REQUIRE(span.ReadAt(6, buffer, 5) == 5);
+    REQUIRE(string_view(buffer, 5) == "World");
+    REQUIRE(span.ReadAt(12, buffer, sizeof(buffer)) == 7);
+    REQUIRE(string_view(buffer, 7) == "Buffer!");
+    REQUIRE(span.ReadAt(100, buffer, sizeof(buffer)) == 0);
+    // Positional reads don't alter the device position
+    REQUIRE(span.GetPosition() == 1);
+
+    string str(testString);
+    StringStreamDevice container(str);
+    REQUIRE(container.ReadAt(0, buffer, 5) == 5);
+    REQUIRE(string_view(buffer, 5) == "Hello");
+    REQUIRE(container.GetPosition() == testString.size());
+
+    auto testPath = TestUtils::GetTestOutputFilePath("TestReadAt.bin");
+    utls::WriteTo(testPath, testString);
+    FileStreamDevice file(testPath);
+    REQUIRE(file.ReadChar() == 'H');
+    REQUIRE(file.ReadAt(6, buffer, sizeof(buffer)) == 13);
+    REQUIRE(string_view(buffer, 13) == "World Buffer!");
+    REQUIRE(file.GetPosition() == 1);
+    REQUIRE(file.ReadChar() == 'e');
+}
+
+TEST_CASE("TestInputStreamDeviceView")
+{
+    string_view testString = "Hello World Buffer!";
+    SpanStreamDevice source(testString);
+    source.Seek(3);
+
+    InputStreamDeviceView view1(source, 6);
+    InputStreamDeviceView view2(source, 12);
+    char ch;
+    REQUIRE(view1.Peek(ch));
+    REQUIRE(ch == 'W');
+    REQUIRE(view2.ReadChar() == 'B');
+    REQUIRE(view1.ReadChar() == 'W');
+    REQUIRE(view1.GetPosition() == 7);
+
+    char buffer[32];
+    bool eof;
+    REQUIRE(view2.Read(buffer, sizeof(buffer), eof) == 6);
+    REQUIRE(eof);
+    REQUIRE(string_view(buffer, 6) == "uffer!");
+    REQUIRE(view2.Eof());
+
+    view2.Seek(0);
+    REQUIRE(!view2.Eof());
+    REQUIRE(view2.ReadChar() == 'H');
+
+    // The source device position is never touched
+    REQUIRE(source.GetPosition() == 3);
+}
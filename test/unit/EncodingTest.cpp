@@ -274,6 +274,212 @@ TEST_CASE("testGetCharCode")
     outofRangeHelper(differenceEncoding);
 }
 
+TEST_CASE("TestGlyphListLookup")
+{
+    REQUIRE(PdfDifferenceEncoding::NameToCodePoint("A") == U'A');
+    REQUIRE(PdfDifferenceEncoding::NameToCodePoint("space") == U' ');
+    REQUIRE(PdfDifferenceEncoding::NameToCodePoint("zcaron") == U'\u017E');
+    REQUIRE(PdfDifferenceEncoding::NameToCodePoint("uni20AC") == U'\u20AC');
+    REQUIRE(PdfDifferenceEncoding::NameToCodePoint("nonexistingglyph") == U'\0');
+    REQUIRE(PdfDifferenceEncoding::CodePointToName(U' ') == "space");
+    REQUIRE(PdfDifferenceEncoding::CodePointToName(U'A') == "A");
+    REQUIRE(PdfDifferenceEncoding::CodePointToName(U'\u017E') == "zcaron");
+    REQUIRE(PdfDifferenceEncoding::CodePointToName(U'\0') == ".notdef");
+
+    // Encodings with the same differences share the reverse map
+    PdfDifferenceList difference;
+    difference.AddDifference((unsigned char)'A', "B");
+    difference.AddDifference((unsigned char)'B', "A");
+    difference.AddDifference(0xF0, "Euro");
+    PdfDifferenceEncoding encoding1(PdfEncodingMapFactory::WinAnsiEncodingInstance(), difference);
+    PdfDifferenceEncoding encoding2(PdfEncodingMapFactory::WinAnsiEncodingInstance(), difference);
+    for (auto encoding : { &encoding1, &encoding2 })
+    {
+        PdfCharCode code;
+        REQUIRE(encoding->TryGetCharCode(U'A', code));
+        REQUIRE(code == PdfCharCode((unsigned char)'B'));
+        REQUIRE(encoding->TryGetCharCode(U'B', code));
+        REQUIRE(code == PdfCharCode((unsigned char)'A'));
+        REQUIRE(encoding->TryGetCharCode(U'C', code));
+        REQUIRE(code == PdfCharCode((unsigned char)'C'));
+        // The Euro is mapped by both 0x80 in the base encoding and the
+        // difference: the highest code is used
+        REQUIRE(encoding->TryGetCharCode(U'\u20AC', code));
+        REQUIRE(code == PdfCharCode(0xF0));
+        REQUIRE(!encoding->TryGetCharCode(U'\u017F', code));
+    }
+
+    // A different base encoding doesn't use the same map
+    PdfDifferenceEncoding encoding3(PdfEncodingMapFactory::MacRomanEncodingInstance(), difference);
+    PdfCharCode code;
+    REQUIRE(encoding3.TryGetCharCode(U'\u00C4', code));
+    REQUIRE(code == PdfCharCode(0x80));
+}
+
+TEST_CASE("TestCMapCache")
+{
+    // Restore the process wide cache size also if the test fails
+    struct CacheSizeGuard
+    {
+        ~CacheSizeGuard()
+        {
+            PdfEncodingMapFactory::SetCMapCacheSize(Size);
+        }
+        unsigned Size = PdfEncodingMapFactory::GetCMapCacheSize();
+    } cacheSizeGuard;
+
+    string_view toUnicode =
+        "2 beginbfrange\n"
+        "<0001> <0003> <00660066>\n"
+        "<0010> <0012> <0041>\n"
+        "endbfrange\n"
+        "1 begincidrange\n"
+        "<0020> <0022> 100\n"
+        "endcidrange\n";
+
+    auto parse = [&](PdfIndirectObjectList& objects)
+    {
+        auto& toUnicodeObj = objects.CreateDictionaryObject();
+        toUnicodeObj.GetOrCreateStream().SetData(toUnicode);
+        return PdfEncodingMapFactory::ParseCMapEncoding(toUnicodeObj);
+    };
+
+    PdfMemDocument doc;
+    auto& objects = doc.GetObjects();
+    auto map1 = parse(objects);
+    auto map2 = parse(objects);
+
+    // The ranges increment the last code point of the destination
+    auto& charMap = dynamic_cast<const PdfCMapEncoding&>(*map1).GetCharMap();
+    vector<codepoint> codePoints;
+    REQUIRE(charMap.TryGetCodePoints({ 0x0003, 2 }, codePoints));
+    REQUIRE(codePoints == vector<codepoint>{ U'f', U'h' });
+    REQUIRE(charMap.TryGetCodePoints({ 0x0012, 2 }, codePoints));
+    REQUIRE(codePoints == vector<codepoint>{ U'C' });
+    REQUIRE(charMap.TryGetCodePoints({ 0x0021, 2 }, codePoints));
+    REQUIRE(codePoints == vector<codepoint>{ 101 });
+    REQUIRE(charMap.GetSize() == 9);
+
+    // The identical CMap is parsed once and the map is shared
+    REQUIRE(&dynamic_cast<const PdfCMapEncoding&>(*map2).GetCharMap() == &charMap);
+
+    // A different CMap of the same size is not shared
+    {
+        auto& otherObj = objects.CreateDictionaryObject();
+        string otherToUnicode(toUnicode);
+        otherToUnicode[otherToUnicode.find("<0041>") + 4] = '2';
+        otherObj.GetOrCreateStream().SetData(otherToUnicode);
+        auto otherMap = PdfEncodingMapFactory::ParseCMapEncoding(otherObj);
+        auto& otherCharMap = dynamic_cast<const PdfCMapEncoding&>(*otherMap).GetCharMap();
+        REQUIRE(&otherCharMap != &charMap);
+        REQUIRE(otherCharMap.TryGetCodePoints({ 0x0010, 2 }, codePoints));
+        REQUIRE(codePoints == vector<codepoint>{ U'B' });
+    }
+
+    charbuff cache1;
+    {
+        BufferStreamDevice device(cache1);
+        PdfEncodingMapFactory::SaveCMapCache(device);
+    }
+    REQUIRE(cache1.size() != 0);
+
+    // Round trip the serialized cache
+    PdfEncodingMapFactory::ClearCMapCache();
+    {
+        SpanStreamDevice device(cache1);
+        PdfEncodingMapFactory::LoadCMapCache(device);
+    }
+
+    charbuff cache2;
+    {
+        BufferStreamDevice device(cache2);
+        PdfEncodingMapFactory::SaveCMapCache(device);
+    }
+    REQUIRE(cache1 == cache2);
+
+    auto map3 = parse(objects);
+    auto& charMap3 = dynamic_cast<const PdfCMapEncoding&>(*map3).GetCharMap();
+    REQUIRE(charMap3.TryGetCodePoints({ 0x0002, 2 }, codePoints));
+    REQUIRE(codePoints == vector<codepoint>{ U'f', U'g' });
+    PdfCharCode code;
+    REQUIRE(charMap3.TryGetCharCode(U'B', code));
+    REQUIRE(code == PdfCharCode(0x0011, 2));
+
+    // Invalid cache data
+    {
+        SpanStreamDevice device("INVALID!"sv);
+        REQUIRE_THROWS_AS(PdfEncodingMapFactory::LoadCMapCache(device), PdfError);
+    }
+
+    // With the cache disabled the maps are not shared
+    PdfEncodingMapFactory::SetCMapCacheSize(0);
+    auto map4 = parse(objects);
+    auto map5 = parse(objects);
+    REQUIRE(&dynamic_cast<const PdfCMapEncoding&>(*map4).GetCharMap()
+        != &dynamic_cast<const PdfCMapEncoding&>(*map5).GetCharMap());
+}
+
+TEST_CASE("TestCharCodeMapLookup")
+{
+    PdfCharCodeMap map;
+    map.PushMapping({ 0x20, 1 }, U' ');
+    map.PushMapping({ 0x21, 1 }, U'f');
+    map.PushMapping({ 0x22, 1 }, U'i');
+    map.PushMapping({ 0x23, 1 }, U'x');
+    map.PushMapping({ 0x24, 1 }, U'f');
+    map.PushMapping({ 0x30, 1 }, vector<codepoint>{ U'f', U'f' });
+    map.PushMapping({ 0x31, 1 }, vector<codepoint>{ U'f', U'f', U'i' });
+    map.PushMapping({ 0x40, 1 }, U'\U0001F600');
+    map.PushMapping({ 0x41, 1 }, (codepoint)0x7FFFFFFF);
+
+    vector<codepoint> codePoints;
+    REQUIRE(map.TryGetCodePoints({ 0x31, 1 }, codePoints));
+    REQUIRE(codePoints == vector<codepoint>{ U'f', U'f', U'i' });
+    REQUIRE(map.TryGetCodePoints({ 0x40, 1 }, codePoints));
+    REQUIRE(codePoints == vector<codepoint>{ U'\U0001F600' });
+    REQUIRE(!map.TryGetCodePoints({ 0x25, 1 }, codePoints));
+    REQUIRE(!map.TryGetCodePoints({ 0x1F, 1 }, codePoints));
+    REQUIRE(!map.TryGetCodePoints({ 0x42, 1 }, codePoints));
+
+    // The lowest code unit is used for duplicated code points
+    PdfCharCode code;
+    REQUIRE(map.TryGetCharCode(U'f', code));
+    REQUIRE(code == PdfCharCode(0x21, 1));
+    REQUIRE(map.TryGetCharCode(U'\U0001F600', code));
+    REQUIRE(code == PdfCharCode(0x40, 1));
+    REQUIRE(map.TryGetCharCode((codepoint)0x7FFFFFFF, code));
+    REQUIRE(code == PdfCharCode(0x41, 1));
+    REQUIRE(!map.TryGetCharCode(U'g', code));
+    REQUIRE(map.TryGetCharCode(vector<codepoint>{ U'f', U'f' }, code));
+    REQUIRE(code == PdfCharCode(0x30, 1));
+    REQUIRE(!map.TryGetCharCode(vector<codepoint>{ U'f', U'i' }, code));
+
+    // The longest ligature is matched
+    string_view str = "ffix ffx fi";
+    vector<unsigned> codes;
+    auto it = str.begin();
+    while (it != str.end())
+    {
+        REQUIRE(map.TryGetNextCharCode(it, str.end(), code));
+        codes.push_back(code.Code);
+    }
+    REQUIRE(codes == vector<unsigned>{ 0x31, 0x23, 0x20, 0x30, 0x23, 0x20, 0x21, 0x22 });
+
+    // Modifying the map updates the lookups
+    map.PushMapping({ 0x50, 1 }, U'g');
+    REQUIRE(map.TryGetCharCode(U'g', code));
+    REQUIRE(code == PdfCharCode(0x50, 1));
+
+    // Code units wider than 2 bytes
+    PdfCharCodeMap wideMap;
+    wideMap.PushMapping({ 0x10, 1 }, U'a');
+    wideMap.PushMapping({ 0x10203, 3 }, U'b');
+    REQUIRE(wideMap.TryGetCodePoints({ 0x10203, 3 }, codePoints));
+    REQUIRE(codePoints == vector<codepoint>{ U'b' });
+    REQUIRE(wideMap.TryGetCharCode(U'b', code));
+    REQUIRE(code == PdfCharCode(0x10203, 3));
+}
+
 void PdfEncodingTest::TestToUnicodeParse()
 {
     string_view toUnicode =
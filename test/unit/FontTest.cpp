@@ -8,7 +8,12 @@
 
 #include <PdfTest.h>
 
+#include <set>
+#include <thread>
+
 #include <podofo/private/FreetypePrivate.h>
+#include FT_TRUETYPE_TABLES_H
+#include FT_TRUETYPE_TAGS_H
 
 using namespace std;
 using namespace PoDoFo;
@@ -20,6 +25,9 @@ using namespace PoDoFo;
 static bool getFontInfo(FcPattern* font, string& fontFamily, string& fontPath,
     PdfFontStyle& style);
 static void testSingleFont(FcPattern* font);
+static void createFontDocument(charbuff& buffer, const string_view& text,
+    const function<const PdfFont&(PdfDocument& doc)>& createFont);
+static PdfName getFontFile(PdfMemDocument& doc, const string_view& fontFileKey, charbuff& fontFile);
 
 TEST_CASE("TestFonts")
 {
@@ -97,6 +105,365 @@ TEST_CASE("TestCreateFontExtract")
     REQUIRE(entries[0].Y == 600);
 }
 
+TEST_CASE("TestGlyphWidths")
+{
+    auto fontPath = TestUtils::GetTestInputFilePath("Fonts", "LiberationSans-Regular.ttf");
+    auto metrics = PdfFontMetrics::Create(fontPath);
+    auto face = FT::CreateFaceFromBuffer(metrics->GetOrLoadFontFileData());
+    unsigned glyphCount = metrics->GetGlyphCount();
+    REQUIRE(glyphCount != 0);
+
+    // Compare the cached widths to the ones loaded from the face
+    vector<double> widths(glyphCount);
+    for (unsigned i = 0; i < glyphCount; i++)
+    {
+        REQUIRE(FT_Load_Glyph(face, i, FT_LOAD_NO_SCALE | FT_LOAD_NO_BITMAP) == 0);
+        widths[i] = face->glyph->metrics.horiAdvance / (double)face->units_per_EM;
+        REQUIRE(metrics->GetGlyphWidth(i) == widths[i]);
+        REQUIRE(metrics->GetGlyphWidth(i) == widths[i]);
+    }
+
+    double width;
+    REQUIRE(!metrics->TryGetGlyphWidth(glyphCount, width));
+    FT_Done_Face(face);
+
+    // Query the widths of a fresh metrics concurrently
+    metrics = PdfFontMetrics::Create(fontPath);
+    vector<vector<double>> threadWidths(4, vector<double>(glyphCount));
+    vector<thread> threads;
+    for (unsigned i = 0; i < threadWidths.size(); i++)
+    {
+        threads.emplace_back([&metrics, &threadWidths, glyphCount, i]() {
+            for (unsigned j = 0; j < glyphCount; j++)
+                threadWidths[i][j] = metrics->GetGlyphWidth(j);
+        });
+    }
+
+    for (auto& thread : threads)
+        thread.join();
+
+    for (auto& currWidths : threadWidths)
+        REQUIRE(currWidths == widths);
+
+    PdfMemDocument doc;
+    auto& font = doc.GetFonts().GetStandard14Font(PdfStandard14FontType::Helvetica);
+    PdfTextState state;
+    state.FontSize = 12;
+    double expectedLength = 0;
+    for (char ch : string_view("Hello World"))
+        expectedLength += font.GetCharLength((char32_t)ch, state);
+
+    REQUIRE(font.GetStringLength("Hello World", state) == expectedLength);
+    auto encoded = font.GetEncoding().ConvertToEncoded("Hello World");
+    REQUIRE(font.GetEncodedStringLength(PdfString::FromRaw(encoded), state) == Approx(expectedLength));
+}
+
+TEST_CASE("TestSharedFontCache")
+{
+    auto fontPath = TestUtils::GetTestInputFilePath("Fonts", "LiberationSans-Regular.ttf");
+    PdfFontManager::ClearSharedCache();
+    {
+        // Metrics are shared among documents
+        PdfMemDocument doc1;
+        PdfMemDocument doc2;
+        auto& font1 = doc1.GetFonts().GetOrCreateFont(fontPath);
+        auto& font2 = doc2.GetFonts().GetOrCreateFont(fontPath);
+        REQUIRE(&font1 != &font2);
+        REQUIRE(&font1.GetMetrics() == &font2.GetMetrics());
+    }
+
+    const PdfFontMetrics* metrics;
+    {
+        PdfMemDocument doc;
+        metrics = &doc.GetFonts().GetOrCreateFont(fontPath).GetMetrics();
+    }
+
+    {
+        // Metrics are retained after the documents are destroyed
+        PdfMemDocument doc;
+        REQUIRE(&doc.GetFonts().GetOrCreateFont(fontPath).GetMetrics() == metrics);
+    }
+
+    // Metrics in use are found even if they are not retained anymore
+    auto fontCopyPath = TestUtils::GetTestOutputFilePath("TestSharedFontCache.ttf");
+    {
+        charbuff fontData;
+        utls::ReadTo(fontData, fontPath);
+        utls::WriteTo(fontCopyPath, fontData);
+    }
+
+    PdfFontManager::SetSharedCacheSize(1);
+    PdfMemDocument doc1;
+    auto& font1 = doc1.GetFonts().GetOrCreateFont(fontPath);
+    {
+        // Evict the first metrics
+        PdfMemDocument doc;
+        (void)doc.GetFonts().GetOrCreateFont(fontCopyPath);
+    }
+    PdfMemDocument doc2;
+    REQUIRE(&doc2.GetFonts().GetOrCreateFont(fontPath).GetMetrics() == &font1.GetMetrics());
+
+    // Disabling the cache drops all the metrics
+    PdfFontManager::SetSharedCacheSize(0);
+    PdfMemDocument doc3;
+    REQUIRE(&doc3.GetFonts().GetOrCreateFont(fontPath).GetMetrics() != &font1.GetMetrics());
+
+    PdfFontManager::SetSharedCacheSize(32);
+}
+
+TEST_CASE("TestFontDataSharing")
+{
+    auto fontPath = TestUtils::GetTestInputFilePath("Fonts", "LiberationSans-Regular.ttf");
+    charbuff fontData;
+    utls::ReadTo(fontData, fontPath);
+
+    {
+        // Fonts with identical data are shared
+        PdfMemDocument doc;
+        auto& font = doc.GetFonts().GetOrCreateFontFromBuffer(fontData);
+        REQUIRE(&doc.GetFonts().GetOrCreateFontFromBuffer(charbuff(fontData)) == &font);
+        REQUIRE(&doc.GetFonts().GetOrCreateFont(fontPath) == &font);
+    }
+
+    charbuff buffer;
+    {
+        PdfMemDocument doc;
+        auto& page = doc.GetPages().CreatePage(PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+        PdfPainter painter;
+        painter.SetCanvas(page);
+        painter.TextState.SetFont(doc.GetFonts().GetOrCreateFont(fontPath), 12);
+        painter.DrawText("Hello", 100, 500);
+        painter.FinishDrawing();
+
+        BufferStreamDevice device(buffer);
+        doc.Save(device);
+    }
+
+    // Identical font programs of appended documents are shared
+    PdfMemDocument doc;
+    for (unsigned i = 0; i < 3; i++)
+    {
+        PdfMemDocument appended;
+        appended.LoadFromBuffer(buffer);
+        doc.GetPages().AppendDocumentPages(appended);
+    }
+
+    unsigned descriptorCount = 0;
+    set<PdfReference> fontFiles;
+    for (auto obj : doc.GetObjects())
+    {
+        const PdfDictionary* dict;
+        if (!obj->TryGetDictionary(dict) || dict->FindKeyAs<PdfName>("Type") != "FontDescriptor")
+            continue;
+
+        descriptorCount++;
+        fontFiles.insert(dict->MustGetKey("FontFile2").GetReference());
+    }
+
+    REQUIRE(descriptorCount == 3);
+    REQUIRE(fontFiles.size() == 1);
+}
+
+TEST_CASE("TestCFFSubsetting")
+{
+    auto createDocument = [](charbuff& buffer, PdfFontCreateFlags flags)
+    {
+        createFontDocument(buffer, "Hello World", [flags](PdfDocument& doc) -> const PdfFont& {
+            PdfFontCreateParams params;
+            params.Flags = flags;
+            if ((flags & PdfFontCreateFlags::PreferNonCID) != PdfFontCreateFlags::None)
+                params.Encoding = PdfEncoding(PdfEncodingMapFactory::WinAnsiEncodingInstance());
+
+            return doc.GetFonts().GetStandard14Font(PdfStandard14FontType::Helvetica, params);
+        });
+    };
+
+    charbuff buffer;
+    charbuff fontFile;
+    charbuff fullFontFile;
+    {
+        createDocument(buffer, PdfFontCreateFlags::DontSubset);
+        PdfMemDocument doc;
+        doc.LoadFromBuffer(buffer);
+        REQUIRE(getFontFile(doc, "FontFile3", fullFontFile) == "CIDFontType0C");
+    }
+
+    {
+        // CID-keyed font: the used glyphs are renumbered
+        createDocument(buffer, PdfFontCreateFlags::None);
+        PdfMemDocument doc;
+        doc.LoadFromBuffer(buffer);
+        REQUIRE(getFontFile(doc, "FontFile3", fontFile) == "CIDFontType0C");
+        REQUIRE(fontFile.size() < fullFontFile.size() / 4);
+
+        vector<PdfTextEntry> entries;
+        doc.GetPages().GetPageAt(0).ExtractTextTo(entries);
+        REQUIRE(entries.size() == 1);
+        REQUIRE(entries[0].Text == "Hello World");
+
+        // .notdef, space and "HeloWrd"
+        FT_Face face = FT::CreateFaceFromBuffer(fontFile);
+        REQUIRE(face->num_glyphs == 9);
+        char glyphName[64];
+        REQUIRE(FT_Get_Glyph_Name(face, 1, glyphName, sizeof(glyphName)) == 0);
+        REQUIRE(string_view(glyphName) == "space");
+        REQUIRE(FT_Get_Glyph_Name(face, 2, glyphName, sizeof(glyphName)) == 0);
+        REQUIRE(string_view(glyphName) == "H");
+        REQUIRE(FT_Load_Glyph(face, 2, FT_LOAD_NO_SCALE) == 0);
+        REQUIRE(face->glyph->outline.n_points != 0);
+        FT_Done_Face(face);
+    }
+
+    {
+        // Simple font: the glyph order is retained
+        createDocument(buffer, PdfFontCreateFlags::PreferNonCID);
+        PdfMemDocument doc;
+        doc.LoadFromBuffer(buffer);
+        REQUIRE(getFontFile(doc, "FontFile3", fontFile) == "Type1C");
+        REQUIRE(fontFile.size() < fullFontFile.size() / 2);
+
+        vector<PdfTextEntry> entries;
+        doc.GetPages().GetPageAt(0).ExtractTextTo(entries);
+        REQUIRE(entries.size() == 1);
+        REQUIRE(entries[0].Text == "Hello World");
+
+        FT_Face face = FT::CreateFaceFromBuffer(fontFile);
+        FT_Face fullFace = FT::CreateFaceFromBuffer(fullFontFile);
+        REQUIRE(face->num_glyphs == fullFace->num_glyphs);
+        unsigned gid = FT_Get_Name_Index(face, "H");
+        REQUIRE(gid == FT_Get_Name_Index(fullFace, "H"));
+        REQUIRE(FT_Load_Glyph(face, gid, FT_LOAD_NO_SCALE) == 0);
+        REQUIRE(face->glyph->outline.n_points != 0);
+        REQUIRE(FT_Load_Glyph(face, FT_Get_Name_Index(face, "Z"), FT_LOAD_NO_SCALE) == 0);
+        REQUIRE(face->glyph->outline.n_points == 0);
+        FT_Done_Face(face);
+        FT_Done_Face(fullFace);
+    }
+}
+
+TEST_CASE("TestTrueTypeSubsetting")
+{
+    auto createDocument = [](charbuff& buffer, PdfFontCreateFlags flags)
+    {
+        // Accented letters are usually compound glyphs
+        createFontDocument(buffer, "Hello Åé", [flags](PdfDocument& doc) -> const PdfFont& {
+            PdfFontCreateParams params;
+            params.Flags = flags;
+            return doc.GetFonts().GetOrCreateFont(
+                TestUtils::GetTestInputFilePath("Fonts", "LiberationSans-Regular.ttf"), params);
+        });
+    };
+
+    auto hasTable = [](FT_Face face, FT_ULong tag)
+    {
+        FT_ULong length = 0;
+        return FT_Load_Sfnt_Table(face, tag, 0, nullptr, &length) == 0;
+    };
+
+    auto checkFont = [](const charbuff& fontFile)
+    {
+        // The whole font checksum must equal the magic number
+        // https://learn.microsoft.com/en-us/typography/opentype/spec/otff#calculating-checksums
+        REQUIRE(fontFile.size() % 4 == 0);
+        uint32_t sum = 0;
+        for (size_t i = 0; i < fontFile.size(); i += 4)
+        {
+            sum += (uint32_t)(uint8_t)fontFile[i] << 24 | (uint32_t)(uint8_t)fontFile[i + 1] << 16
+                | (uint32_t)(uint8_t)fontFile[i + 2] << 8 | (uint32_t)(uint8_t)fontFile[i + 3];
+        }
+        REQUIRE(sum == 0xB1B0AFBA);
+
+        FT_Face face = FT::CreateFaceFromBuffer(fontFile);
+        // Every glyph of the subset, including the compound
+        // glyphs components, must be loadable
+        for (FT_Long gid = 1; gid < face->num_glyphs; gid++)
+            REQUIRE(FT_Load_Glyph(face, (FT_UInt)gid, FT_LOAD_NO_SCALE) == 0);
+        return face;
+    };
+
+    charbuff buffer;
+    charbuff fontFile;
+    charbuff minimalFontFile;
+    FT_Long glyphCount;
+    {
+        createDocument(buffer, PdfFontCreateFlags::None);
+        PdfMemDocument doc;
+        doc.LoadFromBuffer(buffer);
+        (void)getFontFile(doc, "FontFile2", fontFile);
+
+        vector<PdfTextEntry> entries;
+        doc.GetPages().GetPageAt(0).ExtractTextTo(entries);
+        REQUIRE(entries.size() == 1);
+        REQUIRE(entries[0].Text == "Hello Åé");
+
+        FT_Face face = checkFont(fontFile);
+        // .notdef, space and "HeloÅé", plus the components
+        // of the compound glyphs
+        glyphCount = face->num_glyphs;
+        REQUIRE(glyphCount > 8);
+        REQUIRE(glyphCount < 16);
+        REQUIRE(hasTable(face, TTAG_fpgm));
+        REQUIRE(hasTable(face, TTAG_post));
+        REQUIRE(!hasTable(face, TTAG_cmap));
+        FT_Done_Face(face);
+    }
+
+    {
+        createDocument(buffer, PdfFontCreateFlags::SubsetMinimalTables);
+        PdfMemDocument doc;
+        doc.LoadFromBuffer(buffer);
+        (void)getFontFile(doc, "FontFile2", minimalFontFile);
+        REQUIRE(minimalFontFile.size() < fontFile.size());
+
+        vector<PdfTextEntry> entries;
+        doc.GetPages().GetPageAt(0).ExtractTextTo(entries);
+        REQUIRE(entries.size() == 1);
+        REQUIRE(entries[0].Text == "Hello Åé");
+
+        FT_Face face = checkFont(minimalFontFile);
+        REQUIRE(face->num_glyphs == glyphCount);
+        REQUIRE(!hasTable(face, TTAG_fpgm));
+        REQUIRE(!hasTable(face, TTAG_prep));
+        REQUIRE(!hasTable(face, TTAG_post));
+        REQUIRE(hasTable(face, TTAG_glyf));
+        FT_Done_Face(face);
+    }
+}
+
+void createFontDocument(charbuff& buffer, const string_view& text,
+    const function<const PdfFont&(PdfDocument& doc)>& createFont)
+{
+    PdfMemDocument doc;
+    auto& page = doc.GetPages().CreatePage(PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+    PdfPainter painter;
+    painter.SetCanvas(page);
+    painter.TextState.SetFont(createFont(doc), 12);
+    painter.DrawText(text, 100, 500);
+    painter.FinishDrawing();
+
+    BufferStreamDevice device(buffer);
+    doc.Save(device);
+}
+
+// Copy the font file of the first font descriptor
+// and return its /Subtype, if present
+PdfName getFontFile(PdfMemDocument& doc, const string_view& fontFileKey, charbuff& fontFile)
+{
+    for (auto obj : doc.GetObjects())
+    {
+        const PdfDictionary* dict;
+        if (!obj->TryGetDictionary(dict) || dict->FindKeyAs<PdfName>("Type") != "FontDescriptor")
+            continue;
+
+        auto& fontFileObj = dict->MustFindKey(fontFileKey);
+        fontFileObj.MustGetStream().CopyTo(fontFile);
+        return fontFileObj.GetDictionary().FindKeyAs<PdfName>("Subtype");
+    }
+
+    FAIL("Missing font descriptor");
+    return PdfName();
+}
+
 void testSingleFont(FcPattern* font)
 {
     PdfMemDocument doc;
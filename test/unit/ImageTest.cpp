@@ -8,6 +8,10 @@
 
 #include <PdfTest.h>
 
+#include <chrono>
+
+#include <zlib.h>
+
 using namespace std;
 using namespace PoDoFo;
 
@@ -226,3 +230,507 @@ TEST_CASE("TestImage7")
         doc.Save(outputFile);
     }
 }
+
+TEST_CASE("TestImageDecodeStreaming")
+{
+    // Large enough that the filtered data is decoded in multiple chunks
+    constexpr unsigned Width = 640;
+    constexpr unsigned Height = 480;
+    charbuff rgb((size_t)Width * Height * 3);
+    charbuff alpha((size_t)Width * Height);
+    for (unsigned i = 0; i < Height; i++)
+    {
+        for (unsigned j = 0; j < Width; j++)
+        {
+            size_t offset = (size_t)i * Width + j;
+            rgb[offset * 3 + 0] = (char)(i + j);
+            rgb[offset * 3 + 1] = (char)(i * 3);
+            rgb[offset * 3 + 2] = (char)(j * 7);
+            alpha[offset] = (char)(i ^ j);
+        }
+    }
+
+    PdfMemDocument doc;
+    auto img = doc.CreateImage();
+    img->SetData(rgb, Width, Height, PdfPixelFormat::RGB24);
+    auto mask = doc.CreateImage();
+    mask->SetData(alpha, Width, Height, PdfPixelFormat::Grayscale);
+    img->SetSoftMask(*mask);
+
+    charbuff buffer;
+    img->DecodeTo(buffer, PdfPixelFormat::RGBA);
+    REQUIRE(buffer.size() == (size_t)Width * Height * 4);
+    for (size_t i = 0; i < (size_t)Width * Height; i++)
+    {
+        if (buffer[i * 4 + 0] != rgb[i * 3 + 0] || buffer[i * 4 + 1] != rgb[i * 3 + 1]
+            || buffer[i * 4 + 2] != rgb[i * 3 + 2] || buffer[i * 4 + 3] != alpha[i])
+        {
+            FAIL("Pixel mismatch at " << i);
+        }
+    }
+
+#ifdef PODOFO_HAVE_JPEG_LIB
+    // Decode a JPEG, reading the compressed data incrementally
+    charbuff jpeg;
+    img->ExportTo(jpeg, PdfExportFormat::Jpeg);
+    auto jpegImg = doc.CreateImage();
+    jpegImg->LoadFromBuffer(jpeg);
+    jpegImg->SetSoftMask(*mask);
+    jpegImg->DecodeTo(buffer, PdfPixelFormat::RGBA);
+    REQUIRE(buffer.size() == (size_t)Width * Height * 4);
+    for (size_t i = 0; i < (size_t)Width * Height; i++)
+    {
+        if (buffer[i * 4 + 3] != alpha[i])
+            FAIL("Alpha mismatch at " << i);
+    }
+#endif // PODOFO_HAVE_JPEG_LIB
+
+    // Short image data is detected while decoding
+    auto truncated = doc.CreateImage();
+    PdfImageInfo info;
+    info.Width = Width;
+    info.Height = Height;
+    info.ColorSpace = PdfColorSpaceFilterFactory::GetDeviceRGBInstace();
+    info.BitsPerComponent = 8;
+    truncated->SetDataRaw(bufferview(rgb.data(), rgb.size() / 2), info);
+    ASSERT_THROW_WITH_ERROR_CODE(truncated->DecodeTo(buffer, PdfPixelFormat::RGBA), PdfErrorCode::UnsupportedImageFormat);
+}
+
+static unique_ptr<PdfImage> createTestImage(PdfDocument& doc, unsigned width, unsigned height,
+    const PdfColorSpaceFilterPtr& colorSpace, unsigned components)
+{
+    charbuff data((size_t)width * height * components);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = (char)(i * 7 + i / 5);
+
+    PdfImageInfo info;
+    info.Width = width;
+    info.Height = height;
+    info.ColorSpace = colorSpace;
+    info.BitsPerComponent = 8;
+    info.Filters = PdfFilterList();
+    auto image = doc.CreateImage();
+    image->SetDataRaw(data, info);
+    return image;
+}
+
+TEST_CASE("TestImageConversionSimd")
+{
+    PdfPixelFormat formats[] = { PdfPixelFormat::Grayscale, PdfPixelFormat::RGB24, PdfPixelFormat::BGR24,
+        PdfPixelFormat::RGBA, PdfPixelFormat::BGRA, PdfPixelFormat::ARGB, PdfPixelFormat::ABGR };
+
+    PdfMemDocument doc;
+    for (unsigned width : { 1u, 5u, 16u, 37u, 100u })
+    {
+        auto gray = createTestImage(doc, width, 3, PdfColorSpaceFilterFactory::GetDeviceGrayInstace(), 1);
+        auto rgb = createTestImage(doc, width, 3, PdfColorSpaceFilterFactory::GetDeviceRGBInstace(), 3);
+        auto rgbMasked = createTestImage(doc, width, 3, PdfColorSpaceFilterFactory::GetDeviceRGBInstace(), 3);
+        auto grayMasked = createTestImage(doc, width, 3, PdfColorSpaceFilterFactory::GetDeviceGrayInstace(), 1);
+        auto mask = createTestImage(doc, width, 3, PdfColorSpaceFilterFactory::GetDeviceGrayInstace(), 1);
+        rgbMasked->SetSoftMask(*mask);
+        grayMasked->SetSoftMask(*mask);
+
+        for (auto image : { gray.get(), rgb.get(), rgbMasked.get(), grayMasked.get() })
+        {
+            for (auto format : formats)
+            {
+                if (format == PdfPixelFormat::Grayscale
+                    && image->GetColorSpace().GetPixelFormat() != PdfColorSpacePixelFormat::Grayscale)
+                {
+                    continue;
+                }
+
+                // The vectorized conversion must match the scalar one
+                charbuff expected;
+                charbuff buffer;
+                PdfCommon::SetSimdEnabled(false);
+                image->DecodeTo(expected, format);
+                PdfCommon::SetSimdEnabled(true);
+                image->DecodeTo(buffer, format);
+                INFO(utls::Format("Width: {}, Format: {}", width, (int)format));
+                REQUIRE(buffer == expected);
+            }
+        }
+    }
+}
+
+TEST_CASE("TestImageConversionBenchmark", "[.]")
+{
+    PdfMemDocument doc;
+    auto image = createTestImage(doc, 4000, 1000, PdfColorSpaceFilterFactory::GetDeviceRGBInstace(), 3);
+    auto mask = createTestImage(doc, 4000, 1000, PdfColorSpaceFilterFactory::GetDeviceGrayInstace(), 1);
+    image->SetSoftMask(*mask);
+
+    charbuff buffer;
+    for (bool simd : { false, true })
+    {
+        PdfCommon::SetSimdEnabled(simd);
+        for (auto format : { PdfPixelFormat::RGB24, PdfPixelFormat::BGRA, PdfPixelFormat::ARGB })
+        {
+            auto start = chrono::steady_clock::now();
+            for (unsigned i = 0; i < 10; i++)
+                image->DecodeTo(buffer, format);
+            auto elapsed = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+            WARN(utls::Format("SIMD: {}, Format: {}, Elapsed: {}ms", simd, (int)format, elapsed.count()));
+        }
+    }
+    PdfCommon::SetSimdEnabled(true);
+}
+
+static void appendPngChunk(charbuff& png, const string_view& type, const bufferview& data)
+{
+    auto appendUInt32 = [&png](uint32_t value) {
+        png.push_back((char)(value >> 24));
+        png.push_back((char)(value >> 16));
+        png.push_back((char)(value >> 8));
+        png.push_back((char)value);
+    };
+
+    appendUInt32((uint32_t)data.size());
+    size_t offset = png.size();
+    png.append(type.data(), 4);
+    png.append(data.data(), data.size());
+    appendUInt32((uint32_t)crc32(crc32(0, nullptr, 0), (const Bytef*)png.data() + offset, (uInt)(data.size() + 4)));
+}
+
+// Create a non interlaced PNG with 8 bits samples,
+// using the "Sub" filter on all rows
+static charbuff createTestPng(unsigned width, unsigned height, unsigned char colorType,
+    unsigned components, const charbuff& pixels)
+{
+    size_t rowSize = (size_t)width * components;
+    charbuff filtered;
+    for (unsigned i = 0; i < height; i++)
+    {
+        filtered.push_back(1);
+        const char* row = pixels.data() + i * rowSize;
+        for (size_t j = 0; j < rowSize; j++)
+            filtered.push_back((char)(row[j] - (j < components ? 0 : row[j - components])));
+    }
+
+    uLongf compressedLen = compressBound((uLong)filtered.size());
+    charbuff compressed(compressedLen);
+    REQUIRE(compress((Bytef*)compressed.data(), &compressedLen, (const Bytef*)filtered.data(), (uLong)filtered.size()) == Z_OK);
+    compressed.resize(compressedLen);
+
+    charbuff png("\x89PNG\r\n\x1A\n"sv);
+    char header[13] = { };
+    header[0] = (char)(width >> 24);
+    header[1] = (char)(width >> 16);
+    header[2] = (char)(width >> 8);
+    header[3] = (char)width;
+    header[4] = (char)(height >> 24);
+    header[5] = (char)(height >> 16);
+    header[6] = (char)(height >> 8);
+    header[7] = (char)height;
+    header[8] = 8;
+    header[9] = (char)colorType;
+    appendPngChunk(png, "IHDR", bufferview(header, 13));
+    // Split the data in two IDAT chunks
+    size_t half = compressed.size() / 2;
+    appendPngChunk(png, "IDAT", bufferview(compressed.data(), half));
+    appendPngChunk(png, "IDAT", bufferview(compressed.data() + half, compressed.size() - half));
+    appendPngChunk(png, "IEND", { });
+    return png;
+}
+
+TEST_CASE("TestImagePngPassthrough")
+{
+    constexpr unsigned Width = 37;
+    constexpr unsigned Height = 21;
+    charbuff rgb((size_t)Width * Height * 3);
+    for (size_t i = 0; i < rgb.size(); i++)
+        rgb[i] = (char)(i * 13 + i / 7);
+
+    PdfMemDocument doc;
+    {
+        // A RGB PNG is embedded with the original compressed data
+        auto png = createTestPng(Width, Height, 2, 3, rgb);
+        auto image = doc.CreateImage();
+        image->LoadFromBuffer(png);
+        auto& dict = image->GetDictionary();
+        REQUIRE(dict.MustFindKey("Filter").GetName() == "FlateDecode");
+        auto& decodeParms = dict.MustFindKey("DecodeParms").GetDictionary();
+        REQUIRE(decodeParms.MustFindKey("Predictor").GetNumber() == 15);
+        REQUIRE(decodeParms.MustFindKey("Colors").GetNumber() == 3);
+        REQUIRE(decodeParms.MustFindKey("Columns").GetNumber() == Width);
+        REQUIRE(dict.FindKey("SMask") == nullptr);
+
+        // NOTE: RGB24 scan lines are 4 bytes aligned
+        constexpr unsigned Stride = 4 * ((3 * Width + 3) / 4);
+        charbuff decoded;
+        image->DecodeTo(decoded, PdfPixelFormat::RGB24);
+        REQUIRE(decoded.size() == Stride * Height);
+        for (unsigned i = 0; i < Height; i++)
+            REQUIRE(std::memcmp(decoded.data() + i * Stride, rgb.data() + i * Width * 3, Width * 3) == 0);
+    }
+
+    {
+        // A PNG with alpha channel is still decoded and split
+        charbuff rgba((size_t)Width * Height * 4);
+        for (size_t i = 0; i < (size_t)Width * Height; i++)
+        {
+            std::memcpy(rgba.data() + i * 4, rgb.data() + i * 3, 3);
+            rgba[i * 4 + 3] = (char)i;
+        }
+
+        auto png = createTestPng(Width, Height, 6, 4, rgba);
+        auto image = doc.CreateImage();
+        image->LoadFromBuffer(png);
+        auto& dict = image->GetDictionary();
+        REQUIRE(dict.FindKey("DecodeParms") == nullptr);
+        REQUIRE(dict.FindKey("SMask") != nullptr);
+
+        charbuff decoded;
+        image->DecodeTo(decoded, PdfPixelFormat::RGBA);
+        REQUIRE(decoded == rgba);
+    }
+}
+
+static unique_ptr<PdfImage> createRawImage(PdfDocument& doc, const charbuff& data, unsigned width, unsigned height,
+    PdfColorSpaceType colorSpace, unsigned char bitsPerComponent)
+{
+    PdfImageInfo info;
+    info.Width = width;
+    info.Height = height;
+    info.ColorSpace = PdfColorSpaceFilterFactory::GetTrivialFilter(colorSpace);
+    info.BitsPerComponent = bitsPerComponent;
+    info.Filters = PdfFilterList();
+    auto image = doc.CreateImage();
+    image->SetDataRaw(data, info);
+    return image;
+}
+
+static unique_ptr<PdfImage> reloadImage(const PdfObject& obj)
+{
+    unique_ptr<PdfImage> image;
+    REQUIRE(PdfXObject::TryCreateFromObject(const_cast<PdfObject&>(obj), image));
+    return image;
+}
+
+TEST_CASE("TestImageOptimize")
+{
+    constexpr unsigned Width = 600;
+    constexpr unsigned Height = 400;
+    constexpr double Scale = 72.0 / Width;
+
+    PdfMemDocument doc;
+    auto& page = doc.GetPages().CreatePage(PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+
+    // Left half red, right half blue
+    charbuff rgb((size_t)Width * Height * 3);
+    for (unsigned i = 0; i < Width * Height; i++)
+    {
+        bool left = i % Width < Width / 2;
+        rgb[i * 3 + 0] = left ? (char)255 : 0;
+        rgb[i * 3 + 1] = 0;
+        rgb[i * 3 + 2] = left ? 0 : (char)255;
+    }
+    auto rgbImage = createRawImage(doc, rgb, Width, Height, PdfColorSpaceType::DeviceRGB, 8);
+
+    charbuff gray((size_t)Width * Height);
+    for (unsigned i = 0; i < Width * Height; i++)
+        gray[i] = (char)(i % Width < Width / 2 ? 64 : 192);
+    auto grayImage = createRawImage(doc, gray, Width, Height, PdfColorSpaceType::DeviceGray, 8);
+    auto smask = createRawImage(doc, gray, Width, Height, PdfColorSpaceType::DeviceGray, 8);
+    grayImage->SetSoftMask(*smask);
+
+    // Upper half black, lower half white
+    charbuff bilevel((size_t)Width / 8 * Height);
+    for (unsigned i = 0; i < Height; i++)
+        std::memset(bilevel.data() + i * Width / 8, i < Height / 2 ? 0 : 0xFF, Width / 8);
+    auto bilevelImage = createRawImage(doc, bilevel, Width, Height, PdfColorSpaceType::DeviceGray, 1);
+
+    charbuff jpeg;
+    rgbImage->ExportTo(jpeg, PdfExportFormat::Jpeg);
+    auto jpegImage = doc.CreateImage();
+    jpegImage->LoadFromBuffer(jpeg);
+
+    auto lowResImage = createTestImage(doc, 64, 64, PdfColorSpaceFilterFactory::GetTrivialFilter(PdfColorSpaceType::DeviceRGB), 3);
+
+    {
+        PdfPainter painter;
+        painter.SetCanvas(page);
+        // Draw the images 1 inch wide, that is 600 DPI
+        painter.DrawImage(*rgbImage, 0, 0, Scale, Scale);
+        painter.DrawImage(*grayImage, 100, 0, Scale, Scale);
+        painter.DrawImage(*bilevelImage, 200, 0, Scale, Scale);
+        painter.Save();
+        painter.GraphicsState.SetCurrentMatrix(Matrix::CreateScale({ 0.5, 0.5 }));
+        painter.DrawImage(*jpegImage, 600, 0, 2 * Scale, 2 * Scale);
+        painter.Restore();
+        // The largest drawing determines the resolution: 64 pixels in 2 inches
+        painter.DrawImage(*lowResImage, 0, 200, 144.0 / 64, 144.0 / 64);
+        painter.DrawImage(*lowResImage, 300, 200, 0.1, 0.1);
+        painter.FinishDrawing();
+    }
+
+    REQUIRE(doc.OptimizeImages({ }, 2) == 4);
+
+    // 600 DPI to 150 DPI
+    auto image = reloadImage(rgbImage->GetObject());
+    REQUIRE(image->GetWidth() == 150);
+    REQUIRE(image->GetHeight() == 100);
+    REQUIRE(image->GetDictionary().MustFindKey("Filter").GetName() == "FlateDecode");
+    charbuff decoded;
+    image->DecodeTo(decoded, PdfPixelFormat::RGB24);
+    REQUIRE(string_view(decoded.data() + 74 * 3, 3) == "\xFF\x00\x00"sv);
+    REQUIRE(string_view(decoded.data() + 75 * 3, 3) == "\x00\x00\xFF"sv);
+
+    image = reloadImage(grayImage->GetObject());
+    REQUIRE(image->GetWidth() == 150);
+    REQUIRE(image->GetHeight() == 100);
+    image = reloadImage(smask->GetObject());
+    REQUIRE(image->GetWidth() == 150);
+    REQUIRE(image->GetHeight() == 100);
+    image->DecodeTo(decoded, PdfPixelFormat::Grayscale);
+    REQUIRE((unsigned char)decoded[74] == 64);
+    REQUIRE((unsigned char)decoded[75] == 192);
+
+    image = reloadImage(bilevelImage->GetObject());
+    REQUIRE(image->GetWidth() == 150);
+    REQUIRE(image->GetHeight() == 100);
+    REQUIRE(image->GetDictionary().MustFindKey("BitsPerComponent").GetNumber() == 1);
+    image->DecodeTo(decoded, PdfPixelFormat::Grayscale);
+    unsigned scanLineSize = (unsigned)decoded.size() / 100;
+    REQUIRE((unsigned char)decoded[49 * scanLineSize] == 0);
+    REQUIRE((unsigned char)decoded[50 * scanLineSize] == 255);
+
+    // The image is scaled by the CTM and remains JPEG encoded
+    image = reloadImage(jpegImage->GetObject());
+    REQUIRE(image->GetWidth() == 150);
+    REQUIRE(image->GetHeight() == 100);
+    REQUIRE(image->GetDictionary().MustFindKey("Filter").GetName() == "DCTDecode");
+
+    image = reloadImage(lowResImage->GetObject());
+    REQUIRE(image->GetWidth() == 64);
+    REQUIRE(image->GetHeight() == 64);
+
+    // Only the uncompressed image is re-encoded, the others don't get
+    // smaller and JPEG images are re-encoded only when downsampled
+    PdfImageOptimizeParams params;
+    params.Flags = PdfImageOptimizeFlags::RecompressAll;
+    REQUIRE(doc.OptimizeImages(params) == 1);
+    image = reloadImage(lowResImage->GetObject());
+    REQUIRE(image->GetWidth() == 64);
+    REQUIRE(image->GetDictionary().MustFindKey("Filter").GetName() == "FlateDecode");
+}
+
+TEST_CASE("TestImageOptimizeSMasks")
+{
+    constexpr unsigned Width = 600;
+    constexpr unsigned Height = 400;
+    constexpr double Scale = 72.0 / Width;
+
+    PdfMemDocument doc;
+    auto& page = doc.GetPages().CreatePage(PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+    charbuff gray((size_t)Width * Height);
+    for (unsigned i = 0; i < Width * Height; i++)
+        gray[i] = (char)(i % Width < Width / 2 ? 64 : 192);
+
+    // An image whose /SMask is drawn directly as well
+    auto image1 = createRawImage(doc, gray, Width, Height, PdfColorSpaceType::DeviceGray, 8);
+    auto smask1 = createRawImage(doc, gray, Width, Height, PdfColorSpaceType::DeviceGray, 8);
+    image1->SetSoftMask(*smask1);
+
+    // Images sharing the same /SMask
+    auto image2 = createRawImage(doc, gray, Width, Height, PdfColorSpaceType::DeviceGray, 8);
+    auto image3 = createRawImage(doc, gray, Width, Height, PdfColorSpaceType::DeviceGray, 8);
+    auto smask2 = createRawImage(doc, gray, Width, Height, PdfColorSpaceType::DeviceGray, 8);
+    image2->SetSoftMask(*smask2);
+    image3->SetSoftMask(*smask2);
+
+    auto image4 = createRawImage(doc, gray, Width, Height, PdfColorSpaceType::DeviceGray, 8);
+    {
+        PdfPainter painter;
+        painter.SetCanvas(page);
+        painter.DrawImage(*image1, 0, 0, Scale, Scale);
+        painter.DrawImage(*smask1, 100, 0, 2 * Scale, 2 * Scale);
+        painter.DrawImage(*image2, 200, 0, Scale, Scale);
+        painter.DrawImage(*image3, 300, 0, 2 * Scale, 2 * Scale);
+        painter.DrawImage(*image4, 400, 0, Scale, Scale);
+        painter.FinishDrawing();
+    }
+
+    // Only the image with no /SMask is downsampled
+    REQUIRE(doc.OptimizeImages({ }, 2) == 1);
+    REQUIRE(reloadImage(image4->GetObject())->GetWidth() == 150);
+    for (auto image : { image1.get(), smask1.get(), image2.get(), image3.get(), smask2.get() })
+        REQUIRE(reloadImage(image->GetObject())->GetWidth() == Width);
+}
+
+TEST_CASE("TestImageOptimizeLoaded")
+{
+    constexpr unsigned Width = 600;
+    constexpr unsigned Height = 400;
+    constexpr double Scale = 72.0 / Width;
+
+    charbuff buffer;
+    {
+        PdfMemDocument doc;
+        auto& page = doc.GetPages().CreatePage(PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+        charbuff gray((size_t)Width * Height);
+        for (unsigned i = 0; i < Width * Height; i++)
+            gray[i] = (char)(i % Width < Width / 2 ? 64 : 192);
+
+        // Images sharing an indirect /DecodeParms, loaded on demand
+        auto& decodeParms = doc.GetObjects().CreateDictionaryObject();
+        decodeParms.GetDictionary().AddKey("Predictor", static_cast<int64_t>(1));
+        PdfPainter painter;
+        painter.SetCanvas(page);
+        for (unsigned i = 0; i < 4; i++)
+        {
+            auto image = doc.CreateImage();
+            image->SetData(gray, Width, Height, PdfPixelFormat::Grayscale);
+            image->GetDictionary().AddKey("DecodeParms", decodeParms.GetIndirectReference());
+            painter.DrawImage(*image, 100.0 * i, 0, Scale, Scale);
+        }
+        painter.FinishDrawing();
+
+        BufferStreamDevice device(buffer);
+        doc.Save(device);
+    }
+
+    PdfMemDocument doc;
+    doc.LoadFromBuffer(buffer);
+    REQUIRE(doc.OptimizeImages({ }, 4) == 4);
+    unsigned count = 0;
+    for (auto obj : doc.GetObjects())
+    {
+        if (obj->IsDictionary() && obj->GetDictionary().FindKeyAs<PdfName>("Subtype") == "Image")
+        {
+            REQUIRE(reloadImage(*obj)->GetWidth() == 150);
+            count++;
+        }
+    }
+    REQUIRE(count == 4);
+}
+
+TEST_CASE("TestImageOptimizeSimd")
+{
+    // Downsample the same image with and without SIMD and compare the results
+    auto optimize = [](bool simd) {
+        PdfMemDocument doc;
+        auto& page = doc.GetPages().CreatePage(PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+        auto image = createTestImage(doc, 997, 331, PdfColorSpaceFilterFactory::GetTrivialFilter(PdfColorSpaceType::DeviceRGB), 3);
+        {
+            PdfPainter painter;
+            painter.SetCanvas(page);
+            painter.DrawImage(*image, 0, 0, 0.1, 0.1);
+            painter.FinishDrawing();
+        }
+
+        bool simdEnabled = PdfCommon::IsSimdEnabled();
+        PdfCommon::SetSimdEnabled(simd);
+        unsigned count = doc.OptimizeImages({ }, 1);
+        PdfCommon::SetSimdEnabled(simdEnabled);
+        REQUIRE(count == 1);
+
+        charbuff decoded;
+        image = reloadImage(image->GetObject());
+        image->DecodeTo(decoded, PdfPixelFormat::RGB24);
+        return decoded;
+    };
+
+    REQUIRE(optimize(true) == optimize(false));
+}
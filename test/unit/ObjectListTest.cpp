@@ -0,0 +1,151 @@
+/**
+ * SPDX-FileCopyrightText: (C) 2022 Francesco Pretto <ceztko@gmail.com>
+ * SPDX-License-Identifier: LGPL-2.0-or-later
+ * SPDX-License-Identifier: MPL-2.0
+ */
+
+#include <PdfTest.h>
+
+using namespace std;
+using namespace PoDoFo;
+
+static unique_ptr<PdfImage> createImage(PdfDocument& doc, const charbuff& data, unsigned width, unsigned height,
+    PdfColorSpaceType colorSpace, unsigned char bitsPerComponent);
+
+TEST_CASE("TestStreamDeduplication")
+{
+    charbuff buffer;
+    {
+        PdfMemDocument doc;
+        charbuff data(4 * 4 * 3);
+        std::memset(data.data(), 128, data.size());
+        auto image1 = createImage(doc, data, 4, 4, PdfColorSpaceType::DeviceRGB, 8);
+        auto image2 = createImage(doc, data, 4, 4, PdfColorSpaceType::DeviceRGB, 8);
+        data[0] = 0;
+        auto image3 = createImage(doc, data, 4, 4, PdfColorSpaceType::DeviceRGB, 8);
+
+        // Forms that are identical only after merging the images they use
+        auto createForm = [&doc](const PdfImage& image) -> PdfObject& {
+            auto& form = doc.GetObjects().CreateDictionaryObject("XObject", "Form");
+            auto& dict = form.GetDictionary();
+            PdfArray bbox;
+            bbox.Add(PdfObject(static_cast<int64_t>(0)));
+            bbox.Add(PdfObject(static_cast<int64_t>(0)));
+            bbox.Add(PdfObject(static_cast<int64_t>(1)));
+            bbox.Add(PdfObject(static_cast<int64_t>(1)));
+            dict.AddKey("BBox", bbox);
+            PdfDictionary xobjects;
+            xobjects.AddKey("Im0", image.GetObject().GetIndirectReference());
+            PdfDictionary resources;
+            resources.AddKey("XObject", xobjects);
+            dict.AddKey("Resources", resources);
+            form.GetOrCreateStream().SetData("/Im0 Do"sv);
+            return form;
+        };
+        auto& form1 = createForm(*image1);
+        auto& form2 = createForm(*image2);
+        auto& form3 = createForm(*image3);
+
+        auto addPage = [&doc](const PdfObject& form) {
+            auto& page = doc.GetPages().CreatePage(PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+            PdfDictionary xobjects;
+            xobjects.AddKey("Fm0", form.GetIndirectReference());
+            PdfDictionary resources;
+            resources.AddKey("XObject", xobjects);
+            page.GetDictionary().AddKey("Resources", resources);
+            // Identical page contents must not be merged
+            auto& contents = doc.GetObjects().CreateDictionaryObject();
+            contents.GetOrCreateStream().SetData("/Fm0 Do"sv);
+            page.GetDictionary().AddKeyIndirect("Contents", contents);
+        };
+        addPage(form1);
+        addPage(form2);
+        addPage(form3);
+
+        BufferStreamDevice device(buffer);
+        doc.Save(device, PdfSaveOptions::DeduplicateStreams | PdfSaveOptions::NoMetadataUpdate);
+        REQUIRE(doc.DeduplicateStreams() == 0);
+    }
+
+    PdfMemDocument doc;
+    doc.LoadFromBuffer(buffer);
+    auto getForm = [&doc](unsigned pageIndex) {
+        return doc.GetPages().GetPageAt(pageIndex).GetDictionary()
+            .MustFindKey("Resources").GetDictionary()
+            .MustFindKey("XObject").GetDictionary()
+            .MustGetKey("Fm0").GetReference();
+    };
+    auto getImage = [&doc](const PdfReference& formRef) {
+        return doc.GetObjects().MustGetObject(formRef).GetDictionary()
+            .MustFindKey("Resources").GetDictionary()
+            .MustFindKey("XObject").GetDictionary()
+            .MustGetKey("Im0").GetReference();
+    };
+    REQUIRE(getForm(0) == getForm(1));
+    REQUIRE(getForm(0) != getForm(2));
+    REQUIRE(getImage(getForm(0)) != getImage(getForm(2)));
+
+    set<PdfReference> contents;
+    unsigned imageCount = 0;
+    for (unsigned i = 0; i < 3; i++)
+        contents.insert(doc.GetPages().GetPageAt(i).GetDictionary().MustGetKey("Contents").GetReference());
+    for (auto obj : doc.GetObjects())
+    {
+        if (obj->IsDictionary() && obj->GetDictionary().FindKeyAs<PdfName>("Subtype") == "Image")
+            imageCount++;
+    }
+    REQUIRE(contents.size() == 3);
+    REQUIRE(imageCount == 2);
+
+    // Merge the duplicates directly
+    PdfMemDocument doc2;
+    charbuff data(16);
+    std::memset(data.data(), 1, data.size());
+    auto image1 = createImage(doc2, data, 4, 4, PdfColorSpaceType::DeviceGray, 8);
+    auto image2 = createImage(doc2, data, 4, 4, PdfColorSpaceType::DeviceGray, 8);
+    auto& page = doc2.GetPages().CreatePage(PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+    PdfDictionary xobjects;
+    xobjects.AddKey("Im0", image1->GetObject().GetIndirectReference());
+    xobjects.AddKey("Im1", image2->GetObject().GetIndirectReference());
+    PdfDictionary resources;
+    resources.AddKey("XObject", xobjects);
+    page.GetDictionary().AddKey("Resources", resources);
+    REQUIRE(doc2.DeduplicateStreams() == 1);
+    auto& merged = page.GetDictionary().MustFindKey("Resources").GetDictionary()
+        .MustFindKey("XObject").GetDictionary();
+    REQUIRE(merged.MustGetKey("Im0").GetReference() == merged.MustGetKey("Im1").GetReference());
+}
+
+TEST_CASE("TestStreamDeduplicationIndirectContents")
+{
+    PdfMemDocument doc;
+    auto& page = doc.GetPages().CreatePage(PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+    auto& contents1 = doc.GetObjects().CreateDictionaryObject();
+    contents1.GetOrCreateStream().SetData("q Q"sv);
+    auto& contents2 = doc.GetObjects().CreateDictionaryObject();
+    contents2.GetOrCreateStream().SetData("q Q"sv);
+
+    // /Contents is a reference to an array of content streams
+    auto& array = doc.GetObjects().CreateArrayObject();
+    array.GetArray().Add(contents1.GetIndirectReference());
+    array.GetArray().Add(contents2.GetIndirectReference());
+    page.GetDictionary().AddKeyIndirect("Contents", array);
+
+    REQUIRE(doc.DeduplicateStreams() == 0);
+    REQUIRE(array.GetArray()[0].GetReference() == contents1.GetIndirectReference());
+    REQUIRE(array.GetArray()[1].GetReference() == contents2.GetIndirectReference());
+}
+
+unique_ptr<PdfImage> createImage(PdfDocument& doc, const charbuff& data, unsigned width, unsigned height,
+    PdfColorSpaceType colorSpace, unsigned char bitsPerComponent)
+{
+    PdfImageInfo info;
+    info.Width = width;
+    info.Height = height;
+    info.ColorSpace = PdfColorSpaceFilterFactory::GetTrivialFilter(colorSpace);
+    info.BitsPerComponent = bitsPerComponent;
+    info.Filters = PdfFilterList();
+    auto image = doc.CreateImage();
+    image->SetDataRaw(data, info);
+    return image;
+}
@@ -85,3 +85,262 @@ TEST_CASE("TestFlattening")
         REQUIRE(child.GetDictionary().MustGetKey("Parent").GetReference() == pageRootRef);
     }
 }
+
+static constexpr unsigned ImportPageCount = 20;
+
+static unsigned countObjectsOfType(const PdfMemDocument& doc, const string_view& type)
+{
+    unsigned count = 0;
+    for (auto obj : doc.GetObjects())
+    {
+        const PdfDictionary* dict;
+        if (obj->TryGetDictionary(dict) && dict->FindKeyAs<PdfName>("Type") == type)
+            count++;
+    }
+    return count;
+}
+
+static void createImportTestDocument(charbuff& buffer)
+{
+    PdfMemDocument doc;
+    auto image = doc.CreateImage();
+    charbuff rgb(16 * 16 * 3);
+    for (unsigned i = 0; i < rgb.size(); i++)
+        rgb[i] = (char)(i * 7);
+    image->SetData(rgb, 16, 16, PdfPixelFormat::RGB24);
+
+    PdfPainter painter;
+    for (unsigned i = 0; i < ImportPageCount; i++)
+    {
+        auto& page = doc.GetPages().CreatePage(PdfPageSize::A4);
+        page.GetDictionary().AddKey("TestPageNumber", static_cast<int64_t>(i));
+        painter.SetCanvas(page);
+        painter.DrawImage(*image, 50.0, 50.0);
+        painter.FinishDrawing();
+    }
+
+    // Links to a page that will be imported and to one that won't
+    auto dest = doc.CreateDestination();
+    dest->SetDestination(doc.GetPages().GetPageAt(4));
+    doc.GetPages().GetPageAt(3).GetAnnotations().CreateAnnot<PdfAnnotationLink>(
+        Rect(0, 0, 10, 10)).SetDestination(*dest);
+    dest = doc.CreateDestination();
+    dest->SetDestination(doc.GetPages().GetPageAt(19));
+    doc.GetPages().GetPageAt(2).GetAnnotations().CreateAnnot<PdfAnnotationLink>(
+        Rect(0, 0, 10, 10)).SetDestination(*dest);
+
+    BufferStreamDevice device(buffer);
+    doc.Save(device);
+}
+
+TEST_CASE("TestImportPages")
+{
+    charbuff buffer;
+    createImportTestDocument(buffer);
+
+    PdfMemDocument source;
+    source.LoadFromBuffer(buffer);
+    auto& sourceImageDict = source.GetObjects().MustGetObject(source.GetPages().GetPageAt(3).MustGetResources()
+        .GetDictionary().MustFindKey("XObject").GetDictionary().begin()->second.GetReference()).GetDictionary();
+
+    // Only the objects reachable from the pages are copied
+    PdfMemDocument doc;
+    doc.GetPages().AppendDocumentPages(source, 3, 2);
+
+    // The source objects are still valid after their streams are released
+    REQUIRE(sourceImageDict.MustFindKey("Width").GetNumber() == 16);
+    REQUIRE(doc.GetPages().GetCount() == 2);
+    REQUIRE(countObjectsOfType(doc, "Page") == 2);
+    REQUIRE(countObjectsOfType(doc, "XObject") == 1);
+    auto& page3 = doc.GetPages().GetPageAt(0);
+    auto& page4 = doc.GetPages().GetPageAt(1);
+    REQUIRE(page3.GetDictionary().MustFindKey("TestPageNumber").GetNumber() == 3);
+    REQUIRE(page4.GetDictionary().MustFindKey("TestPageNumber").GetNumber() == 4);
+    REQUIRE(page3.GetDictionary().MustGetKey("Parent").GetReference() == doc.GetPages().GetObject().GetIndirectReference());
+
+    // Links between imported pages are preserved
+    auto& link3 = page3.GetAnnotations().GetAnnotAt(0).GetDictionary().MustFindKey("Dest").GetArray();
+    REQUIRE(link3[0].GetReference() == page4.GetObject().GetIndirectReference());
+
+    // Resources already imported from the same document are shared
+    unsigned objectCount = doc.GetObjects().GetSize();
+    doc.GetPages().AppendDocumentPages(source, 10, 1);
+    doc.GetPages().InsertDocumentPageAt(0, source, 2);
+    REQUIRE(doc.GetPages().GetCount() == 4);
+    REQUIRE(countObjectsOfType(doc, "Page") == 4);
+    REQUIRE(countObjectsOfType(doc, "XObject") == 1);
+    REQUIRE(doc.GetObjects().GetSize() < objectCount + 8);
+
+    // Links to pages not imported are removed
+    auto& page2 = doc.GetPages().GetPageAt(0);
+    REQUIRE(page2.GetDictionary().MustFindKey("TestPageNumber").GetNumber() == 2);
+    auto& link2 = page2.GetAnnotations().GetAnnotAt(0).GetDictionary().MustFindKey("Dest").GetArray();
+    REQUIRE(link2[0].IsNull());
+
+    // The imported image is intact
+    charbuff saved;
+    BufferStreamDevice device(saved);
+    doc.Save(device);
+    PdfMemDocument reloaded;
+    reloaded.LoadFromBuffer(saved);
+    REQUIRE(reloaded.GetPages().GetCount() == 4);
+    auto& xobjects = reloaded.GetPages().GetPageAt(3).MustGetResources().GetDictionary().MustFindKey("XObject").GetDictionary();
+    REQUIRE(xobjects.GetSize() == 1);
+    auto& imageObj = reloaded.GetObjects().MustGetObject(xobjects.begin()->second.GetReference());
+    auto& sourceImageObj = source.GetObjects().MustGetObject(source.GetPages().GetPageAt(0).MustGetResources()
+        .GetDictionary().MustFindKey("XObject").GetDictionary().begin()->second.GetReference());
+    REQUIRE(imageObj.MustGetStream().GetCopy() == sourceImageObj.MustGetStream().GetCopy());
+}
+
+TEST_CASE("TestImportPagesEncrypted")
+{
+    charbuff buffer;
+    {
+        charbuff clearText;
+        createImportTestDocument(clearText);
+        PdfMemDocument doc;
+        doc.LoadFromBuffer(clearText);
+        doc.SetEncrypted("userpass", "ownerpass", PdfPermissions::Default,
+            PdfEncryptionAlgorithm::AESV2);
+        BufferStreamDevice device(buffer);
+        doc.Save(device);
+    }
+
+    charbuff sourceContents;
+    {
+        PdfMemDocument reference;
+        reference.LoadFromBuffer(buffer, "userpass");
+        reference.GetPages().GetPageAt(0).GetContents()->CopyTo(sourceContents);
+    }
+
+    PdfMemDocument source;
+    source.LoadFromBuffer(buffer, "userpass");
+
+    // Streams released after the first import are decrypted again
+    for (unsigned i = 0; i < 2; i++)
+    {
+        PdfMemDocument doc;
+        doc.GetPages().AppendDocumentPages(source, 0, 1);
+        charbuff contents;
+        doc.GetPages().GetPageAt(0).GetContents()->CopyTo(contents);
+        REQUIRE(contents == sourceContents);
+    }
+
+    charbuff contents;
+    source.GetPages().GetPageAt(0).GetContents()->CopyTo(contents);
+    REQUIRE(contents == sourceContents);
+}
+
+TEST_CASE("TestImportPagesSameDocument")
+{
+    PdfMemDocument doc;
+    auto& page = doc.GetPages().CreatePage(PdfPageSize::A4);
+    auto& text = page.GetAnnotations().CreateAnnot<PdfAnnotationText>(Rect(0, 0, 10, 10));
+    auto& popup = page.GetAnnotations().CreateAnnot<PdfAnnotationPopup>(Rect(0, 0, 10, 10));
+    text.GetDictionary().AddKey("Popup", popup.GetObject().GetIndirectReference());
+    popup.GetDictionary().AddKey("Parent", text.GetObject().GetIndirectReference());
+
+    // A field with a widget on the page
+    auto& field = doc.GetObjects().CreateDictionaryObject();
+    field.GetDictionary().AddKey("FT", PdfName("Btn"));
+    field.GetDictionary().AddKey("T", PdfString("Check"));
+    auto& widget = doc.GetObjects().CreateDictionaryObject("Annot", "Widget");
+    widget.GetDictionary().AddKey("Parent", field.GetIndirectReference());
+    widget.GetDictionary().AddKey("P", page.GetObject().GetIndirectReference());
+    PdfArray kids;
+    kids.Add(widget.GetIndirectReference());
+    field.GetDictionary().AddKey("Kids", kids);
+    page.GetDictionary().MustFindKey("Annots").GetArray().Add(widget.GetIndirectReference());
+
+    doc.GetPages().AppendDocumentPages(doc);
+    REQUIRE(doc.GetPages().GetCount() == 2);
+    auto& copy = doc.GetPages().GetPageAt(1);
+    auto& annots = page.GetDictionary().MustFindKey("Annots").GetArray();
+    auto& copyAnnots = copy.GetDictionary().MustFindKey("Annots").GetArray();
+    REQUIRE(copyAnnots.GetSize() == 3);
+
+    // The copy has its own annotations, linked to each other
+    vector<const PdfDictionary*> copyDicts;
+    for (unsigned i = 0; i < 3; i++)
+    {
+        REQUIRE(copyAnnots[i].GetReference() != annots[i].GetReference());
+        auto& dict = doc.GetObjects().MustGetObject(copyAnnots[i].GetReference()).GetDictionary();
+        REQUIRE(dict.MustGetKey("P").GetReference() == copy.GetObject().GetIndirectReference());
+        copyDicts.push_back(&dict);
+    }
+    REQUIRE(copyDicts[0]->MustGetKey("Popup").GetReference() == copyAnnots[1].GetReference());
+    REQUIRE(copyDicts[1]->MustGetKey("Parent").GetReference() == copyAnnots[0].GetReference());
+    REQUIRE(text.GetDictionary().MustGetKey("Popup").GetReference() == popup.GetObject().GetIndirectReference());
+    REQUIRE(widget.GetDictionary().MustGetKey("P").GetReference() == page.GetObject().GetIndirectReference());
+
+    // The widget copy is a new kid of the same field
+    REQUIRE(copyDicts[2]->MustGetKey("Parent").GetReference() == field.GetIndirectReference());
+    auto& fieldKids = field.GetDictionary().MustFindKey("Kids").GetArray();
+    REQUIRE(fieldKids.GetSize() == 2);
+    REQUIRE(fieldKids[1].GetReference() == copyAnnots[2].GetReference());
+}
+
+TEST_CASE("TestMovePage")
+{
+    PdfMemDocument doc;
+    for (unsigned i = 0; i < 4; i++)
+        doc.GetPages().CreatePage(PdfPageSize::A4).GetDictionary().AddKey("TestPageNumber", static_cast<int64_t>(i));
+
+    auto& page = doc.GetPages().GetPageAt(1);
+    auto& field = page.CreateField<PdfCheckBox>("Check", Rect(0, 0, 10, 10));
+    auto& widget = field.MustGetWidget();
+
+    // The page is moved, not copied, so its widgets stay the same
+    page.MoveAt(3);
+    REQUIRE(doc.GetPages().GetCount() == 4);
+    REQUIRE(&doc.GetPages().GetPageAt(2) == &page);
+    REQUIRE(page.GetIndex() == 2);
+    REQUIRE(countObjectsOfType(doc, "Page") == 4);
+    REQUIRE(widget.GetDictionary().MustGetKey("P").GetReference() == page.GetObject().GetIndirectReference());
+    REQUIRE(page.GetDictionary().MustFindKey("Annots").GetArray().GetSize() == 1);
+
+    page.MoveAt(0);
+    for (unsigned i = 0; i < 4; i++)
+    {
+        static const int64_t expected[] = { 1, 0, 2, 3 };
+        REQUIRE(doc.GetPages().GetPageAt(i).GetDictionary().MustFindKey("TestPageNumber").GetNumber() == expected[i]);
+    }
+}
+
+TEST_CASE("TestImportPagesStreamed")
+{
+    charbuff buffer;
+    createImportTestDocument(buffer);
+
+    // Merge some copies of the document, with the output
+    // written while the pages are imported
+    charbuff output;
+    {
+        PdfStreamedDocument doc(std::make_shared<BufferStreamDevice>(output));
+        for (unsigned i = 0; i < 3; i++)
+        {
+            PdfMemDocument source;
+            source.LoadFromBuffer(buffer);
+            doc.GetPages().AppendDocumentPages(source);
+        }
+    }
+
+    PdfMemDocument source;
+    source.LoadFromBuffer(buffer);
+    PdfMemDocument merged;
+    merged.LoadFromBuffer(output);
+    REQUIRE(merged.GetPages().GetCount() == 3 * ImportPageCount);
+    REQUIRE(countObjectsOfType(merged, "XObject") == 3);
+    for (unsigned i = 0; i < merged.GetPages().GetCount(); i++)
+    {
+        auto& page = merged.GetPages().GetPageAt(i);
+        auto& sourcePage = source.GetPages().GetPageAt(i % ImportPageCount);
+        REQUIRE(page.GetDictionary().MustFindKey("TestPageNumber").GetNumber() == static_cast<int64_t>(i % ImportPageCount));
+
+        charbuff contents;
+        charbuff sourceContents;
+        page.GetContents()->CopyTo(contents);
+        sourcePage.GetContents()->CopyTo(sourceContents);
+        REQUIRE(contents == sourceContents);
+    }
+}
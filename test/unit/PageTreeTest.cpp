@@ -26,6 +26,8 @@ using namespace PoDoFo;
 
 static void appendChildNode(PdfObject& parent, PdfObject& child);
 static bool isPageNumber(PdfPage& page, unsigned number);
+static unsigned checkPageTreeNode(const PdfObject& node, unsigned maxKids, vector<int64_t>& numbers);
+static void checkPageTree(PdfMemDocument& doc, unsigned maxKids, const vector<int64_t>& expected);
 
 static vector<PdfObject*> createNodes(PdfMemDocument& doc, unsigned nodeCount);
 static void createEmptyKidsTree(PdfMemDocument& doc);
@@ -188,6 +190,188 @@ TEST_CASE("testDeleteAll")
     testDeleteAll(doc);
 }
 
+TEST_CASE("testLazyPageTree")
+{
+    auto doc = PdfPageTest::CreateTestTreeCustom();
+
+    // Break a page in the last subtree: pages in the other
+    // subtrees are accessed without loading it
+    auto& rootKids = doc.GetPages().GetDictionary().MustFindKey("Kids").GetArray();
+    auto& lastNode = doc.GetObjects().MustGetObject(rootKids[9].GetReference());
+    auto& brokenPage = doc.GetObjects().MustGetObject(
+        lastNode.GetDictionary().MustFindKey("Kids").GetArray()[5].GetReference());
+    brokenPage.GetDictionary().AddKey("Type", PdfName("Invalid"));
+
+    REQUIRE(doc.GetPages().GetCount() == TEST_NUM_PAGES);
+    auto& page = doc.GetPages().GetPageAt(57);
+    REQUIRE(isPageNumber(page, 57));
+    REQUIRE(page.GetIndex() == 57);
+    REQUIRE(isPageNumber(doc.GetPages().GetPageAt(0), 0));
+    REQUIRE(isPageNumber(doc.GetPages().GetPageAt(89), 89));
+
+    auto& pageRef = doc.GetPages().GetPage(doc.GetPages().GetPageAt(23).GetObject().GetIndirectReference());
+    REQUIRE(&pageRef == &doc.GetPages().GetPageAt(23));
+    REQUIRE(isPageNumber(pageRef, 23));
+
+    // Reaching the broken subtree loads the whole tree, which fails
+    ASSERT_THROW_WITH_ERROR_CODE(doc.GetPages().GetPageAt(95), PdfErrorCode::BrokenFile);
+    REQUIRE(&doc.GetPages().GetPageAt(57) == &page);
+}
+
+TEST_CASE("testLazyPageTreeFullLoad")
+{
+    auto doc = PdfPageTest::CreateTestTreeCustom();
+
+    // Inconsistent intermediate /Count values, with the
+    // root /Count still matching the sum of the kids
+    auto& rootKids = doc.GetPages().GetDictionary().MustFindKey("Kids").GetArray();
+    doc.GetObjects().MustGetObject(rootKids[3].GetReference())
+        .GetDictionary().AddKey("Count", static_cast<int64_t>(5));
+    doc.GetObjects().MustGetObject(rootKids[4].GetReference())
+        .GetDictionary().AddKey("Count", static_cast<int64_t>(15));
+
+    auto& page = doc.GetPages().GetPageAt(12);
+    REQUIRE(isPageNumber(page, 12));
+
+    // Pages are found anyway with a full traversal
+    REQUIRE(isPageNumber(doc.GetPages().GetPageAt(37), 37));
+
+    // Pages loaded before the full traversal are preserved
+    unsigned index = 0;
+    for (auto iterPage : doc.GetPages())
+    {
+        REQUIRE(isPageNumber(*iterPage, index));
+        REQUIRE(iterPage->GetIndex() == index);
+        if (index == 12)
+            REQUIRE(iterPage == &page);
+        index++;
+    }
+    REQUIRE(index == TEST_NUM_PAGES);
+}
+
+TEST_CASE("testLazyPageTreeOrphanedPage")
+{
+    auto doc = PdfPageTest::CreateTestTreeCustom();
+    auto& page = doc.GetPages().GetPageAt(12);
+    REQUIRE(isPageNumber(page, 12));
+
+    // Replace the page already loaded with a new one
+    auto& rootKids = doc.GetPages().GetDictionary().MustFindKey("Kids").GetArray();
+    auto& node = doc.GetObjects().MustGetObject(rootKids[1].GetReference());
+    auto& newPage = doc.GetObjects().CreateDictionaryObject("Page");
+    newPage.GetDictionary().AddKey("Parent", node.GetIndirectReference());
+    newPage.GetDictionary().AddKey(TEST_PAGE_KEY, static_cast<int64_t>(1000));
+    node.GetDictionary().MustFindKey("Kids").GetArray()[2] = newPage.GetIndirectReference();
+
+    // The full traversal doesn't find the page, which
+    // is nevertheless kept alive with the collection
+    REQUIRE(doc.GetPages().GetCount() == TEST_NUM_PAGES);
+    for (auto iterPage : doc.GetPages())
+        REQUIRE(iterPage != &page);
+
+    REQUIRE(isPageNumber(doc.GetPages().GetPageAt(12), 1000));
+    REQUIRE(isPageNumber(page, 12));
+}
+
+TEST_CASE("testBalancedPageTree")
+{
+    constexpr unsigned PageCount = 1000;
+    constexpr unsigned MaxKids = 8;
+
+    PdfMemDocument doc;
+    auto& pages = doc.GetPages();
+    vector<int64_t> expected;
+    pages.CreatePagesAt(0, PageCount, PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+    for (unsigned i = 0; i < PageCount; i++)
+    {
+        pages.GetPageAt(i).GetDictionary().AddKey(TEST_PAGE_KEY, static_cast<int64_t>(i));
+        expected.push_back(i);
+    }
+
+    REQUIRE_THROWS_AS(pages.BalanceStructure(1), PdfError);
+    pages.BalanceStructure(MaxKids);
+    REQUIRE(pages.GetMaxKids() == MaxKids);
+    checkPageTree(doc, MaxKids, expected);
+
+    // Bulk insertion in the middle
+    pages.CreatePagesAt(500, 50, PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+    for (unsigned i = 0; i < 50; i++)
+    {
+        pages.GetPageAt(500 + i).GetDictionary().AddKey(TEST_PAGE_KEY, static_cast<int64_t>(PageCount + i));
+        expected.insert(expected.begin() + 500 + i, PageCount + i);
+    }
+    checkPageTree(doc, MaxKids, expected);
+
+    // Single insertions at the start and at the end
+    pages.CreatePageAt(0, PdfPage::CreateStandardPageSize(PdfPageSize::A4))
+        .GetDictionary().AddKey(TEST_PAGE_KEY, static_cast<int64_t>(2000));
+    expected.insert(expected.begin(), 2000);
+    pages.CreatePage(PdfPage::CreateStandardPageSize(PdfPageSize::A4))
+        .GetDictionary().AddKey(TEST_PAGE_KEY, static_cast<int64_t>(2001));
+    expected.push_back(2001);
+    checkPageTree(doc, MaxKids, expected);
+
+    // Removals, emptying some nodes
+    for (unsigned i = 0; i < 300; i++)
+    {
+        pages.RemovePageAt(100);
+        expected.erase(expected.begin() + 100);
+    }
+    checkPageTree(doc, MaxKids, expected);
+
+    // The balanced tree is preserved on save
+    charbuff buffer;
+    BufferStreamDevice device(buffer);
+    doc.Save(device, PdfSaveOptions::BalancePageTree);
+
+    PdfMemDocument loaded;
+    loaded.LoadFromBuffer(buffer);
+    checkPageTree(loaded, MaxKids, expected);
+
+    // Flattening returns to a single node
+    loaded.GetPages().FlattenStructure();
+    REQUIRE(loaded.GetPages().GetMaxKids() == 0);
+    checkPageTree(loaded, numeric_limits<unsigned>::max(), expected);
+}
+
+TEST_CASE("testBalancePageTreeOnSave")
+{
+    PdfMemDocument doc;
+    createTestTree(doc);
+    auto& pages = doc.GetPages();
+    REQUIRE(pages.GetMaxKids() == 0);
+    REQUIRE(pages.GetDictionary().MustFindKey("Kids").GetArray().GetSize() == TEST_NUM_PAGES);
+
+    charbuff flatBuffer;
+    BufferStreamDevice flatDevice(flatBuffer);
+    doc.Save(flatDevice);
+
+    charbuff buffer;
+    BufferStreamDevice device(buffer);
+    doc.Save(device, PdfSaveOptions::BalancePageTree);
+
+    vector<int64_t> expected;
+    for (unsigned i = 0; i < TEST_NUM_PAGES; i++)
+        expected.push_back(i);
+
+    PdfMemDocument loaded;
+    loaded.LoadFromBuffer(buffer);
+    checkPageTree(loaded, PdfPageCollection::DefaultMaxKids, expected);
+    for (unsigned i = 0; i < TEST_NUM_PAGES; i++)
+        REQUIRE(isPageNumber(loaded.GetPages().GetPageAt(i), i));
+
+    // A loaded tree not modified is written as is
+    PdfMemDocument flat;
+    flat.LoadFromBuffer(flatBuffer);
+    charbuff updateBuffer;
+    BufferStreamDevice updateDevice(updateBuffer);
+    flat.Save(updateDevice, PdfSaveOptions::BalancePageTree);
+    REQUIRE(flat.GetPages().GetMaxKids() == 0);
+    PdfMemDocument reloaded;
+    reloaded.LoadFromBuffer(updateBuffer);
+    REQUIRE(reloaded.GetPages().GetDictionary().MustFindKey("Kids").GetArray().GetSize() == TEST_NUM_PAGES);
+}
+
 void testGetPages(PdfMemDocument& doc)
 {
     for (unsigned i = 0; i < TEST_NUM_PAGES; i++)
@@ -319,11 +503,13 @@ PdfMemDocument PdfPageTest::CreateTestTreeCustom()
             page->GetDictionary().AddKey(TEST_PAGE_KEY,
                 static_cast<int64_t>(i) * COUNT + j);
 
+            page->GetDictionary().AddKey("Parent", node.GetIndirectReference());
             nodeKids.Add(page->GetObject().GetIndirectReference());
         }
 
         node.GetDictionary().AddKey("Kids", nodeKids);
         node.GetDictionary().AddKey("Count", static_cast<int64_t>(COUNT));
+        node.GetDictionary().AddKey("Parent", root.GetIndirectReference());
         rootKids.Add(node.GetIndirectReference());
     }
 
@@ -513,3 +699,38 @@ void appendChildNode(PdfObject& parent, PdfObject& child)
     // 3. Add Parent key to the child
     child.GetDictionary().AddKey("Parent", parent.GetIndirectReference());
 }
+
+unsigned checkPageTreeNode(const PdfObject& node, unsigned maxKids, vector<int64_t>& numbers)
+{
+    auto& kids = node.GetDictionary().MustFindKey("Kids").GetArray();
+    REQUIRE(kids.GetSize() <= maxKids);
+    unsigned count = 0;
+    for (unsigned i = 0; i < kids.GetSize(); i++)
+    {
+        auto& kid = kids.MustFindAt(i);
+        REQUIRE(kid.GetDictionary().MustFindKey("Parent").GetIndirectReference() == node.GetIndirectReference());
+        if (kid.GetDictionary().MustFindKey("Type").GetName() == "Pages")
+        {
+            count += checkPageTreeNode(kid, maxKids, numbers);
+        }
+        else
+        {
+            numbers.push_back(kid.GetDictionary().MustFindKey(TEST_PAGE_KEY).GetNumber());
+            count++;
+        }
+    }
+
+    REQUIRE(node.GetDictionary().MustFindKey("Count").GetNumber() == static_cast<int64_t>(count));
+    return count;
+}
+
+void checkPageTree(PdfMemDocument& doc, unsigned maxKids, const vector<int64_t>& expected)
+{
+    vector<int64_t> numbers;
+    auto& pages = doc.GetPages();
+    REQUIRE(checkPageTreeNode(pages.GetObject(), maxKids, numbers) == expected.size());
+    REQUIRE(numbers == expected);
+    REQUIRE(pages.GetCount() == expected.size());
+    for (unsigned i = 0; i < pages.GetCount(); i++)
+        REQUIRE(pages.GetPageAt(i).GetIndex() == i);
+}
@@ -148,7 +148,7 @@ S
 172.075 503.93 l
 S
 Q
-<0001020203040503060207> Tj
+<0203040405010605070408> Tj
 ET
 Q
 )"sv;
@@ -45,3 +45,184 @@ TEST_CASE("TextExtraction2")
     ASSERT_EQUAL(entries[0].X, 31.199999999999999);
     ASSERT_EQUAL(entries[0].Y, 801.60000000000002);
 }
+
+TEST_CASE("TextExtractionParallel")
+{
+    charbuff buffer;
+    {
+        PdfMemDocument doc;
+        auto& font = doc.GetFonts().GetStandard14Font(PdfStandard14FontType::Helvetica);
+        for (unsigned i = 0; i < 20; i++)
+        {
+            auto& page = doc.GetPages().CreatePage(PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+            PdfPainter painter;
+            painter.SetCanvas(page);
+            painter.TextState.SetFont(font, 12);
+            painter.DrawText(utls::Format("Page {}", i + 1), 100, 500);
+            painter.FinishDrawing();
+        }
+
+        BufferStreamDevice device(buffer);
+        doc.Save(device);
+    }
+
+    PdfMemDocument doc;
+    doc.LoadFromBuffer(buffer);
+    vector<vector<PdfTextEntry>> entries;
+    doc.ExtractTextTo(entries, { }, 4);
+    REQUIRE(entries.size() == 20);
+    for (unsigned i = 0; i < 20; i++)
+    {
+        vector<PdfTextEntry> pageEntries;
+        doc.GetPages().GetPageAt(i).ExtractTextTo(pageEntries);
+        REQUIRE(entries[i].size() == 1);
+        REQUIRE(entries[i][0].Text == pageEntries[0].Text);
+        REQUIRE(entries[i][0].Page == (int)i);
+    }
+
+    // NOTE: The callback may be called from other threads
+    vector<pair<unsigned, string>> texts;
+    doc.ExtractText([&texts](unsigned pageIndex, vector<PdfTextEntry>& pageEntries) {
+        texts.push_back({ pageIndex, pageEntries.size() == 0 ? string() : pageEntries[0].Text });
+    });
+    REQUIRE(texts.size() == 20);
+    for (unsigned i = 0; i < 20; i++)
+    {
+        REQUIRE(texts[i].first == i);
+        REQUIRE(texts[i].second == utls::Format("Page {}", i + 1));
+    }
+}
+
+TEST_CASE("TextExtractionParallelSharedForm")
+{
+    // A single form XObject drawn on all the pages, so
+    // its stream and font are shared between the workers
+    charbuff buffer;
+    {
+        PdfMemDocument doc;
+        auto& font = doc.GetFonts().GetStandard14Font(PdfStandard14FontType::Helvetica);
+        auto form = doc.CreateXObjectForm(Rect(0, 0, 200, 50));
+        PdfPainter painter;
+        painter.SetCanvas(*form);
+        painter.TextState.SetFont(font, 12);
+        painter.DrawText("Shared form", 10, 20);
+        painter.FinishDrawing();
+        for (unsigned i = 0; i < 20; i++)
+        {
+            auto& page = doc.GetPages().CreatePage(PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+            painter.SetCanvas(page);
+            painter.DrawXObject(*form, 100, 500);
+            painter.FinishDrawing();
+        }
+
+        BufferStreamDevice device(buffer);
+        doc.Save(device);
+    }
+
+    PdfMemDocument doc;
+    doc.LoadFromBuffer(buffer);
+    vector<vector<PdfTextEntry>> entries;
+    doc.ExtractTextTo(entries, { }, 4);
+    REQUIRE(entries.size() == 20);
+    for (unsigned i = 0; i < 20; i++)
+    {
+        REQUIRE(entries[i].size() == 1);
+        REQUIRE(entries[i][0].Text == "Shared form");
+        ASSERT_EQUAL(entries[i][0].X, 110);
+        ASSERT_EQUAL(entries[i][0].Y, 520);
+    }
+
+    // Reuse the form contents cache as well
+    PdfContentStreamCache cache;
+    PdfTextExtractParams params;
+    params.Cache = &cache;
+    doc.ExtractTextTo(entries, params, 4);
+    REQUIRE(entries.size() == 20);
+    for (unsigned i = 0; i < 20; i++)
+    {
+        REQUIRE(entries[i].size() == 1);
+        REQUIRE(entries[i][0].Text == "Shared form");
+    }
+}
+
+TEST_CASE("TextExtractionSearchPattern")
+{
+    size_t pos;
+    PdfTextSearchPattern literal("World", PdfTextExtractFlags::IgnoreCase);
+    REQUIRE(literal.TryFind("hello WORLD", pos));
+    REQUIRE(pos == 6);
+    REQUIRE(!literal.TryFind("hello word", pos));
+    REQUIRE(pos == string_view::npos);
+
+    PdfTextSearchPattern wholeWord("foo", PdfTextExtractFlags::MatchWholeWord);
+    REQUIRE(wholeWord.TryFind("foobar foo", pos));
+    REQUIRE(pos == 7);
+    REQUIRE(!wholeWord.TryFind("foobar", pos));
+    REQUIRE(wholeWord.IsMatch("foo"));
+    REQUIRE(!wholeWord.IsMatch("foo bar"));
+
+    PdfTextSearchPattern regex("Pa.e [0-9]+", PdfTextExtractFlags::RegexPattern);
+    REQUIRE(regex.IsMatch("The Page 12"));
+    REQUIRE(!regex.IsMatch("page 12"));
+    size_t length;
+    REQUIRE(regex.TryFind("The Page 12 of 20", pos, length));
+    REQUIRE(pos == 4);
+    REQUIRE(length == 7);
+    ASSERT_THROW_WITH_ERROR_CODE(PdfTextSearchPattern("foo",
+        PdfTextExtractFlags::RegexPattern | PdfTextExtractFlags::MatchWholeWord), PdfErrorCode::NotImplemented);
+
+    charbuff buffer;
+    {
+        PdfMemDocument doc;
+        auto& font = doc.GetFonts().GetStandard14Font(PdfStandard14FontType::Helvetica);
+        for (unsigned i = 0; i < 3; i++)
+        {
+            auto& page = doc.GetPages().CreatePage(PdfPage::CreateStandardPageSize(PdfPageSize::A4));
+            PdfPainter painter;
+            painter.SetCanvas(page);
+            painter.TextState.SetFont(font, 12);
+            painter.DrawText(utls::Format("Page {}", i + 1), 100, 500);
+            painter.DrawText("Other text", 100, 300);
+            painter.FinishDrawing();
+        }
+
+        BufferStreamDevice device(buffer);
+        doc.Save(device);
+    }
+
+    PdfMemDocument doc;
+    doc.LoadFromBuffer(buffer);
+
+    // The same compiled pattern is reused across all the pages
+    PdfTextSearchPattern pattern("page [23]", PdfTextExtractFlags::RegexPattern | PdfTextExtractFlags::IgnoreCase);
+    PdfTextExtractParams params;
+    params.Pattern = &pattern;
+    vector<vector<PdfTextEntry>> entries;
+    doc.ExtractTextTo(entries, params);
+    REQUIRE(entries.size() == 3);
+    REQUIRE(entries[0].size() == 0);
+    REQUIRE(entries[1].size() == 1);
+    REQUIRE(entries[1][0].Text == "Page 2");
+    REQUIRE(entries[2].size() == 1);
+    REQUIRE(entries[2][0].Text == "Page 3");
+
+    // A string pattern overrides the compiled one
+    vector<PdfTextEntry> pageEntries;
+    doc.GetPages().GetPageAt(0).ExtractTextTo(pageEntries, "Other", params);
+    REQUIRE(pageEntries.size() == 1);
+    REQUIRE(pageEntries[0].Text == "Other text");
+
+    // The extracted substring has the length of the regex
+    // match, which differs from the length of the regex
+    PdfTextSearchPattern substringPattern("g. [23]", PdfTextExtractFlags::RegexPattern);
+    params.Pattern = &substringPattern;
+    params.Flags = PdfTextExtractFlags::ExtractSubstring;
+    doc.ExtractTextTo(entries, params);
+    REQUIRE(entries.size() == 3);
+    REQUIRE(entries[0].size() == 0);
+    REQUIRE(entries[1].size() == 1);
+    REQUIRE(entries[1][0].Text == "ge 2");
+    REQUIRE(entries[1][0].X > 100);
+    REQUIRE(entries[2].size() == 1);
+    REQUIRE(entries[2][0].Text == "ge 3");
+}
@@ -6,9 +6,12 @@
 #include <podofo/private/PdfDeclarationsPrivate.h>
 #include "ImageExtractor.h"
 
+#include <podofo/private/ParallelUtils.h>
+
 #include <sys/stat.h>
 #include <cstdlib>
 #include <cstdio>
+#include <unordered_set>
 
 #ifdef _MSC_VER
 #define snprintf _snprintf
@@ -17,90 +20,147 @@
 using namespace std;
 using namespace PoDoFo;
 
+static void resolveReferences(const PdfObject* obj, unordered_set<const PdfObject*>& visited);
+
 ImageExtractor::ImageExtractor()
     : m_ImageCount(0), m_fileCounter(0), m_buffer{}
 {
 }
 
-void ImageExtractor::Init(const string_view& input, const string_view& output)
+void ImageExtractor::Init(const string_view& input, const string_view& output,
+    unsigned threadCount)
 {
+    // NOTE: PdfMemDocument loads the objects on demand, so
+    // the image streams are read only when extracted
     PdfMemDocument document;
     document.Load(input);
 
     m_outputDirectory = output;
 
+    vector<ImageJob> jobs;
+    CollectImages(document, jobs);
+    if (jobs.size() == 0)
+        return;
+
+    // Images are fetched dynamically by the workers. The
+    // mutex serializes the accesses to the document
+    std::mutex mutex;
+    utls::RunParallel((unsigned)jobs.size(), threadCount, [&](unsigned jobIndex, unsigned workerIndex) {
+        (void)workerIndex;
+        ExtractImage(document, jobs[jobIndex], mutex);
+    });
+}
+
+void ImageExtractor::CollectImages(PdfMemDocument& document, vector<ImageJob>& jobs)
+{
     for (auto obj : document.GetObjects())
     {
-        if (obj->IsDictionary())
+        if (!obj->IsDictionary())
+            continue;
+
+        auto& dict = obj->GetDictionary();
+        const PdfName* subtype;
+        if (!dict.TryFindKeyAs(PdfNames::Subtype, subtype) || *subtype != "Image"
+            || !obj->HasStream())
+        {
+            continue;
+        }
+
+        ImageFormat format = ImageFormat::PPM;
+        auto filter = dict.FindKey(PdfNames::Filter);
+        if (filter != nullptr && filter->IsArray() && filter->GetArray().GetSize() != 0)
+            filter = &filter->GetArray()[filter->GetArray().GetSize() - 1];
+
+        // A JPEG or JPEG2000 filter is always the last one in the
+        // chain: it's extracted as is, after unwrapping the others
+        const PdfName* filterName;
+        if (filter != nullptr && filter->TryGetName(filterName))
         {
-            PdfObject* typeObj = obj->GetDictionary().GetKey(PdfNames::Type);
-            PdfObject* subtypeObj = obj->GetDictionary().GetKey(PdfNames::Subtype);
-            if ((typeObj && typeObj->IsName() && (typeObj->GetName() == "XObject")) ||
-                (subtypeObj && subtypeObj->IsName() && (subtypeObj->GetName() == "Image")))
-            {
-                auto filter = obj->GetDictionary().GetKey(PdfNames::Filter);
-                if (filter != nullptr && filter->IsArray() && filter->GetArray().GetSize() == 1 &&
-                    filter->GetArray()[0].IsName() && (filter->GetArray()[0].GetName() == "DCTDecode"))
-                    filter = &filter->GetArray()[0];
-
-                if (filter && filter->IsName() && (filter->GetName() == "DCTDecode"))
-                {
-                    // The only filter is JPEG -> create a JPEG file
-                    ExtractImage(*obj, true);
-                }
-                else
-                {
-                    ExtractImage(*obj, false);
-                }
-            }
+            if (*filterName == "DCTDecode")
+                format = ImageFormat::JPEG;
+            else if (*filterName == "JPXDecode")
+                format = ImageFormat::JPEG2000;
         }
+
+        const char* extension;
+        switch (format)
+        {
+            case ImageFormat::JPEG:
+                extension = "jpg";
+                break;
+            case ImageFormat::JPEG2000:
+                extension = "jp2";
+                break;
+            default:
+                extension = "ppm";
+                break;
+        }
+
+        // Do not overwrite existing files:
+        do
+        {
+            snprintf(m_buffer, MAX_PATH, "%s/pdfimage_%04i.%s", m_outputDirectory.data(), m_fileCounter++, extension);
+        }
+        while (FileExists(m_buffer));
+
+        jobs.push_back({ obj, format, m_buffer });
     }
 }
 
-void ImageExtractor::ExtractImage(const PdfObject& obj, bool jpeg)
+void ImageExtractor::ExtractImage(PdfMemDocument& document, const ImageJob& job, mutex& mutex)
 {
-    FILE* file = nullptr;
-    const char* extension = jpeg ? "jpg" : "ppm";
-
-    // Do not overwrite existing files:
-    do
+    auto& obj = *job.Object;
+    const PdfObjectStream* stream;
+    unsigned width = 0;
+    unsigned height = 0;
     {
-        snprintf(m_buffer, MAX_PATH, "%s/pdfimage_%04i.%s", m_outputDirectory.data(), m_fileCounter++, extension);
-    }
-    while (FileExists(m_buffer));
+        // Loading objects is not thread safe, so the stream
+        // is read from the source device serially
+        std::lock_guard<std::mutex> lock(mutex);
+        stream = obj.GetStream();
+
+        // Resolve the stream /Length, /Filter and /DecodeParms, including
+        // the nested indirect objects, like the /JBIG2Globals streams,
+        // since they would be otherwise loaded when decoding the stream
+        unordered_set<const PdfObject*> visited;
+        auto& dict = obj.GetDictionary();
+        resolveReferences(dict.FindKey(PdfNames::Length), visited);
+        resolveReferences(dict.FindKey(PdfNames::Filter), visited);
+        resolveReferences(dict.FindKey("DecodeParms"), visited);
+        if (job.Format == ImageFormat::PPM)
+        {
+            width = (unsigned)obj.GetDictionary().MustFindKey("Width").GetNumber();
+            height = (unsigned)obj.GetDictionary().MustFindKey("Height").GetNumber();
+        }
 
-    file = fopen(m_buffer, "wb");
-    if (file == nullptr)
-    {
-        PODOFO_RAISE_ERROR(PdfErrorCode::InvalidHandle);
+        printf("-> Writing image object %s to the file: %s\n", obj.GetIndirectReference().ToString().data(), job.Filepath.data());
     }
 
-    printf("-> Writing image object %s to the file: %s\n", obj.GetIndirectReference().ToString().data(), m_buffer);
-
-    if (jpeg)
-    {
-        auto& memprovider = dynamic_cast<const PdfMemoryObjectStream&>(obj.GetStream()->GetProvider());
-        auto& buffer = memprovider.GetBuffer();
-        fwrite(buffer.data(), buffer.size(), sizeof(char), file);
-    }
-    else
     {
-        //long lBitsPerComponent = pObject->GetDictionary().GetKey( PdfName("BitsPerComponent" ) )->GetNumber();
-        // TODO: Handle colorspaces
-
-        // Create a ppm image
-        const char* ppmHeader = "P6\n# Image extracted by PoDoFo\n%u %u\n%li\n";
+        FileStreamDevice file(job.Filepath, FileMode::Create);
+        if (job.Format == ImageFormat::PPM)
+        {
+            // TODO: Handle colorspaces
+            // Create a ppm image
+            char header[128];
+            int length = snprintf(header, std::size(header), "P6\n# Image extracted by PoDoFo\n%u %u\n%i\n",
+                width, height, 255);
+            file.Write(header, (size_t)length);
+        }
 
-        fprintf(file, ppmHeader,
-            (unsigned)obj.GetDictionary().MustFindKey("Width").GetNumber(),
-            (unsigned)obj.GetDictionary().MustFindKey("Height").GetNumber(),
-            255);
+        // Unwrap the non media filters and write the data
+        // straight to the file, without intermediate copies
+        auto input = stream->GetInputStream();
+        input.CopyTo(file);
+        file.Flush();
+    }
 
-        auto buffer = obj.GetStream()->GetCopy();
-        fwrite(buffer.data(), buffer.size(), sizeof(char), file);
+    {
+        // Release the stream memory, the object is not needed anymore
+        std::lock_guard<std::mutex> lock(mutex);
+        document.FreeObjectMemory(&obj);
     }
 
-    fclose(file);
     m_ImageCount++;
 }
 
@@ -115,3 +175,26 @@ bool ImageExtractor::FileExists(const string_view& filepath)
 
     return result;
 }
+
+void resolveReferences(const PdfObject* obj, unordered_set<const PdfObject*>& visited)
+{
+    if (obj == nullptr || !visited.insert(obj).second)
+        return;
+
+    // NOTE: Accessing the stream also forces
+    // loading the object, if it was delayed
+    (void)obj->GetStream();
+
+    const PdfDictionary* dict;
+    const PdfArray* arr;
+    if (obj->TryGetDictionary(dict))
+    {
+        for (auto pair : dict->GetIndirectIterator())
+            resolveReferences(pair.second, visited);
+    }
+    else if (obj->TryGetArray(arr))
+    {
+        for (auto child : arr->GetIndirectIterator())
+            resolveReferences(child, visited);
+    }
+}
@@ -6,6 +6,9 @@
 #ifndef IMAGE_EXTRACTOR_H
 #define IMAGE_EXTRACTOR_H
 
+#include <atomic>
+#include <mutex>
+
 #include <podofo/podofo.h>
 
 /** This class uses the PoDoFo lib to parse
@@ -20,11 +23,13 @@ public:
     ImageExtractor();
 
     /**
-     * \param pnNum pointer to an integer were
-     *        the number of processed images can be stored
-     *        or null if you do not want this information.
+     * \param input the input PDF file
+     * \param output the output directory
+     * \param threadCount the number of threads used to decode
+     *        and write the images. 0 means the number of hardware threads
      */
-    void Init(const std::string_view& input, const std::string_view& output);
+    void Init(const std::string_view& input, const std::string_view& output,
+        unsigned threadCount = 1);
 
     /**
      * \returns the number of successfully extracted images
@@ -32,13 +37,35 @@ public:
     inline unsigned GetNumImagesExtracted() const;
 
 private:
+    enum class ImageFormat
+    {
+        PPM,
+        JPEG,
+        JPEG2000,
+    };
+
+    struct ImageJob
+    {
+        PoDoFo::PdfObject* Object;
+        ImageFormat Format;
+        std::string Filepath;
+    };
+
+    /** Collects the image XObjects of the document. Only the
+     *  object dictionaries are loaded, the streams are left
+     *  to be loaded on demand by ExtractImage()
+     */
+    void CollectImages(PoDoFo::PdfMemDocument& document, std::vector<ImageJob>& jobs);
+
     /** Extracts the image form the given PdfObject
-     *  which has to be an XObject with Subtype "Image"
-     *  \param obj a handle to a PDF object
-     *  \param jpeg if true extract as a jpeg, otherwise create a ppm
-     *  \returns ErrOk on success
+     *  which has to be an XObject with Subtype "Image".
+     *  JPEG and JPEG2000 data is written as is, other
+     *  images are written as ppm
+     *  \param document the document owning the object
+     *  \param job the image to extract
+     *  \param mutex serializes accesses to the document objects
      */
-    void ExtractImage(const PoDoFo::PdfObject& obj, bool jpeg);
+    void ExtractImage(PoDoFo::PdfMemDocument& document, const ImageJob& job, std::mutex& mutex);
 
     /** This function checks whether a file with the
      *  given filename does exist.
@@ -48,7 +75,7 @@ private:
 
 private:
     std::string_view m_outputDirectory;
-    unsigned m_ImageCount;
+    std::atomic<unsigned> m_ImageCount;
     unsigned m_fileCounter;
     char m_buffer[MAX_PATH];
 };
@@ -7,13 +7,18 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <charconv>
 
 using namespace std;
 using namespace PoDoFo;
 
+static bool tryParseThreadCount(const string_view& str, unsigned& threadCount);
+
 void print_help()
 {
-    printf("Usage: podofoimgextract [inputfile] [outputdirectory]\n\n");
+    printf("Usage: podofoimgextract [-j threads] [inputfile] [outputdirectory]\n\n");
+    printf("    -j threads   Decode and write the images using the given number of\n");
+    printf("                 threads. 0 means the number of hardware threads\n");
     printf("\nPoDoFo Version: %s\n\n", PODOFO_VERSION_STRING);
 }
 
@@ -21,17 +26,38 @@ void Main(const cspan<string_view>& args)
 {
     ImageExtractor extractor;
 
-    if (args.size() != 3)
+    unsigned threadCount = 1;
+    size_t argIndex = 1;
+    if (args.size() == 5 && args[1] == "-j")
+    {
+        if (!tryParseThreadCount(args[2], threadCount))
+        {
+            fprintf(stderr, "ERROR: Invalid number of threads: %s\n", args[2].data());
+            print_help();
+            exit(-1);
+        }
+
+        argIndex = 3;
+    }
+    else if (args.size() != 3)
     {
         print_help();
         exit(-1);
     }
 
-    auto input = args[1];
-    auto output = args[2];
+    auto input = args[argIndex];
+    auto output = args[argIndex + 1];
 
-    extractor.Init(input, output);
+    extractor.Init(input, output, threadCount);
 
     unsigned imageCount = extractor.GetNumImagesExtracted();
     printf("Extracted %u images successfully from the PDF file.\n", imageCount);
 }
+
+bool tryParseThreadCount(const string_view& str, unsigned& threadCount)
+{
+    // The whole argument must be a non negative number
+    auto end = str.data() + str.size();
+    auto result = std::from_chars(str.data(), end, threadCount);
+    return result.ec == std::errc() && result.ptr == end;
+}
@@ -0,0 +1,96 @@
+/**
+ * SPDX-FileCopyrightText: (C) 2022 Francesco Pretto <ceztko@gmail.com>
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ */
+
+#include <cstdio>
+#include <cstdlib>
+
+#include <podofo/podofo.h>
+
+using namespace std;
+using namespace PoDoFo;
+
+void print_help()
+{
+    printf("Usage: podofoimgoptimize [options] [inputfile] [outputfile]\n\n");
+    printf("    Downsample and re-encode the images of a PDF file\n\n");
+    printf("Options:\n");
+    printf("    --dpi resolution         Target resolution of the images (default: 150)\n");
+    printf("    --threshold resolution   Downsample only the images with higher resolution (default: 225)\n");
+    printf("    --quality quality        JPEG quality in range [0, 100] (default: 75)\n");
+    printf("    --jpeg                   Encode as JPEG also the images not originally JPEG encoded\n");
+    printf("    --all                    Re-encode also the images that don't need downsampling\n");
+    printf("    -j threads               Number of threads. 0 means the number of hardware threads (default: 0)\n");
+    printf("\nPoDoFo Version: %s\n\n", PODOFO_VERSION_STRING);
+}
+
+static const string_view& getOptionValue(const cspan<string_view>& args, unsigned& i)
+{
+    i++;
+    if (i >= args.size())
+    {
+        fprintf(stderr, "ERROR: %s given on the commandline but no value!\n", args[i - 1].data());
+        exit(-1);
+    }
+
+    return args[i];
+}
+
+void Main(const cspan<string_view>& args)
+{
+    PdfImageOptimizeParams params;
+    unsigned threadCount = 0;
+    string_view inputPath;
+    string_view outputPath;
+
+    // Parse the commandline options
+    for (unsigned i = 1; i < args.size(); i++)
+    {
+        if (args[i][0] == '-')
+        {
+            if (args[i] == "--dpi")
+            {
+                params.TargetResolution = atof(getOptionValue(args, i).data());
+                params.ThresholdResolution = std::max(params.ThresholdResolution, params.TargetResolution);
+            }
+            else if (args[i] == "--threshold")
+                params.ThresholdResolution = atof(getOptionValue(args, i).data());
+            else if (args[i] == "--quality")
+                params.JpegQuality = atof(getOptionValue(args, i).data()) / 100;
+            else if (args[i] == "--jpeg")
+                params.Flags |= PdfImageOptimizeFlags::PreferJpeg;
+            else if (args[i] == "--all")
+                params.Flags |= PdfImageOptimizeFlags::RecompressAll;
+            else if (args[i] == "-j")
+                threadCount = (unsigned)atoi(getOptionValue(args, i).data());
+            else
+            {
+                print_help();
+                exit(-1);
+            }
+        }
+        else if (inputPath.empty())
+            inputPath = args[i];
+        else if (outputPath.empty())
+            outputPath = args[i];
+        else
+        {
+            print_help();
+            exit(-1);
+        }
+    }
+
+    if (inputPath.empty() || outputPath.empty() || params.TargetResolution <= 0)
+    {
+        print_help();
+        exit(-1);
+    }
+
+    PdfMemDocument document;
+    document.Load(inputPath);
+    unsigned count = document.OptimizeImages(params, threadCount);
+    document.Save(outputPath);
+
+    printf("Optimized %u images.\n", count);
+}
@@ -13,58 +13,54 @@ using namespace PoDoFo;
 
 void print_help()
 {
-    printf("Usage: podofomerge [inputfile1] [inputfile2] [outputfile]\n\n");
+    printf("Usage: podofomerge [inputfile1] [inputfile2] ... [outputfile]\n\n");
+    printf("The pages of the input files are appended in order. The output\n");
+    printf("is written while the inputs are read, so the memory in use\n");
+    printf("doesn't grow with the size of the merged document.\n");
     printf("\nPoDoFo Version: %s\n\n", PODOFO_VERSION_STRING);
 }
 
-void merge(const string_view input1Path, const string_view input2Path, const string_view outputPath)
+void merge(const cspan<string_view>& inputPaths, const string_view& outputPath)
 {
-    printf("Reading file: %s\n", input1Path.data());
-    PdfMemDocument input1;
-    input1.Load(input1Path);
-    printf("Reading file: %s\n", input2Path.data());
-    PdfMemDocument input2;
-    input2.Load(input2Path);
+    // Page contents, images and fonts are written to the output as
+    // soon as they are copied. Only the smaller dictionary objects
+    // are kept in memory until the output is finished
+    PdfStreamedDocument output(outputPath);
+    for (auto& inputPath : inputPaths)
+    {
+        printf("Reading file: %s\n", inputPath.data());
 
-    printf("Appending %i pages on a document with %i pages.\n", input2.GetPages().GetCount(), input1.GetPages().GetCount());
-    input1.GetPages().AppendDocumentPages(input2);
+        // Objects are loaded on demand and the stream data is released
+        // after the copy. The input is freed before reading the next one
+        PdfMemDocument input;
+        input.Load(inputPath);
 
-    // we are going to bookmark the insertions
-    // using destinations - also adding each as a NamedDest
-    /*
-      PdfDestination	p1Dest( input1.GetPage(0) );
-    input1.AddNamedDestination( p1Dest, std::string("Input1") );
-    PdfOutlines* bMarks = input1.GetOutlines();
-    PdfOutlineItem*	bmRoot = bMarks->CreateRoot( "Merged Document" );
-    PdfOutlineItem* child1 = bmRoot->CreateChild( pszInput1, p1Dest );
-    PdfDestination	p2Dest( input1.GetPage(pgCount) );
-    input1.AddNamedDestination( p2Dest, std::string("Input2") );
-    child1->CreateNext( pszInput2, p2Dest );
-    */
+        printf("Appending %u pages on a document with %u pages.\n",
+            input.GetPages().GetCount(), output.GetPages().GetCount());
+        output.GetPages().AppendDocumentPages(input);
+    }
 
 #ifdef TEST_FULL_SCREEN
-    input1.GetCatalog().SetUseFullScreen();
+    output.GetCatalog().SetUseFullScreen();
 #else
-    input1.GetCatalog().SetPageMode(PdfPageMode::UseBookmarks);
-    input1.GetCatalog().SetHideToolbar();
-    input1.GetCatalog().SetPageLayout(PdfPageLayout::TwoColumnLeft);
+    output.GetCatalog().SetPageMode(PdfPageMode::UseBookmarks);
+    output.GetCatalog().SetHideToolbar();
+    output.GetCatalog().SetPageLayout(PdfPageLayout::TwoColumnLeft);
 #endif
 
     printf("Writing file: %s\n", outputPath.data());
-    input1.Save(outputPath);
 }
 
 void Main(const cspan<string_view>& args)
 {
-    if (args.size() != 4)
+    if (args.size() < 4)
     {
         print_help();
         exit(-1);
     }
 
-    auto input1Path = args[1];
-    auto input2Path = args[2];
-    auto outputPath = args[3];
+    auto inputPaths = args.subspan(1, args.size() - 2);
+    auto outputPath = args[args.size() - 1];
 
-    merge(input1Path, input2Path, outputPath);
+    merge(inputPaths, outputPath);
 }